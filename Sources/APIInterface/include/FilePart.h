@@ -8,6 +8,12 @@
 @property (strong, nonatomic) NSString * _Nonnull fileName;
 @property (strong, nonatomic) NSString * _Nonnull mimeType;
 
+/// Called with the SHA-256 hash of the file's content, as a lowercase hexadecimal string, once the file is entirely read
+/// while the multipart form is sent, so that the file doesn't have to be read again to hash it. It's called on the
+/// thread that reads the form, and may be called again if the form is sent again. Nil by default, in which case the
+/// file isn't hashed.
+@property (copy, nonatomic) void (^ _Nullable contentHashHandler)(NSString * _Nonnull contentHash);
+
 - (instancetype _Nonnull)initWithParameterName:(NSString * _Nonnull)parameterName
                                            url:(NSURL * _Nonnull)url
                                       fileName:(NSString * _Nonnull)fileName
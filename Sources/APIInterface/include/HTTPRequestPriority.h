@@ -0,0 +1,12 @@
+#import <Foundation/Foundation.h>
+
+/// The lane that a request is scheduled in by `HTTPRequestScheduler`.
+///
+/// `HTTPRequestPriorityDefault` is zero, so that it's the priority of the properties that aren't set.
+typedef NS_ENUM(NSInteger, HTTPRequestPriority) {
+    /// Requests that don't block the UI, i.e. syncing notifications or crawling the media library.
+    HTTPRequestPriorityBackground = -1,
+    HTTPRequestPriorityDefault = 0,
+    /// Requests that the user is waiting for, i.e. loading the content of the current screen.
+    HTTPRequestPriorityInteractive = 1
+};
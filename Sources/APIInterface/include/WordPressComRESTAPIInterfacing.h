@@ -1,4 +1,9 @@
 @import Foundation;
+#if SWIFT_PACKAGE
+#import "HTTPRequestPriority.h"
+#else
+#import <WordPressKit/HTTPRequestPriority.h>
+#endif
 
 @class FilePart;
 
@@ -27,4 +32,13 @@
                                 success:(void (^ _Nonnull)(id _Nonnull, NSHTTPURLResponse * _Nullable))success
                                 failure:(void (^ _Nonnull)(NSError * _Nonnull, NSHTTPURLResponse * _Nullable))failure;
 
+/// Like `multipartPOST:parameters:fileParts:requestEnqueued:success:failure:`, in the given `HTTPRequestScheduler` lane.
+- (NSProgress * _Nullable)multipartPOST:(NSString * _Nonnull)URLString
+                             parameters:(NSDictionary<NSString *, NSObject *> * _Nullable)parameters
+                              fileParts:(NSArray<FilePart *> * _Nonnull)fileParts
+                               priority:(HTTPRequestPriority)priority
+                        requestEnqueued:(void (^ _Nullable)(NSNumber * _Nonnull))requestEnqueue
+                                success:(void (^ _Nonnull)(id _Nonnull, NSHTTPURLResponse * _Nullable))success
+                                failure:(void (^ _Nonnull)(NSError * _Nonnull, NSHTTPURLResponse * _Nullable))failure;
+
 @end
@@ -4,15 +4,25 @@ extension Date {
 
     /// Parses a date string
     ///
-    /// Dates in the format specified in http://www.w3.org/TR/NOTE-datetime should be OK.
-    /// The kind of dates returned by the REST API should match that format, even if the doc promises ISO 8601.
+    /// Dates in the format specified in http://www.w3.org/TR/NOTE-datetime should be OK, with or without fractional
+    /// seconds. The kind of dates returned by the REST API should match that format, even if the doc promises ISO 8601.
     ///
     /// Parsing the full ISO 8601, or even RFC 3339 is more complex than this, and makes no sense right now.
     ///
+    /// The dates are parsed by `WordPressComDateParser`, which is thread-safe, instead of a `DateFormatter`.
+    ///
     /// - SeeAlso: [WordPress.com REST API docs](https://developer.wordpress.com/docs/api/)
-    /// - Warning: This method doesn't support fractional seconds or dates with leap seconds (23:59:60 turns into 23:59:00)
+    /// - Warning: Leap seconds turn into the first second of the next minute (23:59:60 turns into 00:00:00)
     static func with(wordPressComJSONString jsonString: String) -> Date? {
-        DateFormatter.wordPressCom.date(from: jsonString)
+        WordPressComDateParser.date(from: jsonString)
+    }
+
+    /// Parses a date string in GMT, like the `date_gmt` values of the WordPress REST API, which don't have a time zone
+    /// designator.
+    ///
+    /// See `with(wordPressComJSONString:)`.
+    static func with(wordPressComGMTString gmtString: String) -> Date? {
+        WordPressComDateParser.date(from: gmtString, assumingGMT: true)
     }
 
     var wordPressComJSONString: String {
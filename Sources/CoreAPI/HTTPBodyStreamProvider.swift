@@ -0,0 +1,271 @@
+import Foundation
+
+/// Provides the body streams of a request whose multipart form is streamed, and stops copying the form into them once
+/// the request completes.
+///
+/// `URLSession` asks for a new body stream whenever it sends the request again, e.g. after a redirect or an
+/// authentication challenge, so a request may use more than one stream. `stop()` must be called when the request
+/// completes, including when it's cancelled or fails, so that no writer is left waiting for a stream that's no longer
+/// read. No stream is provided once the provider is stopped.
+///
+/// When the form can't be read, e.g. because its file is deleted while it's sent, the streams would end before the
+/// request's `Content-Length`. So the first error is kept in `error`, and passed to the failure handler, which cancels
+/// the request.
+final class HTTPBodyStreamProvider {
+
+    private let lock = NSLock()
+    private let makeSource: () -> MultipartFormInputStream
+    private var writers = [BoundStreamWriter]()
+    private var isStopped = false
+    private var onStop: (() -> Void)?
+    private var onFailure: ((Error) -> Void)?
+    private var _error: Error?
+
+    init(makeSource: @escaping () -> MultipartFormInputStream) {
+        self.makeSource = makeSource
+    }
+
+    /// Returns a new stream of the form, or nil if the provider is stopped.
+    func makeStream() -> InputStream? {
+        lock.lock()
+        defer { lock.unlock() }
+
+        guard !isStopped else {
+            return nil
+        }
+
+        let (input, writer) = makeSource().boundStream { [weak self] error in
+            self?.fail(with: error)
+        }
+        if let writer {
+            writers.append(writer)
+        }
+        return input
+    }
+
+    /// The error of the first stream whose form couldn't be read, if any.
+    var error: Error? {
+        lock.lock()
+        defer { lock.unlock() }
+        return _error
+    }
+
+    /// Sets the block that's called, once, when the form of a stream can't be read. It's called straight away if the
+    /// form already failed.
+    func setOnFailure(_ block: @escaping (Error) -> Void) {
+        lock.lock()
+        let error = _error
+        if error == nil, !isStopped {
+            onFailure = block
+        }
+        lock.unlock()
+
+        if let error {
+            block(error)
+        }
+    }
+
+    /// Stop copying the form into the streams that are provided, which ends them.
+    func stop() {
+        lock.lock()
+        let writers = self.writers
+        let onStop = self.onStop
+        self.writers = []
+        self.onStop = nil
+        self.onFailure = nil
+        isStopped = true
+        lock.unlock()
+
+        writers.forEach { $0.stop() }
+        onStop?()
+    }
+
+    private func fail(with error: Error) {
+        lock.lock()
+        guard _error == nil, !isStopped else {
+            lock.unlock()
+            return
+        }
+        _error = error
+        let onFailure = self.onFailure
+        self.onFailure = nil
+        lock.unlock()
+
+        onFailure?(error)
+    }
+
+    fileprivate func setOnStop(_ block: @escaping () -> Void) {
+        lock.lock()
+        let isStopped = self.isStopped
+        if !isStopped {
+            onStop = block
+        }
+        lock.unlock()
+
+        if isStopped {
+            block()
+        }
+    }
+
+}
+
+/// Copies an `InputStream` into the output end of a bound stream pair, whose input end is used as a
+/// `URLRequest.httpBodyStream`.
+///
+/// All writers share one thread, where the copy is driven by the output stream's events: a chunk is only read from the
+/// source when the pair's buffer has space for it, and the writes never block. The writer finishes once the content is
+/// copied, when the input end is closed, when the source fails, or when `stop()` is called, whichever happens first.
+/// A source that fails is reported to `onError`, on the writers' thread, because the input end only sees the end of
+/// the stream.
+final class BoundStreamWriter: NSObject, StreamDelegate {
+
+    /// The writers' thread, which is started with the first writer and then runs for the lifetime of the process. It
+    /// sleeps in its run loop while there's no writer, so it costs a thread's stack but no CPU time.
+    private static let thread: Thread = {
+        let thread = Thread {
+            // A port keeps the run loop running while there is no stream scheduled on it.
+            RunLoop.current.add(NSMachPort(), forMode: .default)
+            while true {
+                RunLoop.current.run(mode: .default, before: .distantFuture)
+            }
+        }
+        thread.name = "org.wordpress.bound-stream-writer"
+        thread.start()
+        return thread
+    }()
+
+    /// The writers that are being copied. It's only accessed on the writers' thread.
+    private static var running = Set<BoundStreamWriter>()
+
+    private let source: InputStream
+    private let output: OutputStream
+    private let onError: ((Error) -> Void)?
+    private var buffer = [UInt8]()
+    private var pending = 0..<0
+    private var isFinished = false
+
+    init(source: InputStream, output: OutputStream, onError: ((Error) -> Void)? = nil) {
+        self.source = source
+        self.output = output
+        self.onError = onError
+    }
+
+    func start() {
+        perform(#selector(open), on: Self.thread, with: nil, waitUntilDone: false)
+    }
+
+    func stop() {
+        perform(#selector(finish), on: Self.thread, with: nil, waitUntilDone: false)
+    }
+
+    func stream(_ aStream: Stream, handle eventCode: Stream.Event) {
+        switch eventCode {
+        case .hasSpaceAvailable:
+            write()
+        case .errorOccurred, .endEncountered:
+            // The input end is closed, e.g. when its task is cancelled.
+            finish()
+        default:
+            break
+        }
+    }
+
+    @objc private func open() {
+        guard !isFinished else {
+            return
+        }
+
+        Self.running.insert(self)
+        buffer = [UInt8](repeating: 0, count: 64 * 1024)
+        source.open()
+        output.delegate = self
+        output.schedule(in: .current, forMode: .default)
+        output.open()
+    }
+
+    @objc private func finish() {
+        guard !isFinished else {
+            return
+        }
+
+        isFinished = true
+        output.delegate = nil
+        output.remove(from: .current, forMode: .default)
+        output.close()
+        source.close()
+        buffer = []
+        Self.running.remove(self)
+    }
+
+    private func write() {
+        while !isFinished {
+            if pending.isEmpty {
+                let bytes = source.hasBytesAvailable ? source.read(&buffer, maxLength: buffer.count) : 0
+                if bytes < 0 {
+                    // The input end would end before the content's length, as if the content was copied.
+                    let error = source.streamError ?? MultipartFormError.impossible
+                    finish()
+                    onError?(error)
+                    return
+                }
+                guard bytes > 0 else {
+                    // Closing the output ends the input end, once the content is copied.
+                    finish()
+                    return
+                }
+                pending = 0..<bytes
+            }
+
+            let written = buffer.withUnsafeBufferPointer {
+                output.write($0.baseAddress! + pending.lowerBound, maxLength: pending.count)
+            }
+            guard written > 0 else {
+                if written < 0 {
+                    finish()
+                }
+                return
+            }
+            pending = (pending.lowerBound + written)..<pending.upperBound
+
+            guard output.hasSpaceAvailable else {
+                return
+            }
+        }
+    }
+
+}
+
+/// The `URLSession` delegate of the API clients, which provides new body streams to the tasks whose multipart form is
+/// streamed, when `URLSession` sends their request again.
+///
+/// The per-task delegate API isn't available on iOS 13, so the streams are provided by the session's delegate.
+class BodyStreamURLSessionDelegate: MetricsURLSessionDelegate {
+
+    private let bodyStreamsLock = NSLock()
+    private var bodyStreams = [Int: HTTPBodyStreamProvider]()
+
+    /// Provide new body streams from `provider` whenever `URLSession` needs to send the task's request body again.
+    /// It must be called before the task is resumed. The task is forgotten once the provider is stopped.
+    func provideBodyStreams(to task: URLSessionTask, from provider: HTTPBodyStreamProvider) {
+        let taskIdentifier = task.taskIdentifier
+        bodyStreamsLock.lock()
+        bodyStreams[taskIdentifier] = provider
+        bodyStreamsLock.unlock()
+
+        provider.setOnStop { [weak self] in
+            guard let self else { return }
+            self.bodyStreamsLock.lock()
+            self.bodyStreams[taskIdentifier] = nil
+            self.bodyStreamsLock.unlock()
+        }
+    }
+
+    func urlSession(_ session: URLSession, task: URLSessionTask, needNewBodyStream completionHandler: @escaping (InputStream?) -> Void) {
+        bodyStreamsLock.lock()
+        let provider = bodyStreams[task.taskIdentifier]
+        bodyStreamsLock.unlock()
+
+        completionHandler(provider?.makeStream())
+    }
+
+}
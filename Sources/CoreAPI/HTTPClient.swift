@@ -1,3 +1,6 @@
+#if SWIFT_PACKAGE
+import APIInterface
+#endif
 import Foundation
 import Combine
 
@@ -49,17 +52,38 @@ extension URLSession {
     ///
     /// - Parameters:
     ///   - builder: A `HTTPRequestBuilder` instance that represents an HTTP request to be sent.
+    ///   - builtRequest: The request that the caller has already built from `builder`, if any. The request is built
+    ///         once and reused by the retry attempts, the scheduler and the rate limiter.
     ///   - acceptableStatusCodes: HTTP status code ranges that are considered a successful response. Responses with
     ///         a status code outside of these ranges are returned as a `WordPressAPIResult.unacceptableStatusCode` instance.
     ///   - parentProgress: A `Progress` instance that will be used as the parent progress of the HTTP request's overall
     ///         progress. See the function documentation regarding requirements on this argument.
     ///   - errorType: The concret endpoint error type.
+    ///   - cache: A `HTTPResponseCache` instance that's used to send a conditional request and return the cached
+    ///         response when the server responds with "304 Not Modified".
+    ///   - retrier: A `HTTPRequestRetrier` instance that's used to retry the request when it fails. The `taskCreated`
+    ///         closure is called for every attempt.
+    ///   - retryPolicy: The retry policy of this request. The `retrier`'s policy is used if it's nil.
+    ///   - rateLimiter: A `HTTPRateLimiter` instance that the request waits on before it's sent. The limiter is
+    ///         tightened when the server responds with "429 Too Many Requests".
+    ///   - scheduler: A `HTTPRequestScheduler` instance that the request is queued in before it's sent.
+    ///   - priority: The priority of the request in the `scheduler`.
+    ///   - metricsObserver: A `HTTPMetricsObserver` instance that collects the request's network metrics. The
+    ///         `URLSession` must have a delegate of `MetricsURLSessionDelegate` type for the metrics to be collected.
     func perform<E: LocalizedError>(
         request builder: HTTPRequestBuilder,
+        builtRequest: URLRequest? = nil,
         acceptableStatusCodes: [ClosedRange<Int>] = [200...299],
         taskCreated: ((Int) -> Void)? = nil,
         fulfilling parentProgress: Progress? = nil,
-        errorType: E.Type = E.self
+        errorType: E.Type = E.self,
+        cache: HTTPResponseCache? = nil,
+        retrier: HTTPRequestRetrier? = nil,
+        retryPolicy: HTTPRetryPolicy? = nil,
+        rateLimiter: HTTPRateLimiter? = nil,
+        scheduler: HTTPRequestScheduler? = nil,
+        priority: HTTPRequestPriority = .default,
+        metricsObserver: HTTPMetricsObserver? = nil
     ) async -> WordPressAPIResult<HTTPAPIResponse<Data>, E> {
         if configuration.identifier != nil {
             assert(delegate is BackgroundURLSessionDelegate, "Unexpected `URLSession` delegate type. See the `backgroundSession(configuration:)`")
@@ -70,8 +94,72 @@ extension URLSession {
             assert(parentProgress.cancellationHandler == nil, "The progress instance's cancellationHandler property must be nil")
         }
 
-        return await withCheckedContinuation { continuation in
+        let request: URLRequest
+        do {
+            request = try builtRequest ?? RequestPhaseTimer.measure(.build, endpoint: builder.endpointTemplate, size: { $0.httpBody?.count ?? 0 }) {
+                try builder.build(encodeBody: false)
+            }
+        } catch {
+            return .failure(.requestEncodingFailure(underlyingError: error))
+        }
+
+        if let retrier {
+            return await retrier.perform(method: builder.method, policy: retryPolicy, fulfilling: parentProgress) { progress in
+                await self.perform(
+                    request: builder,
+                    builtRequest: request,
+                    acceptableStatusCodes: acceptableStatusCodes,
+                    taskCreated: taskCreated,
+                    fulfilling: progress,
+                    errorType: E.self,
+                    cache: cache,
+                    rateLimiter: rateLimiter,
+                    scheduler: scheduler,
+                    priority: priority,
+                    metricsObserver: metricsObserver
+                )
+            }
+        }
+
+        // Wait for a scheduler slot before taking a rate limiter token, so that queued requests of a lower priority
+        // don't use up the tokens.
+        if let scheduler {
+            return await scheduler.perform(
+                request,
+                priority: priority,
+                fulfilling: parentProgress,
+                cancelled: { .failure(.connection(URLError(.cancelled))) },
+                operation: { progress in
+                    await self.perform(
+                        request: builder,
+                        builtRequest: request,
+                        acceptableStatusCodes: acceptableStatusCodes,
+                        taskCreated: taskCreated,
+                        fulfilling: progress,
+                        errorType: E.self,
+                        cache: cache,
+                        rateLimiter: rateLimiter,
+                        metricsObserver: metricsObserver
+                    )
+                }
+            )
+        }
+
+        let url = request.url
+        if let rateLimiter, let url {
+            guard await rateLimiter.wait(for: url, cancelledBy: parentProgress) else {
+                return .failure(.connection(URLError(.cancelled)))
+            }
+        }
+
+        // The cached response is looked up before the task is created, so that it's not read from disk synchronously.
+        let cached = await cache?.lookUp(request)
+
+        let result: WordPressAPIResult<HTTPAPIResponse<Data>, E> = await withCheckedContinuation { continuation in
+            let networkStart = RequestPhaseTimer.start()
             let completion: @Sendable (Data?, URLResponse?, Error?) -> Void = { data, response, error in
+                RequestPhaseTimer.record(.network, endpoint: builder.endpointTemplate, size: data?.count ?? 0, since: networkStart)
+
                 let result: WordPressAPIResult<HTTPAPIResponse<Data>, E> = Self.parseResponse(
                     data: data,
                     response: response,
@@ -85,33 +173,134 @@ extension URLSession {
             let task: URLSessionTask
 
             do {
-                task = try self.task(for: builder, completion: completion)
+                task = try self.task(for: request, builtWith: builder, cache: cache, cached: cached, completion: completion)
             } catch {
                 continuation.resume(returning: .failure(.requestEncodingFailure(underlyingError: error)))
                 return
             }
 
+            if let metricsObserver {
+                (self.delegate as? MetricsURLSessionDelegate)?.observe(task, endpoint: builder.endpointTemplate, with: metricsObserver)
+            }
+
             task.resume()
             taskCreated?(task.taskIdentifier)
 
-            if let parentProgress, parentProgress.totalUnitCount > parentProgress.completedUnitCount {
-                let pending = parentProgress.totalUnitCount - parentProgress.completedUnitCount
-                // The Jetpack/WordPress app requires task progress updates to be delievered on the main queue.
-                let progressUpdator = parentProgress.update(totalUnit: pending, with: task.progress, queue: .main)
+            Self.track(task, fulfilling: parentProgress)
+        }
 
-                parentProgress.cancellationHandler = { [weak task] in
-                    task?.cancel()
-                    progressUpdator.cancel()
-                }
+        if let rateLimiter, let url, let response = result.httpResponse, response.statusCode == 429 {
+            rateLimiter.throttle(url, for: HTTPRequestRetrier.retryAfter(in: response) ?? 0)
+        }
+
+        return result
+    }
+
+    /// Send a HTTP request and pass its response body to the `receive` closure in chunks, as it's being downloaded.
+    ///
+    /// Unlike `perform(request:...)`, the response body is not kept in memory. It's up to the `receive` closure to
+    /// decode the chunks as they arrive. The closure is called serially, on the session's delegate queue.
+    ///
+    /// The `URLSession` must have a delegate of `StreamingURLSessionDelegate` type. The HTTP status code is not checked
+    /// either: the closure receives the response body regardless of the status code.
+    ///
+    /// See `perform(request:...)` regarding the `parentProgress` and `metricsObserver` arguments.
+    func stream<E: LocalizedError>(
+        request builder: HTTPRequestBuilder,
+        fulfilling parentProgress: Progress? = nil,
+        errorType: E.Type = E.self,
+        metricsObserver: HTTPMetricsObserver? = nil,
+        receiving receive: @escaping (HTTPURLResponse, Data) -> Void
+    ) async -> WordPressAPIResult<HTTPURLResponse, E> {
+        guard let delegate = delegate as? StreamingURLSessionDelegate else {
+            assertionFailure("Unexpected `URLSession` delegate type. The delegate must be a `StreamingURLSessionDelegate` instance")
+            return .failure(.unknown(underlyingError: URLError(.unsupportedURL)))
+        }
+
+        if let parentProgress {
+            assert(parentProgress.completedUnitCount == 0 && parentProgress.totalUnitCount > 0, "Invalid parent progress")
+            assert(parentProgress.cancellationHandler == nil, "The progress instance's cancellationHandler property must be nil")
+        }
+
+        return await withCheckedContinuation { continuation in
+            let request: URLRequest
+            do {
+                request = try builder.build(encodeBody: true)
+            } catch {
+                continuation.resume(returning: .failure(.requestEncodingFailure(underlyingError: error)))
+                return
+            }
+
+            let task = dataTask(with: request)
+            delegate.register(
+                receive: { data, response in
+                    guard let response = response as? HTTPURLResponse else { return }
+                    receive(response, data)
+                },
+                completion: { response, error in
+                    let result: WordPressAPIResult<HTTPAPIResponse<Data>, E> = Self.parseResponse(
+                        data: nil,
+                        response: response,
+                        error: error,
+                        acceptableStatusCodes: [1...999]
+                    )
+                    continuation.resume(returning: result.map { $0.response })
+                },
+                forTaskWithIdentifier: task.taskIdentifier
+            )
+            if let metricsObserver {
+                delegate.observe(task, endpoint: builder.endpointTemplate, with: metricsObserver)
             }
+            task.resume()
+
+            Self.track(task, fulfilling: parentProgress)
+        }
+    }
+
+    private static func track(_ task: URLSessionTask, fulfilling parentProgress: Progress?) {
+        guard let parentProgress, parentProgress.totalUnitCount > parentProgress.completedUnitCount else {
+            return
+        }
+
+        let pending = parentProgress.totalUnitCount - parentProgress.completedUnitCount
+        // The Jetpack/WordPress app requires task progress updates to be delievered on the main queue.
+        let progressUpdator = parentProgress.update(totalUnit: pending, with: fractionCompleted(of: task), queue: .main)
+
+        parentProgress.cancellationHandler = { [weak task] in
+            task?.cancel()
+            progressUpdator.cancel()
+        }
+    }
+
+    /// The `progress` of a `dataTask` only tracks the response. When the task streams its request body, which
+    /// `uploadTask` can't do, the upload is tracked from the number of bytes sent against the `Content-Length`, so
+    /// that uploads report the same progress whether their form is streamed or not.
+    private static func fractionCompleted(of task: URLSessionTask) -> AnyPublisher<Double, Never> {
+        guard task.originalRequest?.httpBodyStream != nil else {
+            return task.progress.publisher(for: \.fractionCompleted, options: .new).eraseToAnyPublisher()
         }
+
+        let sent = task.publisher(for: \.countOfBytesSent)
+            .combineLatest(task.publisher(for: \.countOfBytesExpectedToSend))
+            .map { sent, expected in
+                expected > 0 ? min(Double(sent) / Double(expected), 1) : 0
+            }
+        // The task's progress completes when the response is received, even if the body isn't read, e.g. by a stub.
+        return sent.combineLatest(task.progress.publisher(for: \.fractionCompleted))
+            .map { max($0, $1) }
+            .removeDuplicates()
+            .eraseToAnyPublisher()
     }
 
     private func task(
-        for builder: HTTPRequestBuilder,
-        completion originalCompletion: @escaping @Sendable (Data?, URLResponse?, Error?) -> Void
+        for builtRequest: URLRequest,
+        builtWith builder: HTTPRequestBuilder,
+        cache: HTTPResponseCache?,
+        cached: HTTPResponseCache.Lookup?,
+        completion taskCompletion: @escaping @Sendable (Data?, URLResponse?, Error?) -> Void
     ) throws -> URLSessionTask {
-        var request = try builder.build(encodeBody: false)
+        var request = builtRequest
+        let originalCompletion = cache?.prepare(&request, lookup: cached, completion: taskCompletion) ?? taskCompletion
 
         // This additional `callCompletionFromDelegate` is added to unit test `BackgroundURLSessionDelegate`.
         // Background `URLSession` doesn't work on unit tests, we have to create a non-background `URLSession`
@@ -121,11 +310,14 @@ extension URLSession {
         let callCompletionFromDelegate = delegate is BackgroundURLSessionDelegate
         let isBackgroundSession = configuration.identifier != nil
         let task: URLSessionTask
-        let body = try builder.encodeMultipartForm(request: &request, forceWriteToFile: isBackgroundSession)
-            ?? builder.encodeXMLRPC(request: &request, forceWriteToFile: isBackgroundSession)
+        let bodyStreams = isBackgroundSession ? nil : builder.multipartFormBodyStreams()
+        let body = try RequestPhaseTimer.measure(.encode, endpoint: builder.endpointTemplate, size: Self.size(of:)) {
+            try builder.encodeMultipartForm(request: &request, forceWriteToFile: isBackgroundSession, bodyStreams: bodyStreams)
+                ?? builder.encodeXMLRPC(request: &request, forceWriteToFile: isBackgroundSession)
+        }
         var completion = originalCompletion
         if let body {
-            // Use special `URLSession.uploadTask` API for multipart POST requests.
+            // Use special `URLSession.uploadTask` API for request body that's encoded upfront.
             task = body.map(
                 left: {
                     if callCompletionFromDelegate {
@@ -149,12 +341,36 @@ extension URLSession {
                 }
             )
         } else {
-            // Use `URLSession.dataTask` for all other request
+            // Use `URLSession.dataTask` for all other request, including multipart forms that are streamed
+            // from `request.httpBodyStream`.
+            let streamedBody = request.httpBodyStream == nil ? nil : bodyStreams
+            if let streamedBody {
+                // Stop copying the form into the body streams once the HTTP request completes, which includes when
+                // the task is cancelled before its body is read.
+                completion = { data, response, error in
+                    streamedBody.stop()
+                    // A form that can't be read cancels the task, whose error is then the form's error.
+                    originalCompletion(data, response, streamedBody.error ?? error)
+                }
+            }
+
             if callCompletionFromDelegate {
                 task = dataTask(with: request)
             } else {
                 task = dataTask(with: request, completionHandler: completion)
             }
+
+            if let streamedBody {
+                // The body stream would end before the request's `Content-Length` if the form can't be read.
+                streamedBody.setOnFailure { [weak task] _ in
+                    task?.cancel()
+                }
+
+                // `URLSession` asks for a new body stream when it sends the request again, e.g. after a redirect.
+                if let delegate = delegate as? BodyStreamURLSessionDelegate {
+                    delegate.provideBodyStreams(to: task, from: streamedBody)
+                }
+            }
         }
 
         if callCompletionFromDelegate {
@@ -166,6 +382,14 @@ extension URLSession {
         return task
     }
 
+    /// The number of bytes of an encoded request body, which is used by `RequestPhaseTimer`.
+    private static func size(of body: Either<Data, URL>?) -> Int {
+        body?.map(
+            left: { $0.count },
+            right: { (try? $0.resourceValues(forKeys: [.fileSizeKey]).fileSize) ?? 0 }
+        ) ?? 0
+    }
+
     private static func parseResponse<E: LocalizedError>(
         data: Data?,
         response: URLResponse?,
@@ -245,10 +469,28 @@ extension WordPressAPIResult {
 
 }
 
+private extension WordPressAPIResult where Success == HTTPAPIResponse<Data> {
+    var httpResponse: HTTPURLResponse? {
+        switch self {
+        case let .success(response):
+            return response.response
+        case let .failure(.unacceptableStatusCode(response, _)):
+            return response
+        default:
+            return nil
+        }
+    }
+}
+
 extension Progress {
     func update(totalUnit: Int64, with progress: Progress, queue: DispatchQueue) -> AnyCancellable {
+        update(totalUnit: totalUnit, with: progress.publisher(for: \.fractionCompleted, options: .new), queue: queue)
+    }
+
+    func update<P: Publisher>(totalUnit: Int64, with fractionCompleted: P, queue: DispatchQueue) -> AnyCancellable
+    where P.Output == Double, P.Failure == Never {
         let start = self.completedUnitCount
-        return progress.publisher(for: \.fractionCompleted, options: .new)
+        return fractionCompleted
             .receive(on: queue)
             .sink { [weak self] fraction in
                 self?.completedUnitCount = start + Int64(fraction * Double(totalUnit))
@@ -263,7 +505,7 @@ private final class SessionTaskData {
     var completion: ((Data?, URLResponse?, Error?) -> Void)?
 }
 
-class BackgroundURLSessionDelegate: NSObject, URLSessionDataDelegate {
+class BackgroundURLSessionDelegate: BodyStreamURLSessionDelegate, URLSessionDataDelegate {
 
     private var taskData = [Int: SessionTaskData]()
 
@@ -329,6 +571,48 @@ private extension URLSession {
 
 }
 
+// MARK: - Streaming Response Support
+
+/// A `URLSessionDataDelegate` that passes the response body of the tasks created by `URLSession.stream(request:...)`
+/// to their `receive` closures.
+///
+/// Tasks that are created with a completion handler are not affected, since their data is not delivered to the delegate.
+class StreamingURLSessionDelegate: BodyStreamURLSessionDelegate, URLSessionDataDelegate {
+
+    private struct Handlers {
+        var receive: (Data, URLResponse?) -> Void
+        var completion: (URLResponse?, Error?) -> Void
+    }
+
+    private let lock = NSLock()
+    private var handlers = [Int: Handlers]()
+
+    fileprivate func register(
+        receive: @escaping (Data, URLResponse?) -> Void,
+        completion: @escaping (URLResponse?, Error?) -> Void,
+        forTaskWithIdentifier taskID: Int
+    ) {
+        lock.lock()
+        handlers[taskID] = Handlers(receive: receive, completion: completion)
+        lock.unlock()
+    }
+
+    private func handlers(forTaskWithIdentifier taskID: Int, remove: Bool = false) -> Handlers? {
+        lock.lock()
+        defer { lock.unlock() }
+        return remove ? handlers.removeValue(forKey: taskID) : handlers[taskID]
+    }
+
+    func urlSession(_ session: URLSession, dataTask: URLSessionDataTask, didReceive data: Data) {
+        handlers(forTaskWithIdentifier: dataTask.taskIdentifier)?.receive(data, dataTask.response)
+    }
+
+    func urlSession(_ session: URLSession, task: URLSessionTask, didCompleteWithError error: Error?) {
+        handlers(forTaskWithIdentifier: task.taskIdentifier, remove: true)?.completion(task.response, error)
+    }
+
+}
+
 extension URLSession {
     var debugNumberOfTaskData: Int {
         self.taskData.count
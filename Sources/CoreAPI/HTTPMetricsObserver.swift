@@ -0,0 +1,212 @@
+import Foundation
+
+/// The network metrics of one HTTP request, collected from its `URLSessionTaskMetrics`.
+///
+/// The phase durations are taken from the request's last transaction, which is the one that received the final
+/// response. They are nil when the phase didn't happen, i.e. DNS lookup on a reused connection, or the response was
+/// loaded from the cache.
+public struct HTTPRequestMetrics {
+    /// The endpoint of the request without its IDs, i.e. `GET /rest/v1.1/sites/:site/posts/:id`, or the method name of
+    /// an XML-RPC request, i.e. `XMLRPC wp.getPosts`.
+    public var endpoint: String
+    public var statusCode: Int?
+    /// The time from the creation of the task to its completion.
+    public var duration: TimeInterval
+    public var domainLookup: TimeInterval?
+    /// The time it takes to establish the connection, including the TLS handshake.
+    public var connect: TimeInterval?
+    public var secureConnection: TimeInterval?
+    /// The time from the start of the request to the first byte of the response.
+    public var timeToFirstByte: TimeInterval?
+    /// The time from the first byte of the response to the last byte.
+    public var transfer: TimeInterval?
+    /// The number of bytes sent, including the headers.
+    public var requestBytes: Int64
+    /// The number of bytes received, including the headers.
+    public var responseBytes: Int64
+    public var reusedConnection: Bool
+    /// The network protocol, i.e. "h2" or "http/1.1".
+    public var networkProtocol: String?
+    public var redirectCount: Int
+}
+
+/// Collects the network metrics of the requests that are sent by the API instances that use this observer, and keeps
+/// rolling per-endpoint histograms of their durations.
+///
+/// One observer can be shared among multiple API instances.
+public final class HTTPMetricsObserver {
+
+    public struct Percentiles {
+        public var p50: TimeInterval
+        public var p95: TimeInterval
+        public var p99: TimeInterval
+    }
+
+    /// A summary of the recent requests to one endpoint.
+    public struct EndpointSummary {
+        /// The number of requests that are collected since the observer is created.
+        public var count: Int
+        /// The percentiles of the requests' durations, within the rolling window.
+        public var duration: Percentiles
+        /// The percentiles of the requests' time to first byte, within the rolling window.
+        public var timeToFirstByte: Percentiles?
+        public var responseBytes: Int64
+        /// The fraction of the requests, within the rolling window, that reused an existing connection.
+        public var connectionReuseRate: Double
+    }
+
+    private final class Window {
+        var count = 0
+        var samples = [HTTPRequestMetrics]()
+        var responseBytes: Int64 = 0
+    }
+
+    /// The endpoint that the requests are collected under once `maximumEndpointCount` endpoints have been requested,
+    /// other than the ones of those endpoints.
+    public static let otherEndpoints = "OTHER"
+
+    /// The number of the most recent requests of each endpoint that are used to calculate the percentiles.
+    public let windowSize: Int
+
+    /// The maximum number of endpoints that are summarized separately. It bounds the memory that the observer uses when
+    /// the endpoint templates still contain IDs that aren't recognized as such.
+    public let maximumEndpointCount: Int
+
+    private let handler: ((HTTPRequestMetrics) -> Void)?
+    private let lock = NSLock()
+    private var windows = [String: Window]()
+
+    /// - Parameters:
+    ///   - windowSize: The number of the most recent requests of each endpoint that are used to calculate the percentiles.
+    ///   - maximumEndpointCount: The maximum number of endpoints that are summarized separately. The requests of the
+    ///         other endpoints are summarized together, under `otherEndpoints`.
+    ///   - handler: Called with the metrics of each request as they are collected, on a background queue. It can be
+    ///         used to export the metrics.
+    public init(windowSize: Int = 200, maximumEndpointCount: Int = 500, handler: ((HTTPRequestMetrics) -> Void)? = nil) {
+        self.windowSize = max(1, windowSize)
+        self.maximumEndpointCount = max(1, maximumEndpointCount)
+        self.handler = handler
+    }
+
+    /// Returns the summaries of all endpoints that have been requested, keyed by their endpoint template, and of the
+    /// endpoints past `maximumEndpointCount`, under `otherEndpoints`.
+    public func snapshot() -> [String: EndpointSummary] {
+        lock.lock()
+        let windows = windows.mapValues { ($0.count, $0.samples, $0.responseBytes) }
+        lock.unlock()
+
+        return windows.compactMapValues { count, samples, responseBytes in
+            guard let duration = Self.percentiles(of: samples.map(\.duration)) else {
+                return nil
+            }
+
+            return EndpointSummary(
+                count: count,
+                duration: duration,
+                timeToFirstByte: Self.percentiles(of: samples.compactMap(\.timeToFirstByte)),
+                responseBytes: responseBytes,
+                connectionReuseRate: Double(samples.filter(\.reusedConnection).count) / Double(samples.count)
+            )
+        }
+    }
+
+    func record(_ metrics: HTTPRequestMetrics) {
+        lock.lock()
+        var endpoint = metrics.endpoint
+        if windows[endpoint] == nil, windows.count >= maximumEndpointCount {
+            endpoint = Self.otherEndpoints
+        }
+        let window = windows[endpoint] ?? Window()
+        windows[endpoint] = window
+        window.count += 1
+        window.responseBytes += metrics.responseBytes
+        window.samples.append(metrics)
+        if window.samples.count > windowSize {
+            window.samples.removeFirst(window.samples.count - windowSize)
+        }
+        lock.unlock()
+
+        handler?(metrics)
+    }
+
+    private static func percentiles(of values: [TimeInterval]) -> Percentiles? {
+        guard !values.isEmpty else {
+            return nil
+        }
+
+        let sorted = values.sorted()
+        func percentile(_ fraction: Double) -> TimeInterval {
+            // Nearest-rank method.
+            let rank = Int((fraction * Double(sorted.count)).rounded(.up))
+            return sorted[min(max(rank, 1), sorted.count) - 1]
+        }
+        return Percentiles(p50: percentile(0.5), p95: percentile(0.95), p99: percentile(0.99))
+    }
+}
+
+extension HTTPRequestMetrics {
+
+    init(endpoint: String, metrics: URLSessionTaskMetrics, response: URLResponse?) {
+        let transactions = metrics.transactionMetrics
+        let transaction = transactions.last
+
+        func interval(_ start: Date?, _ end: Date?) -> TimeInterval? {
+            guard let start, let end else { return nil }
+            return end.timeIntervalSince(start)
+        }
+
+        self.init(
+            endpoint: endpoint,
+            statusCode: (response as? HTTPURLResponse)?.statusCode,
+            duration: metrics.taskInterval.duration,
+            domainLookup: interval(transaction?.domainLookupStartDate, transaction?.domainLookupEndDate),
+            connect: interval(transaction?.connectStartDate, transaction?.connectEndDate),
+            secureConnection: interval(transaction?.secureConnectionStartDate, transaction?.secureConnectionEndDate),
+            timeToFirstByte: interval(transaction?.requestStartDate, transaction?.responseStartDate),
+            transfer: interval(transaction?.responseStartDate, transaction?.responseEndDate),
+            requestBytes: transactions.reduce(0) { $0 + $1.countOfRequestHeaderBytesSent + $1.countOfRequestBodyBytesSent },
+            responseBytes: transactions.reduce(0) { $0 + $1.countOfResponseHeaderBytesReceived + $1.countOfResponseBodyBytesReceived },
+            reusedConnection: transaction?.isReusedConnection ?? false,
+            networkProtocol: transaction?.networkProtocolName,
+            redirectCount: metrics.redirectCount
+        )
+    }
+
+}
+
+// MARK: - URLSession Support
+
+/// A `URLSessionTaskDelegate` that passes the `URLSessionTaskMetrics` of the tasks created by
+/// `URLSession.perform(request:...)` and `URLSession.stream(request:...)` to their `HTTPMetricsObserver`.
+///
+/// The metrics of tasks that are sent without an observer are not collected.
+class MetricsURLSessionDelegate: NSObject, URLSessionTaskDelegate {
+
+    private struct Observation {
+        var endpoint: String
+        var observer: HTTPMetricsObserver
+    }
+
+    private let metricsLock = NSLock()
+    private var observations = [Int: Observation]()
+
+    /// Start observing the task. It must be called before the task is resumed.
+    func observe(_ task: URLSessionTask, endpoint: String, with observer: HTTPMetricsObserver) {
+        metricsLock.lock()
+        observations[task.taskIdentifier] = Observation(endpoint: endpoint, observer: observer)
+        metricsLock.unlock()
+    }
+
+    func urlSession(_ session: URLSession, task: URLSessionTask, didFinishCollecting metrics: URLSessionTaskMetrics) {
+        metricsLock.lock()
+        let observation = observations.removeValue(forKey: task.taskIdentifier)
+        metricsLock.unlock()
+
+        guard let observation else {
+            return
+        }
+
+        observation.observer.record(HTTPRequestMetrics(endpoint: observation.endpoint, metrics: metrics, response: task.response))
+    }
+
+}
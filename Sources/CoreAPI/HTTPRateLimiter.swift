@@ -0,0 +1,186 @@
+import Foundation
+
+/// A token bucket rate limiter, which makes HTTP requests wait until they can be sent without exceeding the
+/// configured rate, instead of letting them fail with "too many requests" errors.
+///
+/// Requests are grouped into buckets by their URL's host, or by the `key` closure that's passed to the initializer,
+/// i.e. to limit an endpoint family separately from the rest of the API. Each bucket allows `burst` requests to be
+/// sent at once, and `rate` requests per second after that.
+///
+/// When a request is throttled by the server, its bucket tightens automatically: its rate is halved and no requests
+/// are sent until the throttling is lifted. The rate then recovers gradually over `recoveryInterval`.
+///
+/// One limiter can be shared among multiple API instances, so that they stay under the same server limit together.
+public final class HTTPRateLimiter {
+
+    public struct Statistics {
+        /// The number of requests that had to wait before being sent.
+        public var waits: Int = 0
+        /// The total time that's spent waiting by all requests.
+        public var totalWaitTime: TimeInterval = 0
+        /// The number of times a bucket is tightened because a request was throttled.
+        public var throttles: Int = 0
+    }
+
+    private struct Bucket {
+        var tokens: Double
+        var updatedAt: Date
+        var tightenedRate: Double?
+        var blockedUntil: Date = .distantPast
+    }
+
+    /// The number of requests per second that are allowed in each bucket.
+    public let rate: Double
+    /// The number of requests that are allowed to be sent at once in each bucket.
+    public let burst: Int
+    /// The time it takes for a tightened bucket to recover to the configured rate, after the throttling is lifted.
+    public let recoveryInterval: TimeInterval
+
+    private let key: (URL) -> String
+    private let lock = NSLock()
+    private var buckets = [String: Bucket]()
+    private var _statistics = Statistics()
+
+    /// - Parameters:
+    ///   - rate: The number of requests per second that are allowed in each bucket.
+    ///   - burst: The number of requests that are allowed to be sent at once in each bucket.
+    ///   - recoveryInterval: The time it takes for a tightened bucket to recover to the configured rate.
+    ///   - key: Returns the bucket of a request URL. The URL's host is used by default.
+    public init(
+        rate: Double,
+        burst: Int,
+        recoveryInterval: TimeInterval = 60,
+        key: @escaping (URL) -> String = { $0.host ?? "" }
+    ) {
+        assert(rate > 0 && burst > 0, "Invalid rate limit")
+
+        self.rate = rate
+        self.burst = max(1, burst)
+        self.recoveryInterval = recoveryInterval
+        self.key = key
+    }
+
+    public var statistics: Statistics {
+        lock.lock()
+        defer { lock.unlock() }
+        return _statistics
+    }
+
+    /// Wait until a request to the given URL can be sent.
+    ///
+    /// - Parameter progress: The request's progress, which can be cancelled to stop waiting. Its `cancellationHandler`
+    ///     must be nil, and it's reset to nil when this function returns.
+    /// - Returns: false if the waiting is cancelled, which means the request should not be sent.
+    func wait(for url: URL, cancelledBy progress: Progress? = nil) async -> Bool {
+        let key = self.key(url)
+        if take(key: key, now: Date()) == nil {
+            return true
+        }
+
+        let start = Date()
+        let task = Task<Void, Error> {
+            while let delay = take(key: key, now: Date()) {
+                try await Task.sleep(nanoseconds: UInt64(delay * 1_000_000_000))
+            }
+        }
+
+        progress?.cancellationHandler = { task.cancel() }
+        if progress?.isCancelled == true {
+            task.cancel()
+        }
+        defer {
+            progress?.cancellationHandler = nil
+        }
+
+        do {
+            try await withTaskCancellationHandler {
+                try await task.value
+            } onCancel: {
+                task.cancel()
+            }
+        } catch {
+            return false
+        }
+
+        lock.lock()
+        _statistics.waits += 1
+        _statistics.totalWaitTime += Date().timeIntervalSince(start)
+        lock.unlock()
+
+        return true
+    }
+
+    /// Tighten the bucket of the given URL, because a request to it was throttled by the server.
+    ///
+    /// - Parameter delay: How long the server asks the client to wait before sending requests again.
+    public func throttle(_ url: URL, for delay: TimeInterval) {
+        let key = self.key(url)
+        let now = Date()
+
+        lock.lock()
+        defer { lock.unlock() }
+
+        var bucket = refilled(key: key, now: now)
+        bucket.tightenedRate = max(rate / 16, currentRate(of: bucket, now: now) / 2)
+        bucket.tokens = 0
+        bucket.blockedUntil = max(bucket.blockedUntil, now.addingTimeInterval(delay))
+        buckets[key] = bucket
+
+        _statistics.throttles += 1
+    }
+
+    /// Take a token from the bucket, and return nil if it's taken. Otherwise, return how long to wait before trying again.
+    private func take(key: String, now: Date) -> TimeInterval? {
+        lock.lock()
+        defer { lock.unlock() }
+
+        var bucket = refilled(key: key, now: now)
+        defer { buckets[key] = bucket }
+
+        if bucket.blockedUntil > now {
+            return bucket.blockedUntil.timeIntervalSince(now)
+        }
+
+        if bucket.tokens >= 1 {
+            bucket.tokens -= 1
+            return nil
+        }
+
+        return (1 - bucket.tokens) / currentRate(of: bucket, now: now)
+    }
+
+    private func refilled(key: String, now: Date) -> Bucket {
+        guard var bucket = buckets[key] else {
+            return Bucket(tokens: Double(burst), updatedAt: now)
+        }
+
+        let start = max(bucket.updatedAt, bucket.blockedUntil)
+        if now > start {
+            bucket.tokens = min(Double(burst), bucket.tokens + now.timeIntervalSince(start) * currentRate(of: bucket, now: now))
+        }
+        if bucket.tightenedRate != nil, currentRate(of: bucket, now: now) >= rate {
+            bucket.tightenedRate = nil
+        }
+        bucket.updatedAt = now
+        return bucket
+    }
+
+    /// The bucket's rate, which increases linearly from the tightened rate to the configured rate after the throttling
+    /// is lifted.
+    private func currentRate(of bucket: Bucket, now: Date) -> Double {
+        guard let tightenedRate = bucket.tightenedRate else {
+            return rate
+        }
+
+        let recovered = now.timeIntervalSince(bucket.blockedUntil)
+        guard recovered > 0 else {
+            return tightenedRate
+        }
+
+        guard recoveryInterval > 0 else {
+            return rate
+        }
+
+        return min(rate, tightenedRate + (rate - tightenedRate) * recovered / recoveryInterval)
+    }
+}
@@ -26,13 +26,19 @@ final class HTTPRequestBuilder {
     private var appendedQuery: [URLQueryItem] = []
     private var bodyBuilder: ((inout URLRequest) throws -> Void)?
     private(set) var multipartForm: [MultipartFormField]?
+    private let multipartFormBoundary = String(format: "wordpresskit.%08x", Int.random(in: Int.min..<Int.max))
     private(set) var xmlrpcRequest: XMLRPCRequest?
 
-    init(url: URL) {
-        assert(url.scheme == "http" || url.scheme == "https")
-        assert(url.host != nil)
+    convenience init(url: URL) {
+        self.init(components: URLComponents(url: url, resolvingAgainstBaseURL: true)!)
+    }
+
+    /// Create a builder from a URL that's already parsed, which saves parsing the URL again.
+    init(components: URLComponents) {
+        assert(components.scheme == "http" || components.scheme == "https")
+        assert(components.host != nil)
 
-        original = URLComponents(url: url, resolvingAgainstBaseURL: true)!
+        original = components
     }
 
     func method(_ method: Method) -> Self {
@@ -148,6 +154,51 @@ final class HTTPRequestBuilder {
         return self
     }
 
+    /// The request's endpoint without its IDs, i.e. `GET /rest/v1.1/sites/:site/posts/:id`, which groups the requests
+    /// that are sent to the same endpoint of different sites or objects. XML-RPC requests are grouped by their method
+    /// name, i.e. `XMLRPC wp.getPosts`.
+    var endpointTemplate: String {
+        if let xmlrpcRequest {
+            return "XMLRPC \(xmlrpcRequest.method)"
+        }
+
+        return "\(method.rawValue) \(Self.endpointTemplate(forPath: Self.join(original.percentEncodedPath, appendedPath)))"
+    }
+
+    /// Replace the IDs in the given URL path with placeholders. See `endpointTemplate`.
+    static func endpointTemplate(forPath aPath: String) -> String {
+        var path = aPath
+        // Self-hosted sites may be installed in a subdirectory.
+        if let range = path.range(of: "/wp-json/") {
+            path = String(path[range.lowerBound...])
+        }
+
+        var previous: Substring?
+        let segments = path.split(separator: "/").map { segment -> Substring in
+            defer { previous = segment }
+            if previous == "sites" {
+                return ":site"
+            }
+            return isIdentifier(segment) ? ":id" : segment
+        }
+
+        return "/\(segments.joined(separator: "/"))"
+    }
+
+    /// Whether the path segment is an identifier rather than a part of the endpoint: a number, a UUID or a hash, a
+    /// percent-encoded value, like a feed URL or a plugin slug, or a WP.com `slug:` or `name:` lookup.
+    private static func isIdentifier(_ segment: Substring) -> Bool {
+        if segment.allSatisfy(\.isNumber) || segment.contains("%") {
+            return true
+        }
+        if segment.hasPrefix("slug:") || segment.hasPrefix("name:") {
+            return true
+        }
+        // UUIDs and hashes, i.e. of an email address for Gravatar.
+        let hexDigits = segment.filter { $0 != "-" }
+        return hexDigits.count >= 16 && hexDigits.allSatisfy(\.isHexDigit) && hexDigits.contains(where: \.isNumber)
+    }
+
     func build(encodeBody: Bool = false) throws -> URLRequest {
         var components = original
 
@@ -184,7 +235,9 @@ final class HTTPRequestBuilder {
         }
 
         if encodeBody {
-            let body = try encodeMultipartForm(request: &request, forceWriteToFile: false) ?? encodeXMLRPC(request: &request, forceWriteToFile: false)
+            // There's no body stream provider here, so the multipart form isn't streamed.
+            let body = try encodeMaterializedMultipartForm(request: &request, forceWriteToFile: false)
+                ?? encodeXMLRPC(request: &request, forceWriteToFile: false)
             if let body {
                 switch body {
                 case let .left(data):
@@ -203,15 +256,60 @@ final class HTTPRequestBuilder {
         return request
     }
 
-    func encodeMultipartForm(request: inout URLRequest, forceWriteToFile: Bool) throws -> Either<Data, URL>? {
+    /// Encode the multipart form into the given request.
+    ///
+    /// A form that has a file field is streamed to the server: `request.httpBodyStream` is set to a stream that reads
+    /// the fields' content while it's being sent, with the form's exact `Content-Length`, and `nil` is returned. The
+    /// stream is made by `bodyStreams`, which is returned by `multipartFormBodyStreams()`, so that it's stopped with the
+    /// other streams of the request. It's an error to stream a form without `bodyStreams`, because nothing would stop
+    /// its stream if the request didn't read it to the end.
+    ///
+    /// Other forms are encoded like `encodeMaterializedMultipartForm(request:forceWriteToFile:)` does.
+    func encodeMultipartForm(
+        request: inout URLRequest,
+        forceWriteToFile: Bool,
+        bodyStreams: HTTPBodyStreamProvider? = nil
+    ) throws -> Either<Data, URL>? {
+        guard let multipartForm, !multipartForm.isEmpty else {
+            return nil
+        }
+
+        if forceWriteToFile || !multipartForm.contains(where: { $0.isFile }) {
+            return try encodeMaterializedMultipartForm(request: &request, forceWriteToFile: forceWriteToFile)
+        }
+
+        guard let bodyStream = bodyStreams?.makeStream() else {
+            throw MultipartFormError.missingBodyStreams
+        }
+
+        let stream = multipartForm.multipartFormInputStream(boundary: multipartFormBoundary)
+        request.setValue("multipart/form-data; boundary=\(multipartFormBoundary)", forHTTPHeaderField: "Content-Type")
+        request.setValue("\(stream.contentLength)", forHTTPHeaderField: "Content-Length")
+        request.httpBodyStream = bodyStream
+        return nil
+    }
+
+    /// Encode the multipart form into memory, or into a temporary file when it's larger than 10 MB, and set its
+    /// `Content-Type` on the given request. The form is always written into a temporary file when `forceWriteToFile`
+    /// is true, which is required by background `URLSession`.
+    func encodeMaterializedMultipartForm(request: inout URLRequest, forceWriteToFile: Bool) throws -> Either<Data, URL>? {
         guard let multipartForm, !multipartForm.isEmpty else {
             return nil
         }
 
-        let boundery = String(format: "wordpresskit.%08x", Int.random(in: Int.min..<Int.max))
-        request.setValue("multipart/form-data; boundary=\(boundery)", forHTTPHeaderField: "Content-Type")
+        request.setValue("multipart/form-data; boundary=\(multipartFormBoundary)", forHTTPHeaderField: "Content-Type")
         return try multipartForm
-            .multipartFormDataStream(boundary: boundery, forceWriteToFile: forceWriteToFile)
+            .multipartFormDataStream(boundary: multipartFormBoundary, forceWriteToFile: forceWriteToFile)
+    }
+
+    /// Returns the provider of the body streams of the multipart form, if the form is streamed by
+    /// `encodeMultipartForm(request:forceWriteToFile:bodyStreams:)`.
+    func multipartFormBodyStreams() -> HTTPBodyStreamProvider? {
+        guard let multipartForm, multipartForm.contains(where: { $0.isFile }) else {
+            return nil
+        }
+        let boundary = multipartFormBoundary
+        return HTTPBodyStreamProvider { multipartForm.multipartFormInputStream(boundary: boundary) }
     }
 
     func encodeXMLRPC(request: inout URLRequest, forceWriteToFile: Bool) throws -> Either<Data, URL>? {
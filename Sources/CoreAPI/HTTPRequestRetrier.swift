@@ -0,0 +1,348 @@
+import Foundation
+import Combine
+
+/// Describes whether and when a failed HTTP request is sent again.
+///
+/// Requests are retried when they fail with a transient connection error, a retryable HTTP status code (i.e. 503), or
+/// a throttling response. The delay between retries grows exponentially, with random jitter, unless the server asks
+/// for a specific delay using the `Retry-After` header.
+public struct HTTPRetryPolicy {
+    /// The maximum number of times a request is retried. Zero disables retries.
+    public var maxRetries: Int
+
+    /// The delay before the first retry, which is doubled on every subsequent retry.
+    public var baseDelay: TimeInterval
+
+    /// The maximum delay between retries, when the server doesn't specify one.
+    public var maxDelay: TimeInterval
+
+    /// The maximum delay that's honored when the server asks the client to wait, using the `Retry-After` header or a
+    /// throttling response. Responses that ask for a longer delay are returned without being retried.
+    public var maxRetryAfter: TimeInterval
+
+    /// The HTTP status codes that are considered transient.
+    public var retryableStatusCodes: Set<Int>
+
+    /// The connection errors that are considered transient.
+    public var retryableURLErrorCodes: Set<URLError.Code>
+
+    /// Whether non-idempotent requests, i.e. POST, are retried. Only enable it for requests that are safe to be sent
+    /// more than once.
+    public var retriesNonIdempotentRequests: Bool
+
+    /// The maximum number of retries that can be made in a burst, among all requests that share the same
+    /// `HTTPRequestRetrier`. Each retry spends one from the budget, and each successful request refills a tenth.
+    ///
+    /// The budget stops a server outage from multiplying the number of requests that are sent to the server.
+    public var retryBudget: Int
+
+    public init(
+        maxRetries: Int = 2,
+        baseDelay: TimeInterval = 0.5,
+        maxDelay: TimeInterval = 10,
+        maxRetryAfter: TimeInterval = 30,
+        retryableStatusCodes: Set<Int> = [408, 429, 500, 502, 503, 504],
+        retryableURLErrorCodes: Set<URLError.Code> = [.timedOut, .networkConnectionLost, .cannotConnectToHost, .dnsLookupFailed],
+        retriesNonIdempotentRequests: Bool = false,
+        retryBudget: Int = 10
+    ) {
+        self.maxRetries = maxRetries
+        self.baseDelay = baseDelay
+        self.maxDelay = maxDelay
+        self.maxRetryAfter = maxRetryAfter
+        self.retryableStatusCodes = retryableStatusCodes
+        self.retryableURLErrorCodes = retryableURLErrorCodes
+        self.retriesNonIdempotentRequests = retriesNonIdempotentRequests
+        self.retryBudget = retryBudget
+    }
+
+    /// A policy that never retries.
+    public static let none = HTTPRetryPolicy(maxRetries: 0)
+
+    /// A policy that retries idempotent requests twice.
+    public static let `default` = HTTPRetryPolicy()
+
+    /// Returns a copy of the policy that retries non-idempotent requests, for the requests that are safe to be sent
+    /// more than once.
+    public func retryingNonIdempotentRequests() -> Self {
+        var policy = self
+        policy.retriesNonIdempotentRequests = true
+        return policy
+    }
+}
+
+/// Retries failed HTTP requests according to a `HTTPRetryPolicy`, and keeps track of the retry budget and statistics
+/// of all requests that are sent through it.
+public final class HTTPRequestRetrier {
+
+    public struct Statistics {
+        /// The number of retries that are made.
+        public var retries: Int = 0
+        /// The total time that's spent waiting before retries.
+        public var totalDelay: TimeInterval = 0
+        /// The number of retries that are not made, because the retry budget is used up.
+        public var exhaustedBudget: Int = 0
+    }
+
+    private let lock = NSLock()
+    private var _policy: HTTPRetryPolicy
+    private var _statistics = Statistics()
+    private var budget: Double?
+
+    // Returns the minimum delay before retrying, if the response indicates that the client is being throttled.
+    private let throttlingDelay: (HTTPURLResponse, Data) -> TimeInterval?
+
+    /// - Parameters:
+    ///   - policy: The policy that's used when requests don't specify their own.
+    ///   - throttlingDelay: Returns the minimum delay before retrying a throttling response, or `nil` if the response
+    ///         is not a throttling response.
+    init(policy: HTTPRetryPolicy = .none, throttlingDelay: @escaping (HTTPURLResponse, Data) -> TimeInterval? = { _, _ in nil }) {
+        self._policy = policy
+        self.throttlingDelay = throttlingDelay
+    }
+
+    /// The policy that's used when requests don't specify their own.
+    public var policy: HTTPRetryPolicy {
+        get {
+            lock.lock()
+            defer { lock.unlock() }
+            return _policy
+        }
+        set {
+            lock.lock()
+            _policy = newValue
+            lock.unlock()
+        }
+    }
+
+    public var statistics: Statistics {
+        lock.lock()
+        defer { lock.unlock() }
+        return _statistics
+    }
+
+    /// Perform the request, and retry it according to the policy when it fails.
+    ///
+    /// - Parameters:
+    ///   - method: The request's HTTP method, which is used to determine whether the request is idempotent.
+    ///   - policy: The policy for this request. The retrier's `policy` is used if it's `nil`.
+    ///   - progress: The caller's progress. It has the same requirements as the `URLSession.perform` function's, and
+    ///         tracks the progress of the current attempt.
+    ///   - attempt: Sends the request once. The `Progress` argument must be used to track and cancel the request.
+    func perform<E: LocalizedError>(
+        method: HTTPRequestBuilder.Method,
+        policy requestPolicy: HTTPRetryPolicy? = nil,
+        fulfilling progress: Progress?,
+        attempt: @escaping (Progress?) async -> WordPressAPIResult<HTTPAPIResponse<Data>, E>
+    ) async -> WordPressAPIResult<HTTPAPIResponse<Data>, E> {
+        let policy = requestPolicy ?? self.policy
+        guard policy.maxRetries > 0 else {
+            return await attempt(progress)
+        }
+
+        let state = RetryState()
+        progress?.cancellationHandler = { state.cancel() }
+
+        var retries = 0
+        while true {
+            let attemptProgress = progress.map { _ in Progress.discreteProgress(totalUnitCount: 100) }
+            if let progress, let attemptProgress {
+                await state.track(attemptProgress, in: progress)
+            }
+
+            guard state.begin(attemptProgress) else {
+                return .failure(.connection(URLError(.cancelled)))
+            }
+
+            let result = await attempt(attemptProgress)
+
+            guard !state.isCancelled, !Task.isCancelled,
+                  let delay = retryDelay(for: result, method: method, retries: retries, policy: policy)
+            else {
+                if case .success = result {
+                    refillBudget(policy: policy)
+                }
+                return result
+            }
+
+            guard spendBudget(delay: delay, policy: policy) else {
+                return result
+            }
+
+            retries += 1
+            guard await state.sleep(seconds: delay) else {
+                return .failure(.connection(URLError(.cancelled)))
+            }
+        }
+    }
+
+    // MARK: - Retry decision
+
+    private func retryDelay<E>(
+        for result: WordPressAPIResult<HTTPAPIResponse<Data>, E>,
+        method: HTTPRequestBuilder.Method,
+        retries: Int,
+        policy: HTTPRetryPolicy
+    ) -> TimeInterval? {
+        guard retries < policy.maxRetries, method.isIdempotent || policy.retriesNonIdempotentRequests else {
+            return nil
+        }
+
+        switch result {
+        case let .success(response):
+            return retryDelay(for: response.response, body: response.body, retries: retries, policy: policy)
+        case let .failure(.unacceptableStatusCode(response, body)):
+            return retryDelay(for: response, body: body, retries: retries, policy: policy)
+        case let .failure(.connection(error)):
+            return policy.retryableURLErrorCodes.contains(error.code) ? backoff(retries: retries, policy: policy) : nil
+        default:
+            return nil
+        }
+    }
+
+    private func retryDelay(for response: HTTPURLResponse, body: Data, retries: Int, policy: HTTPRetryPolicy) -> TimeInterval? {
+        // Only error responses can be throttling responses. The body of successful responses isn't inspected.
+        let throttlingDelay = (200..<300).contains(response.statusCode) ? nil : self.throttlingDelay(response, body)
+        guard throttlingDelay != nil || policy.retryableStatusCodes.contains(response.statusCode) else {
+            return nil
+        }
+
+        let requestedDelays = [throttlingDelay, Self.retryAfter(in: response)].compactMap { $0 }
+        guard let requestedDelay = requestedDelays.max() else {
+            return backoff(retries: retries, policy: policy)
+        }
+
+        return requestedDelay <= policy.maxRetryAfter ? requestedDelay : nil
+    }
+
+    /// Exponential backoff with "equal jitter": half of the delay is fixed, the other half is random.
+    private func backoff(retries: Int, policy: HTTPRetryPolicy) -> TimeInterval {
+        let delay = min(policy.maxDelay, policy.baseDelay * pow(2, Double(retries)))
+        return delay / 2 + Double.random(in: 0...(delay / 2))
+    }
+
+    private static let httpDateFormatter: DateFormatter = {
+        let formatter = DateFormatter()
+        formatter.locale = Locale(identifier: "en_US_POSIX")
+        formatter.timeZone = TimeZone(identifier: "GMT")
+        formatter.dateFormat = "EEE',' dd MMM yyyy HH':'mm':'ss zzz"
+        return formatter
+    }()
+
+    /// Parse the `Retry-After` header, which is either a number of seconds or an HTTP date.
+    static func retryAfter(in response: HTTPURLResponse, now: Date = Date()) -> TimeInterval? {
+        guard let value = response.value(forHTTPHeaderField: "Retry-After")?.trimmingCharacters(in: .whitespaces) else {
+            return nil
+        }
+
+        if let seconds = TimeInterval(value) {
+            return max(0, seconds)
+        }
+
+        return httpDateFormatter.date(from: value).map { max(0, $0.timeIntervalSince(now)) }
+    }
+
+    // MARK: - Budget
+
+    private func spendBudget(delay: TimeInterval, policy: HTTPRetryPolicy) -> Bool {
+        lock.lock()
+        defer { lock.unlock() }
+
+        let available = min(budget ?? Double(policy.retryBudget), Double(policy.retryBudget))
+        guard available >= 1 else {
+            budget = available
+            _statistics.exhaustedBudget += 1
+            return false
+        }
+
+        budget = available - 1
+        _statistics.retries += 1
+        _statistics.totalDelay += delay
+        return true
+    }
+
+    private func refillBudget(policy: HTTPRetryPolicy) {
+        lock.lock()
+        defer { lock.unlock() }
+
+        if let budget {
+            self.budget = min(Double(policy.retryBudget), budget + 0.1)
+        }
+    }
+}
+
+/// The cancellation state of a request that may be retried.
+private final class RetryState {
+    private let lock = NSLock()
+    private var attemptProgress: Progress?
+    private var sleepTask: Task<Void, Error>?
+    private var progressUpdator: AnyCancellable?
+    private var cancelled = false
+
+    var isCancelled: Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        return cancelled
+    }
+
+    func cancel() {
+        lock.lock()
+        cancelled = true
+        let progress = attemptProgress
+        let sleepTask = sleepTask
+        lock.unlock()
+
+        progress?.cancel()
+        sleepTask?.cancel()
+    }
+
+    /// Make the caller's progress track the given attempt's progress, from zero.
+    @MainActor
+    func track(_ attemptProgress: Progress, in progress: Progress) {
+        progressUpdator?.cancel()
+        progress.completedUnitCount = 0
+        // The Jetpack/WordPress app requires task progress updates to be delievered on the main queue.
+        progressUpdator = progress.update(totalUnit: progress.totalUnitCount, with: attemptProgress, queue: .main)
+    }
+
+    /// Returns false if the request is cancelled.
+    func begin(_ progress: Progress?) -> Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        attemptProgress = progress
+        return !cancelled
+    }
+
+    /// Returns false if the request is cancelled.
+    func sleep(seconds: TimeInterval) async -> Bool {
+        let task = Task<Void, Error> {
+            try await Task.sleep(nanoseconds: UInt64(seconds * 1_000_000_000))
+        }
+
+        lock.lock()
+        sleepTask = task
+        let cancelled = self.cancelled
+        lock.unlock()
+
+        if cancelled {
+            task.cancel()
+        }
+
+        do {
+            try await withTaskCancellationHandler {
+                try await task.value
+            } onCancel: {
+                task.cancel()
+            }
+            return !isCancelled
+        } catch {
+            return false
+        }
+    }
+}
+
+private extension HTTPRequestBuilder.Method {
+    var isIdempotent: Bool {
+        self != .post && self != .patch
+    }
+}
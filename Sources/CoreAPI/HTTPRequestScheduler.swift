@@ -0,0 +1,210 @@
+#if SWIFT_PACKAGE
+import APIInterface
+#endif
+import Foundation
+
+extension HTTPRequestPriority: Comparable {
+    public static func < (lhs: HTTPRequestPriority, rhs: HTTPRequestPriority) -> Bool {
+        lhs.rawValue < rhs.rawValue
+    }
+}
+
+/// Limits the number of in-flight requests per host, and sends the queued requests in the order of their priority.
+///
+/// Requests are sent right away while their host has fewer than `maxConcurrentRequestsPerHost` requests in flight.
+/// Otherwise, they are queued until one of the in-flight requests finishes. Queued requests of a higher priority are
+/// sent first, and requests of the same priority are sent in the order they were scheduled.
+///
+/// One scheduler can be shared among multiple API instances, so that their requests are ordered together.
+public final class HTTPRequestScheduler {
+
+    public struct Statistics {
+        /// The number of requests that are sent.
+        public var performed: Int = 0
+        /// The number of requests that had to wait in the queue before being sent.
+        public var queued: Int = 0
+        /// The number of queued requests whose priority is raised, because a caller of a higher priority is waiting for them.
+        public var promoted: Int = 0
+        /// The total time that's spent by requests waiting in the queue.
+        public var totalQueueTime: TimeInterval = 0
+        /// The total time that's spent by requests after they leave the queue, until they finish.
+        public var totalNetworkTime: TimeInterval = 0
+    }
+
+    private final class Entry {
+        let request: URLRequest
+        let host: String
+        let sequence: Int
+        var priority: HTTPRequestPriority
+        var resume: ((Bool) -> Void)?
+
+        init(request: URLRequest, host: String, sequence: Int, priority: HTTPRequestPriority) {
+            self.request = request
+            self.host = host
+            self.sequence = sequence
+            self.priority = priority
+        }
+    }
+
+    /// The maximum number of requests that are in flight at the same time for each host.
+    public let maxConcurrentRequestsPerHost: Int
+
+    private let lock = NSLock()
+    private var inFlight = [String: Int]()
+    private var queue = [Entry]()
+    private var nextSequence = 0
+    private var _statistics = Statistics()
+
+    public init(maxConcurrentRequestsPerHost: Int = 4) {
+        assert(maxConcurrentRequestsPerHost > 0, "Invalid concurrency limit")
+        self.maxConcurrentRequestsPerHost = max(1, maxConcurrentRequestsPerHost)
+    }
+
+    public var statistics: Statistics {
+        lock.lock()
+        defer { lock.unlock() }
+        return _statistics
+    }
+
+    /// Wait for the request's turn, and then send it.
+    ///
+    /// - Parameters:
+    ///   - request: The request to be sent, which determines its host.
+    ///   - priority: The priority of the request.
+    ///   - progress: The request's progress, which can be cancelled to take the request out of the queue. It has the
+    ///         same requirements as the `URLSession.perform` function's, and it's passed to the `operation` unchanged.
+    ///   - cancelled: Returns the result that's returned when the request is cancelled while it's queued.
+    ///   - operation: Sends the request.
+    func perform<Response>(
+        _ request: URLRequest,
+        priority: HTTPRequestPriority,
+        fulfilling progress: Progress?,
+        cancelled: () -> Response,
+        operation: (Progress?) async -> Response
+    ) async -> Response {
+        let host = request.url?.host ?? ""
+        let start = Date()
+
+        guard await enqueue(request, host: host, priority: priority, cancelledBy: progress) else {
+            return cancelled()
+        }
+
+        let sent = Date()
+        lock.lock()
+        _statistics.performed += 1
+        lock.unlock()
+
+        let response = await operation(progress)
+        finish(host: host, queueTime: sent.timeIntervalSince(start), networkTime: Date().timeIntervalSince(sent))
+        return response
+    }
+
+    /// Raise the priority of the queued requests that are identical to the given request, because a caller of the given
+    /// priority is waiting for them.
+    func promote(_ request: URLRequest, to priority: HTTPRequestPriority) {
+        lock.lock()
+        defer { lock.unlock() }
+
+        for entry in queue where entry.priority < priority && entry.request == request {
+            entry.priority = priority
+            _statistics.promoted += 1
+        }
+    }
+
+    /// Returns false if the request is cancelled while it's queued.
+    private func enqueue(_ request: URLRequest, host: String, priority: HTTPRequestPriority, cancelledBy progress: Progress?) async -> Bool {
+        lock.lock()
+        if inFlight[host, default: 0] < maxConcurrentRequestsPerHost {
+            inFlight[host, default: 0] += 1
+            lock.unlock()
+            return true
+        }
+
+        let entry = Entry(request: request, host: host, sequence: nextSequence, priority: priority)
+        nextSequence += 1
+        lock.unlock()
+
+        let started = await withTaskCancellationHandler {
+            await withCheckedContinuation { continuation in
+                lock.lock()
+                // A slot may have been freed since the capacity was checked above. `finish` doesn't see this entry
+                // until it's in the queue, so the capacity is checked again in the same lock hold as the append.
+                if inFlight[host, default: 0] < maxConcurrentRequestsPerHost {
+                    inFlight[host, default: 0] += 1
+                    lock.unlock()
+                    continuation.resume(returning: true)
+                    return
+                }
+                entry.resume = { continuation.resume(returning: $0) }
+                queue.append(entry)
+                _statistics.queued += 1
+                lock.unlock()
+
+                progress?.cancellationHandler = { [weak self] in
+                    self?.dequeue(entry)
+                }
+                if progress?.isCancelled == true || Task.isCancelled {
+                    dequeue(entry)
+                }
+            }
+        } onCancel: {
+            dequeue(entry)
+        }
+
+        progress?.cancellationHandler = nil
+
+        // The progress may be cancelled after the request leaves the queue, but before its cancellation handler is reset.
+        if started, progress?.isCancelled == true {
+            finish(host: host, queueTime: 0, networkTime: 0)
+            return false
+        }
+
+        return started
+    }
+
+    /// Take the entry out of the queue, because its request is cancelled.
+    private func dequeue(_ entry: Entry) {
+        lock.lock()
+        guard let index = queue.firstIndex(where: { $0 === entry }) else {
+            lock.unlock()
+            return
+        }
+        queue.remove(at: index)
+        let resume = entry.resume
+        entry.resume = nil
+        lock.unlock()
+
+        resume?(false)
+    }
+
+    /// Free the request's slot, and send the next queued request of the same host.
+    private func finish(host: String, queueTime: TimeInterval, networkTime: TimeInterval) {
+        lock.lock()
+        _statistics.totalQueueTime += queueTime
+        _statistics.totalNetworkTime += networkTime
+
+        let next = queue.indices
+            .filter { queue[$0].host == host }
+            .max { lhs, rhs in
+                let (lhs, rhs) = (queue[lhs], queue[rhs])
+                return lhs.priority != rhs.priority ? lhs.priority < rhs.priority : lhs.sequence > rhs.sequence
+            }
+
+        let resume: ((Bool) -> Void)?
+        if let next {
+            // The slot is handed over to the next request.
+            let entry = queue.remove(at: next)
+            resume = entry.resume
+            entry.resume = nil
+        } else {
+            inFlight[host, default: 1] -= 1
+            if inFlight[host] == 0 {
+                inFlight.removeValue(forKey: host)
+            }
+            resume = nil
+        }
+        lock.unlock()
+
+        resume?(true)
+    }
+}
@@ -0,0 +1,397 @@
+import Foundation
+import CryptoKit
+
+/// A cache of HTTP responses that uses conditional requests to revalidate its content.
+///
+/// The cache records the `ETag` and `Last-Modified` validators of successful `GET` responses. When the same request is
+/// sent again, the validators are sent along as `If-None-Match` and `If-Modified-Since` headers. If the server responds
+/// with "304 Not Modified", the cached response is returned instead, which means a large response doesn't need to be
+/// downloaded again.
+///
+/// Responses are kept in memory, up to `memoryCapacity` bytes, using a least-recently-used eviction policy. The values
+/// that are decoded from the responses count against the same capacity, using an estimate of their size. They are
+/// also written to disk when a `directory` is provided, so that they can be revalidated across app launches. The disk
+/// copies are limited to `diskCapacity` bytes, and the least recently used ones are removed first. They're written with
+/// complete file protection, and without the headers that carry credentials, like `Set-Cookie`.
+///
+/// Caching is opt-in: only requests that match the `isCacheable` predicate are cached.
+///
+/// - Warning: Since requests credentials are not part of the cache key, a cache instance must not be shared among API
+///     instances of different accounts. The responses on disk, which may contain the account's private content,
+///     survive logging out, unless `removeAll()` is called.
+public final class HTTPResponseCache {
+
+    struct Entry: Codable {
+        var url: URL
+        var statusCode: Int
+        var headers: [String: String]
+        var body: Data
+        var etag: String?
+        var lastModified: String?
+
+        var response: HTTPURLResponse? {
+            HTTPURLResponse(url: url, statusCode: statusCode, httpVersion: nil, headerFields: headers)
+        }
+    }
+
+    /// The cached response of a request, which is looked up before the request is sent.
+    struct Lookup {
+        fileprivate var key: String
+        fileprivate var entry: Entry?
+    }
+
+    // A node of the least-recently-used list, which is ordered from the most recently used node to the least.
+    private final class Node {
+        let key: String
+        var entry: Entry
+        // Decoded responses, keyed by the decoded type.
+        var decoded: [ObjectIdentifier: Any] = [:]
+        // The bytes of the body, and the estimated bytes of the decoded responses.
+        var cost: Int
+        weak var previous: Node?
+        var next: Node?
+
+        init(key: String, entry: Entry) {
+            self.key = key
+            self.entry = entry
+            self.cost = entry.body.count
+        }
+    }
+
+    /// The maximum number of bytes of the response bodies, and of the values decoded from them, that are kept in memory.
+    public let memoryCapacity: Int
+
+    /// The directory where the responses are saved to. `nil` if the cache is in-memory only.
+    public let directory: URL?
+
+    /// The maximum number of bytes of the responses that are saved to `directory`.
+    public let diskCapacity: Int
+
+    // The headers that aren't cached, because they carry credentials.
+    private static let excludedHeaders: Set<String> = [
+        "set-cookie", "set-cookie2", "authorization", "proxy-authorization", "www-authenticate", "proxy-authenticate"
+    ]
+
+    // The estimated size of a decoded response, relative to the size of its body. The Foundation objects and models
+    // that are decoded from JSON usually take more memory than the JSON itself.
+    private static let decodedCostFactor = 2
+
+    private let isCacheable: (URLRequest) -> Bool
+
+    private let lock = NSLock()
+    private var nodes: [String: Node] = [:]
+    private var mostRecentlyUsed: Node?
+    private var leastRecentlyUsed: Node?
+    private var memoryUsage = 0
+    // Shared among all instances, so that the disk operations of caches that use the same directory are serialized.
+    private static let diskQueue = DispatchQueue(label: "org.wordpress.wordpresskit.http-response-cache")
+    private var diskQueue: DispatchQueue { Self.diskQueue }
+
+    /// Create a response cache.
+    ///
+    /// - Parameters:
+    ///   - memoryCapacity: The maximum number of bytes of the response bodies, and of the values decoded from them,
+    ///         that are kept in memory.
+    ///   - directory: The directory where the responses are saved to. Pass `nil` to only keep responses in memory.
+    ///   - diskCapacity: The maximum number of bytes of the responses that are saved to `directory`.
+    ///   - isCacheable: Returns whether the given request's response should be cached. Use it to opt in endpoints
+    ///         that return large responses that rarely change.
+    public init(
+        memoryCapacity: Int = 10_000_000,
+        directory: URL? = nil,
+        diskCapacity: Int = 50_000_000,
+        isCacheable: @escaping (URLRequest) -> Bool
+    ) {
+        self.memoryCapacity = memoryCapacity
+        self.directory = directory
+        self.diskCapacity = diskCapacity
+        self.isCacheable = isCacheable
+    }
+
+    /// Remove all cached responses, both from memory and disk.
+    ///
+    /// Call it when the user logs out, so that their responses don't stay on disk.
+    public func removeAll() {
+        lock.lock()
+        nodes.removeAll()
+        mostRecentlyUsed = nil
+        leastRecentlyUsed = nil
+        memoryUsage = 0
+        lock.unlock()
+
+        if let directory {
+            diskQueue.async {
+                try? FileManager.default.removeItem(at: directory)
+            }
+        }
+    }
+
+    // MARK: - Conditional requests
+
+    /// Look up the cached response of the given request. It's nil if the request can't be cached.
+    ///
+    /// A response that isn't in memory is read from disk on the disk queue, so the caller isn't blocked while it's read.
+    func lookUp(_ request: URLRequest) async -> Lookup? {
+        guard request.httpMethod == HTTPRequestBuilder.Method.get.rawValue,
+              let key = request.url?.absoluteString,
+              isCacheable(request)
+        else {
+            return nil
+        }
+
+        if let entry = memoryEntry(forKey: key) {
+            return Lookup(key: key, entry: entry)
+        }
+
+        guard let fileURL = fileURL(forKey: key) else {
+            return Lookup(key: key, entry: nil)
+        }
+
+        let data: Data? = await withCheckedContinuation { continuation in
+            diskQueue.async {
+                let data = try? Data(contentsOf: fileURL)
+                if data != nil {
+                    // The modification dates order the files from the least recently used, for `trimDisk(_:)`.
+                    try? FileManager.default.setAttributes([.modificationDate: Date()], ofItemAtPath: fileURL.path)
+                }
+                continuation.resume(returning: data)
+            }
+        }
+        guard let data, let entry = try? PropertyListDecoder().decode(Entry.self, from: data) else {
+            return Lookup(key: key, entry: nil)
+        }
+
+        insert(entry, forKey: key)
+        return Lookup(key: key, entry: entry)
+    }
+
+    /// Add validators of the looked up cached response to the given request, and return a completion handler that
+    /// replaces "304 Not Modified" responses with the cached response, and caches new responses.
+    ///
+    /// The original completion handler is returned as it is if the request can't be cached, i.e. there's no `lookup`.
+    func prepare(
+        _ request: inout URLRequest,
+        lookup: Lookup?,
+        completion: @escaping @Sendable (Data?, URLResponse?, Error?) -> Void
+    ) -> @Sendable (Data?, URLResponse?, Error?) -> Void {
+        guard let lookup else {
+            return completion
+        }
+
+        // Bypass `URLCache`, so that "304 Not Modified" responses are returned to us.
+        request.cachePolicy = .reloadIgnoringLocalCacheData
+
+        let key = lookup.key
+        let cached = lookup.entry
+        if let cached {
+            if let etag = cached.etag {
+                request.setValue(etag, forHTTPHeaderField: "If-None-Match")
+            }
+            if let lastModified = cached.lastModified {
+                request.setValue(lastModified, forHTTPHeaderField: "If-Modified-Since")
+            }
+        }
+
+        return { [weak self] data, response, error in
+            guard let self, error == nil, let httpResponse = response as? HTTPURLResponse else {
+                completion(data, response, error)
+                return
+            }
+
+            if httpResponse.statusCode == 304, let cached {
+                completion(cached.body, cached.response ?? httpResponse, nil)
+                return
+            }
+
+            if (200...299).contains(httpResponse.statusCode), let data {
+                self.store(response: httpResponse, body: data, forKey: key)
+            }
+
+            completion(data, response, nil)
+        }
+    }
+
+    /// Return the decoded value of a response body, reusing the value that was decoded from the same cached
+    /// response body before.
+    ///
+    /// The decoded value is kept as long as the response is, and its estimated size counts against `memoryCapacity`.
+    /// It's not kept if the response and its decoded values don't fit in the capacity together.
+    ///
+    /// - Note: The `decoder` must always decode the same response body into the same value.
+    func decoded<T>(_ body: Data, url: URL?, decoder: (Data) throws -> T) rethrows -> T {
+        guard let key = url?.absoluteString else {
+            return try decoder(body)
+        }
+
+        lock.lock()
+        let node = nodes[key]
+        let cachedValue = node?.entry.body == body ? node?.decoded[ObjectIdentifier(T.self)] as? T : nil
+        lock.unlock()
+
+        if let cachedValue {
+            return cachedValue
+        }
+
+        let value = try decoder(body)
+
+        lock.lock()
+        let cost = body.count * Self.decodedCostFactor
+        if let node, nodes[key] === node, node.entry.body == body, node.decoded[ObjectIdentifier(T.self)] == nil,
+           node.cost + cost <= memoryCapacity {
+            node.decoded[ObjectIdentifier(T.self)] = value
+            node.cost += cost
+            memoryUsage += cost
+            trimMemory()
+        }
+        lock.unlock()
+
+        return value
+    }
+
+    // MARK: - Storage
+
+    private func memoryEntry(forKey key: String) -> Entry? {
+        lock.lock()
+        defer { lock.unlock() }
+
+        guard let node = nodes[key] else {
+            return nil
+        }
+        unlink(node)
+        pushFront(node)
+        return node.entry
+    }
+
+    private func store(response: HTTPURLResponse, body: Data, forKey key: String) {
+        let etag = response.value(forHTTPHeaderField: "ETag")
+        let lastModified = response.value(forHTTPHeaderField: "Last-Modified")
+
+        // The cached response uses the request URL, which is used to look up decoded responses.
+        guard etag != nil || lastModified != nil, let url = URL(string: key) else {
+            remove(forKey: key)
+            return
+        }
+
+        var headers = [String: String]()
+        for (name, value) in response.allHeaderFields {
+            if let name = name as? String, let value = value as? String, !Self.excludedHeaders.contains(name.lowercased()) {
+                headers[name] = value
+            }
+        }
+
+        let entry = Entry(url: url, statusCode: response.statusCode, headers: headers, body: body, etag: etag, lastModified: lastModified)
+        insert(entry, forKey: key)
+
+        if let fileURL = fileURL(forKey: key), let directory {
+            let diskCapacity = self.diskCapacity
+            diskQueue.async {
+                guard let data = try? PropertyListEncoder().encode(entry), data.count <= diskCapacity else {
+                    try? FileManager.default.removeItem(at: fileURL)
+                    return
+                }
+                try? FileManager.default.createDirectory(at: directory, withIntermediateDirectories: true)
+                // The file can't be read while the device is locked. A response that can't be read isn't used.
+                try? data.write(to: fileURL, options: [.atomic, .completeFileProtection])
+                Self.trimDisk(directory, toCapacity: diskCapacity)
+            }
+        }
+    }
+
+    /// Remove the least recently used files in the directory, until their total size is within the capacity. It must
+    /// be called on the disk queue.
+    private static func trimDisk(_ directory: URL, toCapacity capacity: Int) {
+        let keys: Set<URLResourceKey> = [.fileSizeKey, .contentModificationDateKey]
+        guard let fileURLs = try? FileManager.default.contentsOfDirectory(at: directory, includingPropertiesForKeys: Array(keys)) else {
+            return
+        }
+
+        var files = fileURLs.compactMap { url -> (url: URL, size: Int, date: Date)? in
+            guard let values = try? url.resourceValues(forKeys: keys) else { return nil }
+            return (url, values.fileSize ?? 0, values.contentModificationDate ?? .distantPast)
+        }
+        var usage = files.reduce(0) { $0 + $1.size }
+        guard usage > capacity else {
+            return
+        }
+
+        files.sort { $0.date < $1.date }
+        for file in files where usage > capacity {
+            try? FileManager.default.removeItem(at: file.url)
+            usage -= file.size
+        }
+    }
+
+    private func insert(_ entry: Entry, forKey key: String) {
+        lock.lock()
+        defer { lock.unlock() }
+
+        removeNode(forKey: key)
+
+        guard entry.body.count <= memoryCapacity else {
+            return
+        }
+
+        let node = Node(key: key, entry: entry)
+        nodes[key] = node
+        pushFront(node)
+        memoryUsage += node.cost
+        trimMemory()
+    }
+
+    private func remove(forKey key: String) {
+        lock.lock()
+        removeNode(forKey: key)
+        lock.unlock()
+
+        if let fileURL = fileURL(forKey: key) {
+            diskQueue.async {
+                try? FileManager.default.removeItem(at: fileURL)
+            }
+        }
+    }
+
+    // MARK: - Least-recently-used list. The lock must be held.
+
+    private func removeNode(forKey key: String) {
+        guard let node = nodes.removeValue(forKey: key) else {
+            return
+        }
+        unlink(node)
+        memoryUsage -= node.cost
+    }
+
+    private func trimMemory() {
+        while memoryUsage > memoryCapacity, let leastRecentlyUsed {
+            removeNode(forKey: leastRecentlyUsed.key)
+        }
+    }
+
+    private func pushFront(_ node: Node) {
+        node.next = mostRecentlyUsed
+        mostRecentlyUsed?.previous = node
+        mostRecentlyUsed = node
+        if leastRecentlyUsed == nil {
+            leastRecentlyUsed = node
+        }
+    }
+
+    private func unlink(_ node: Node) {
+        if mostRecentlyUsed === node {
+            mostRecentlyUsed = node.next
+        }
+        if leastRecentlyUsed === node {
+            leastRecentlyUsed = node.previous
+        }
+        node.previous?.next = node.next
+        node.next?.previous = node.previous
+        node.previous = nil
+        node.next = nil
+    }
+
+    private func fileURL(forKey key: String) -> URL? {
+        guard let directory else { return nil }
+
+        let name = SHA256.hash(data: Data(key.utf8)).map { String(format: "%02x", $0) }.joined()
+        return directory.appendingPathComponent(name)
+    }
+}
@@ -0,0 +1,136 @@
+import Foundation
+import Combine
+
+/// Shares one in-flight HTTP request among all identical requests that are sent while it's still in progress.
+///
+/// Requests are considered identical when their final `URLRequest` and the type they're decoded into are equal. The
+/// first caller sends the request and decodes its response. Any caller that arrives before that finishes receives
+/// the same result, instead of sending another request.
+///
+/// Each caller can still cancel its own request using its `Progress` instance. The shared request is only cancelled
+/// when all of its callers have cancelled theirs.
+///
+/// - Note: Only idempotent requests, i.e. `GET`, should be coalesced.
+public final class InFlightRequestCoalescer {
+
+    public struct Statistics {
+        /// The number of requests that are sent to the server.
+        public var performed: Int = 0
+        /// The number of requests that are not sent to the server, because they reused an in-flight request's result.
+        public var coalesced: Int = 0
+    }
+
+    private struct Key: Hashable {
+        var request: URLRequest
+        var resultType: ObjectIdentifier
+    }
+
+    private final class Entry {
+        let progress = Progress.discreteProgress(totalUnitCount: 100)
+        var waiters: [Int: (Any) -> Void] = [:]
+        var progressUpdators: [Int: AnyCancellable] = [:]
+        var nextWaiterID = 0
+    }
+
+    private let lock = NSLock()
+    private var entries: [Key: Entry] = [:]
+    private var _statistics = Statistics()
+
+    public init() {}
+
+    public var statistics: Statistics {
+        lock.lock()
+        defer { lock.unlock() }
+        return _statistics
+    }
+
+    /// Return the result of the given request, sharing it with other identical requests that are in flight.
+    ///
+    /// - Parameters:
+    ///   - request: The request that's used to identify identical requests.
+    ///   - progress: The caller's progress, which is updated with the shared request's progress and can be used to
+    ///         cancel the caller's request. It has the same requirements as the `URLSession.perform` function's.
+    ///   - cancelled: Returns the result that's returned to the caller when it cancels its request.
+    ///   - operation: Sends the request and decodes its response. It's only called when there is no identical
+    ///         request in flight. The `Progress` argument must be used to track and cancel the request.
+    func perform<Response>(
+        _ request: URLRequest,
+        fulfilling progress: Progress?,
+        cancelled: @escaping () -> Response,
+        operation: @escaping (Progress) async -> Response
+    ) async -> Response {
+        let key = Key(request: request, resultType: ObjectIdentifier(Response.self))
+
+        return await withCheckedContinuation { continuation in
+            lock.lock()
+            let entry: Entry
+            let isNew: Bool
+            if let existing = entries[key] {
+                entry = existing
+                isNew = false
+                _statistics.coalesced += 1
+            } else {
+                entry = Entry()
+                entries[key] = entry
+                isNew = true
+                _statistics.performed += 1
+            }
+
+            let waiterID = entry.nextWaiterID
+            entry.nextWaiterID += 1
+            entry.waiters[waiterID] = { continuation.resume(returning: $0 as! Response) }
+            if let progress {
+                // The Jetpack/WordPress app requires task progress updates to be delievered on the main queue.
+                entry.progressUpdators[waiterID] = progress.update(totalUnit: progress.totalUnitCount, with: entry.progress, queue: .main)
+            }
+            lock.unlock()
+
+            progress?.cancellationHandler = { [weak self] in
+                self?.cancel(waiterID: waiterID, of: entry, key: key, result: cancelled())
+            }
+
+            if isNew {
+                Task {
+                    let result = await operation(entry.progress)
+                    self.complete(entry, key: key, result: result)
+                }
+            }
+        }
+    }
+
+    private func complete(_ entry: Entry, key: Key, result: Any) {
+        lock.lock()
+        if entries[key] === entry {
+            entries.removeValue(forKey: key)
+        }
+        let waiters = entry.waiters
+        entry.waiters = [:]
+        lock.unlock()
+
+        for waiter in waiters.values {
+            waiter(result)
+        }
+    }
+
+    private func cancel(waiterID: Int, of entry: Entry, key: Key, result: Any) {
+        lock.lock()
+        guard let waiter = entry.waiters.removeValue(forKey: waiterID) else {
+            lock.unlock()
+            return
+        }
+        entry.progressUpdators.removeValue(forKey: waiterID)
+
+        // Cancel the shared request once no one is waiting for it. Also stop any new callers from joining it.
+        let cancelsRequest = entry.waiters.isEmpty
+        if cancelsRequest, entries[key] === entry {
+            entries.removeValue(forKey: key)
+        }
+        lock.unlock()
+
+        waiter(result)
+
+        if cancelsRequest {
+            entry.progress.cancel()
+        }
+    }
+}
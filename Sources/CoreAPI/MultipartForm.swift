@@ -1,7 +1,9 @@
 import Foundation
+import CryptoKit
 
 enum MultipartFormError: Swift.Error {
     case inaccessbileFile(path: String)
+    case missingBodyStreams
     case impossible
 }
 
@@ -10,28 +12,45 @@ struct MultipartFormField {
     let filename: String?
     let mimeType: String?
     let bytes: UInt64
+    /// Whether the field's content is read from a file.
+    let isFile: Bool
+    /// Called with the SHA-256 hash of the field's content, as a lowercase hexadecimal string, each time the content
+    /// is entirely read by a `MultipartFormInputStream`.
+    let contentHashHandler: ((String) -> Void)?
 
-    fileprivate let inputStream: InputStream
+    /// Creates a new stream of the field's content. The stream is only created (and opened) when the content is read,
+    /// so that a form can be encoded any number of times and file handles aren't held before they're needed.
+    fileprivate let makeInputStream: () -> InputStream?
 
     init(text: String, name: String, filename: String? = nil, mimeType: String? = nil) {
         self.init(data: text.data(using: .utf8)!, name: name, filename: filename, mimeType: mimeType)
     }
 
     init(data: Data, name: String, filename: String? = nil, mimeType: String? = nil) {
-        self.inputStream = InputStream(data: data)
+        self.makeInputStream = { InputStream(data: data) }
+        self.isFile = false
+        self.contentHashHandler = nil
         self.name = name
         self.filename = filename
         self.bytes = UInt64(data.count)
         self.mimeType = mimeType
     }
 
-    init(fileAtPath path: String, name: String, filename: String? = nil, mimeType: String? = nil) throws {
-        guard let inputStream = InputStream(fileAtPath: path),
+    init(
+        fileAtPath path: String,
+        name: String,
+        filename: String? = nil,
+        mimeType: String? = nil,
+        contentHashHandler: ((String) -> Void)? = nil
+    ) throws {
+        guard FileManager.default.isReadableFile(atPath: path),
               let attrs = try? FileManager.default.attributesOfItem(atPath: path),
               let bytes = (attrs[FileAttributeKey.size] as? NSNumber)?.uint64Value else {
             throw MultipartFormError.inaccessbileFile(path: path)
         }
-        self.inputStream = inputStream
+        self.makeInputStream = { InputStream(fileAtPath: path) }
+        self.isFile = true
+        self.contentHashHandler = contentHashHandler
         self.name = name
         self.filename = filename ?? path.split(separator: "/").last.flatMap({ String($0) })
         self.bytes = bytes
@@ -62,6 +81,55 @@ extension Array where Element == MultipartFormField {
         return (dest, tempFilePath)
     }
 
+    /// Returns a stream of the encoded form, without copying any of the fields' content.
+    ///
+    /// The boundaries and headers are joined with the fields' content while the returned stream is being read, and
+    /// each field's content is only opened when the stream reaches it. The `contentLength` of the returned stream is
+    /// exact, which means the form can be sent with a `Content-Length` header.
+    ///
+    /// The stream can only be read synchronously. Use its `boundInputStream()` as a `URLRequest.httpBodyStream`.
+    func multipartFormInputStream(boundary: String) -> MultipartFormInputStream {
+        guard !isEmpty else {
+            return MultipartFormInputStream(segments: [])
+        }
+
+        var segments = [MultipartFormInputStream.Segment]()
+        var pending = Data()
+
+        for field in self {
+            pending.appendMultipartForm(boundary: boundary, isEnd: false)
+
+            var disposition = ["form-data", "name=\"\(field.name)\""]
+            if let filename = field.filename {
+                disposition += ["filename=\"\(filename)\""]
+            }
+            pending.appendMultipartFormHeader(name: "Content-Disposition", value: disposition.joined(separator: "; "))
+
+            if let mimeType = field.mimeType {
+                pending.appendMultipartFormHeader(name: "Content-Type", value: mimeType)
+            }
+
+            // A linebreak between header and content
+            pending.appendMultipartFormLineBreak()
+
+            segments.append(.data(pending))
+            segments.append(.field(field))
+
+            pending = Data()
+            pending.appendMultipartFormLineBreak()
+        }
+
+        pending.appendMultipartForm(boundary: boundary, isEnd: true)
+        segments.append(.data(pending))
+
+        return MultipartFormInputStream(segments: segments)
+    }
+
+    /// Write the encoded form into memory or a temporary file.
+    ///
+    /// Prefer streaming the form from `multipartFormInputStream(boundary:)` where possible. This function is only
+    /// needed by background `URLSession`, which can only upload request body from a file, and for small forms, which
+    /// are cheaper to send from memory.
     func multipartFormDataStream(boundary: String, forceWriteToFile: Bool = false) throws -> Either<Data, URL> {
         guard !isEmpty else {
             return .left(Data())
@@ -74,7 +142,7 @@ extension Array where Element == MultipartFormField {
             dest.open()
             defer { dest.close() }
 
-            writeMultipartFormData(destination: dest, boundary: boundary)
+            try dest.write(contentsOf: multipartFormInputStream(boundary: boundary))
         }
 
         // Return the result as `InputStream`
@@ -88,72 +156,248 @@ extension Array where Element == MultipartFormField {
 
         throw MultipartFormError.impossible
     }
+}
 
-    private func writeMultipartFormData(destination dest: OutputStream, boundary: String) {
-        for field in self {
-            dest.writeMultipartForm(boundary: boundary, isEnd: false)
+/// An `InputStream` that reads a sequence of in-memory data and fields' content streams, one after another.
+///
+/// The content of the fields that have a `contentHashHandler` is hashed as it's read, so that it isn't read again to
+/// compute its hash.
+final class MultipartFormInputStream: InputStream {
+    enum Segment {
+        case data(Data)
+        case field(MultipartFormField)
 
-            // Write headers
-            var disposition = ["form-data", "name=\"\(field.name)\""]
-            if let filename = field.filename {
-                disposition += ["filename=\"\(filename)\""]
+        var bytes: UInt64 {
+            switch self {
+            case let .data(data):
+                return UInt64(data.count)
+            case let .field(field):
+                return field.bytes
             }
-            dest.writeMultipartFormHeader(name: "Content-Disposition", value: disposition.joined(separator: "; "))
+        }
+    }
 
-            if let mimeType = field.mimeType {
-                dest.writeMultipartFormHeader(name: "Content-Type", value: mimeType)
+    /// The total number of bytes of this stream.
+    let contentLength: UInt64
+
+    private let segments: [Segment]
+    private var segmentIndex = 0
+    private var dataOffset = 0
+    private var fieldStream: InputStream?
+    private var fieldHasher: SHA256?
+
+    private var status: Stream.Status = .notOpen
+    private var error: Error?
+    private weak var _delegate: StreamDelegate?
+
+    init(segments: [Segment]) {
+        self.segments = segments
+        self.contentLength = segments.reduce(0) { $0 + $1.bytes }
+        super.init(data: Data())
+    }
+
+    override var streamStatus: Stream.Status {
+        status
+    }
+
+    override var streamError: Error? {
+        error
+    }
+
+    override var delegate: StreamDelegate? {
+        get { _delegate }
+        set { _delegate = newValue }
+    }
+
+    override var hasBytesAvailable: Bool {
+        status == .open && segmentIndex < segments.count
+    }
+
+    override func open() {
+        guard status == .notOpen else { return }
+
+        status = segments.isEmpty ? .atEnd : .open
+    }
+
+    override func close() {
+        fieldStream?.close()
+        fieldStream = nil
+        fieldHasher = nil
+        status = .closed
+    }
+
+    override func read(_ buffer: UnsafeMutablePointer<UInt8>, maxLength len: Int) -> Int {
+        guard status == .open else {
+            return status == .atEnd ? 0 : -1
+        }
+
+        var total = 0
+        while total < len, segmentIndex < segments.count {
+            let read: Int
+            switch segments[segmentIndex] {
+            case let .data(data):
+                read = readData(data, into: buffer + total, maxLength: len - total)
+            case let .field(field):
+                read = readField(field, into: buffer + total, maxLength: len - total)
             }
 
-            // Write a linebreak between header and content
-            dest.writeMultipartFormLineBreak()
+            if read < 0 {
+                status = .error
+                return -1
+            }
 
-            // Write content
-            field.inputStream.open()
-            defer {
-                field.inputStream.close()
+            if read == 0 {
+                advance()
+            } else {
+                total += read
             }
-            let maxLength = 1024
-            var buffer = [UInt8](repeating: 0, count: maxLength)
-            while field.inputStream.hasBytesAvailable {
-                let bytes = field.inputStream.read(&buffer, maxLength: maxLength)
-                dest.write(data: Data(bytesNoCopy: &buffer, count: bytes, deallocator: .none))
+        }
+
+        if segmentIndex >= segments.count {
+            status = .atEnd
+        }
+
+        return total
+    }
+
+    override func getBuffer(_ buffer: UnsafeMutablePointer<UnsafeMutablePointer<UInt8>?>, length len: UnsafeMutablePointer<Int>) -> Bool {
+        false
+    }
+
+    override func property(forKey key: Stream.PropertyKey) -> Any? {
+        nil
+    }
+
+    override func setProperty(_ property: Any?, forKey key: Stream.PropertyKey) -> Bool {
+        false
+    }
+
+    override func schedule(in aRunLoop: RunLoop, forMode mode: RunLoop.Mode) {
+        // This stream is always read synchronously.
+    }
+
+    override func remove(from aRunLoop: RunLoop, forMode mode: RunLoop.Mode) {
+        // This stream is always read synchronously.
+    }
+
+    private func readData(_ data: Data, into buffer: UnsafeMutablePointer<UInt8>, maxLength len: Int) -> Int {
+        let count = Swift.min(len, data.count - dataOffset)
+        guard count > 0 else { return 0 }
+
+        data.copyBytes(to: buffer, from: (data.startIndex + dataOffset)..<(data.startIndex + dataOffset + count))
+        dataOffset += count
+        return count
+    }
+
+    private func readField(_ field: MultipartFormField, into buffer: UnsafeMutablePointer<UInt8>, maxLength len: Int) -> Int {
+        if fieldStream == nil {
+            guard let stream = field.makeInputStream() else {
+                error = MultipartFormError.inaccessbileFile(path: field.filename ?? field.name)
+                return -1
             }
+            stream.open()
+            fieldStream = stream
+            fieldHasher = field.contentHashHandler == nil ? nil : SHA256()
+        }
 
-            dest.writeMultipartFormLineBreak()
+        guard let fieldStream else {
+            return -1
         }
 
-        dest.writeMultipartForm(boundary: boundary, isEnd: true)
+        let read = fieldStream.read(buffer, maxLength: len)
+        if read < 0 {
+            error = fieldStream.streamError
+            fieldHasher = nil
+        } else if read > 0 {
+            fieldHasher?.update(bufferPointer: UnsafeRawBufferPointer(start: buffer, count: read))
+        } else if let hasher = fieldHasher {
+            fieldHasher = nil
+            field.contentHashHandler?(hasher.finalize().map { String(format: "%02x", $0) }.joined())
+        }
+        return read
+    }
+
+    private func advance() {
+        fieldStream?.close()
+        fieldStream = nil
+        fieldHasher = nil
+        dataOffset = 0
+        segmentIndex += 1
     }
 }
 
-private let multipartFormDataLineBreak = "\r\n"
-private extension OutputStream {
-    func write(data: Data) {
-        let count = data.count
-        guard count > 0 else { return }
+extension MultipartFormInputStream {
+    /// Returns a stream of this stream's content that `URLSession` can read as a `URLRequest.httpBodyStream`.
+    ///
+    /// `URLSession` reads body streams from its run loop, which this stream doesn't support. So the content is copied
+    /// into one end of a bound stream pair by a `BoundStreamWriter`, and the other end is returned. Only a chunk of the
+    /// content is in memory at a time. The copy stops once the content is copied, or when the returned stream is closed.
+    func boundInputStream() -> InputStream {
+        boundStream().input
+    }
 
-        _ = data.withUnsafeBytes { (ptr: UnsafeRawBufferPointer) in
-            write(ptr.bindMemory(to: Int8.self).baseAddress!, maxLength: count)
+    /// Same as `boundInputStream()`, but also returns the writer, which can be stopped before the content is copied.
+    /// `onError` is called if this stream fails while it's copied.
+    func boundStream(onError: ((Error) -> Void)? = nil) -> (input: InputStream, writer: BoundStreamWriter?) {
+        var input: InputStream?
+        var output: OutputStream?
+        Stream.getBoundStreams(withBufferSize: 64 * 1024, inputStream: &input, outputStream: &output)
+        guard let input, let output else {
+            return (InputStream(data: Data()), nil)
         }
+
+        let writer = BoundStreamWriter(source: self, output: output, onError: onError)
+        writer.start()
+        return (input, writer)
     }
+}
 
-    func writeMultipartForm(lineContent: String) {
-        write(data: "\(lineContent)\(multipartFormDataLineBreak)".data(using: .utf8)!)
+private let multipartFormDataLineBreak = "\r\n"
+private extension Data {
+    mutating func appendMultipartForm(lineContent: String) {
+        append("\(lineContent)\(multipartFormDataLineBreak)".data(using: .utf8)!)
     }
 
-    func writeMultipartFormLineBreak() {
-        write(data: multipartFormDataLineBreak.data(using: .utf8)!)
+    mutating func appendMultipartFormLineBreak() {
+        append(multipartFormDataLineBreak.data(using: .utf8)!)
     }
 
-    func writeMultipartFormHeader(name: String, value: String) {
-        writeMultipartForm(lineContent: "\(name): \(value)")
+    mutating func appendMultipartFormHeader(name: String, value: String) {
+        appendMultipartForm(lineContent: "\(name): \(value)")
     }
 
-    func writeMultipartForm(boundary: String, isEnd: Bool) {
+    mutating func appendMultipartForm(boundary: String, isEnd: Bool) {
         if isEnd {
-            writeMultipartForm(lineContent: "--\(boundary)--")
+            appendMultipartForm(lineContent: "--\(boundary)--")
         } else {
-            writeMultipartForm(lineContent: "--\(boundary)")
+            appendMultipartForm(lineContent: "--\(boundary)")
+        }
+    }
+}
+
+private extension OutputStream {
+    func write(contentsOf source: InputStream) throws {
+        source.open()
+        defer { source.close() }
+
+        let maxLength = 64 * 1024
+        var buffer = [UInt8](repeating: 0, count: maxLength)
+        while source.hasBytesAvailable {
+            let bytes = source.read(&buffer, maxLength: maxLength)
+            if bytes < 0 {
+                throw source.streamError ?? MultipartFormError.impossible
+            }
+
+            var written = 0
+            while written < bytes {
+                let result = buffer.withUnsafeBufferPointer {
+                    write($0.baseAddress! + written, maxLength: bytes - written)
+                }
+                if result <= 0 {
+                    throw streamError ?? MultipartFormError.impossible
+                }
+                written += result
+            }
         }
     }
 }
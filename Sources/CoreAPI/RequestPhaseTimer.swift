@@ -0,0 +1,146 @@
+import Foundation
+
+/// Measures the time that's spent in each phase of an API request, so that the endpoints whose cost is dominated by
+/// parsing, rather than the network, can be found.
+///
+/// The timer is disabled until a `handler` is set. While it's disabled, the measured code runs as it is, without any
+/// extra work other than checking the `handler`.
+@objc public final class RequestPhaseTimer: NSObject {
+
+    @objc(RequestPhase) public enum Phase: Int {
+        /// Building the `URLRequest`, which includes encoding JSON and form bodies.
+        case build
+        /// Encoding multipart form and XML-RPC bodies.
+        case encode
+        /// Waiting for the response to be downloaded.
+        case network
+        /// Decoding the response body, i.e. using `JSONSerialization` or `WPXMLRPCDecoder`.
+        case decode
+        /// Mapping the decoded response into model objects.
+        case mapping
+    }
+
+    public struct Record {
+        public var phase: Phase
+        /// The endpoint of the request, i.e. `GET /rest/v1.1/sites/:site/posts`. See `HTTPRequestMetrics.endpoint`.
+        public var endpoint: String
+        /// The size of the payload: the number of bytes of the request or response body, or the number of mapped models.
+        public var size: Int
+        public var duration: TimeInterval
+        /// The CPU time that's spent by the thread that ran the phase. It's nil for the network phase.
+        public var cpuTime: TimeInterval?
+        public var isMainThread: Bool
+    }
+
+    /// Called with the record of each phase, synchronously on the thread that ran the phase. Set it to nil to disable
+    /// the timer.
+    ///
+    /// It can be set from any thread. A phase that's already running when it's changed is recorded by the handler that
+    /// was set when the phase started.
+    public static var handler: ((Record) -> Void)? {
+        get {
+            handlerLock.lock()
+            defer { handlerLock.unlock() }
+            return _handler
+        }
+        set {
+            handlerLock.lock()
+            defer { handlerLock.unlock() }
+            _handler = newValue
+        }
+    }
+
+    private static let handlerLock = NSLock()
+    private static var _handler: ((Record) -> Void)?
+
+    /// Run the given phase of a request and record its duration.
+    ///
+    /// - Parameter size: Returns the size of the payload, from the phase's result.
+    static func measure<T>(
+        _ phase: Phase,
+        endpoint: @autoclosure () -> String,
+        size: (T) -> Int,
+        _ work: () throws -> T
+    ) rethrows -> T {
+        // The handler is read once, so that it can't change while the phase runs.
+        guard let handler else {
+            return try work()
+        }
+
+        let isMainThread = Thread.isMainThread
+        let start = DispatchTime.now().uptimeNanoseconds
+        let cpuStart = threadCPUTime()
+        let result = try work()
+        let cpuTime = threadCPUTime() - cpuStart
+
+        handler(
+            Record(
+                phase: phase,
+                endpoint: endpoint(),
+                size: size(result),
+                duration: Double(DispatchTime.now().uptimeNanoseconds - start) / 1_000_000_000,
+                cpuTime: cpuTime,
+                isMainThread: isMainThread
+            )
+        )
+        return result
+    }
+
+    /// The start of a phase that doesn't run synchronously, with the handler that records it.
+    struct Start {
+        fileprivate var handler: (Record) -> Void
+        fileprivate var time: UInt64
+    }
+
+    /// Returns the start of a phase that doesn't run synchronously, which is passed to `record(_:endpoint:size:since:)`
+    /// when the phase finishes. It's nil when the timer is disabled.
+    static func start() -> Start? {
+        handler.map { Start(handler: $0, time: DispatchTime.now().uptimeNanoseconds) }
+    }
+
+    /// Record a phase that doesn't run synchronously, i.e. the network phase.
+    static func record(_ phase: Phase, endpoint: @autoclosure () -> String, size: @autoclosure () -> Int, since start: Start?) {
+        guard let start else {
+            return
+        }
+
+        start.handler(
+            Record(
+                phase: phase,
+                endpoint: endpoint(),
+                size: size(),
+                duration: Double(DispatchTime.now().uptimeNanoseconds - start.time) / 1_000_000_000,
+                cpuTime: nil,
+                isMainThread: Thread.isMainThread
+            )
+        )
+    }
+
+    /// Map a decoded response into model objects, and record the time of the `mapping` phase.
+    ///
+    /// - Parameters:
+    ///   - endpoint: The path or URL of the request. Its endpoint template, without the HTTP method, is recorded.
+    ///   - count: The number of models.
+    @objc public static func measureMapping(forEndpoint endpoint: String, count: Int, block: () -> Any?) -> Any? {
+        measure(.mapping, endpoint: mappingEndpointTemplate(endpoint), size: { _ in count }, block)
+    }
+
+    /// Map a decoded response into an array of models, and record the time of the `mapping` phase.
+    ///
+    /// - Parameter endpoint: The path or URL of the request. Its endpoint template, without the HTTP method, is recorded.
+    static func measureMapping<T>(forEndpoint endpoint: String, _ block: () throws -> [T]) rethrows -> [T] {
+        try measure(.mapping, endpoint: mappingEndpointTemplate(endpoint), size: \.count, block)
+    }
+
+    private static func mappingEndpointTemplate(_ endpoint: String) -> String {
+        HTTPRequestBuilder.endpointTemplate(forPath: URLComponents(string: endpoint)?.percentEncodedPath ?? endpoint)
+    }
+
+    private static func threadCPUTime() -> TimeInterval {
+        var time = timespec()
+        guard clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) == 0 else {
+            return 0
+        }
+        return TimeInterval(time.tv_sec) + TimeInterval(time.tv_nsec) / 1_000_000_000
+    }
+}
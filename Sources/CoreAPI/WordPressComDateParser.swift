@@ -0,0 +1,183 @@
+import Foundation
+
+/// Parses the dates returned by the WordPress.com and WordPress REST APIs, without a `DateFormatter`.
+///
+/// The dates are in the `yyyy-MM-dd'T'HH:mm:ss` format, optionally followed by fractional seconds, and by a time zone
+/// designator: `Z`, or an offset such as `+02:00`, `+0200` or `+02`.
+///
+/// The parser reads the UTF-8 bytes of the string in place and has no shared state, so it doesn't allocate and it's
+/// safe to use from any thread.
+///
+/// - SeeAlso: [RFC 3339](https://datatracker.ietf.org/doc/html/rfc3339)
+enum WordPressComDateParser {
+
+    /// Parses a date.
+    ///
+    /// - Parameters:
+    ///   - string: The date string.
+    ///   - assumingGMT: Whether a date without a time zone designator is in GMT, like the `date_gmt` values of the
+    ///     WordPress REST API. Otherwise, such a date is invalid, because it's in the time zone of the site.
+    static func date(from string: String, assumingGMT: Bool = false) -> Date? {
+        let parsed = string.utf8.withContiguousStorageIfAvailable { Self.date(fromUTF8: $0, assumingGMT: assumingGMT) }
+        // Bridged strings may not be contiguous, in which case their UTF-8 view is read instead.
+        return parsed ?? Self.date(fromUTF8: string.utf8, assumingGMT: assumingGMT)
+    }
+
+    private static func date<Bytes: Collection>(fromUTF8 bytes: Bytes, assumingGMT: Bool) -> Date? where Bytes.Element == UInt8 {
+        var cursor = Cursor(bytes: bytes)
+
+        guard let year = cursor.number(digits: 4), cursor.skip("-"),
+              let month = cursor.number(digits: 2), cursor.skip("-"),
+              let day = cursor.number(digits: 2), cursor.skip("T") || cursor.skip("t"),
+              let hour = cursor.number(digits: 2), cursor.skip(":"),
+              let minute = cursor.number(digits: 2), cursor.skip(":"),
+              let second = cursor.number(digits: 2) else {
+            return nil
+        }
+
+        // A leap second (60) is let through, and turns into the first second of the next minute.
+        guard (1...12).contains(month), (1...daysInMonth(month, year: year)).contains(day),
+              hour < 24, minute < 60, second <= 60 else {
+            return nil
+        }
+
+        var nanoseconds = 0
+        if cursor.skip(".") {
+            var scale = 100_000_000
+            var digits = 0
+            while let digit = cursor.digit() {
+                // The digits beyond nanoseconds are ignored.
+                nanoseconds += digit * scale
+                scale /= 10
+                digits += 1
+            }
+            guard digits > 0 else {
+                return nil
+            }
+        }
+
+        var offset = 0
+        if cursor.skip("Z") || cursor.skip("z") {
+            offset = 0
+        } else if let sign = cursor.sign() {
+            guard let hours = cursor.number(digits: 2), hours < 24 else {
+                return nil
+            }
+            var minutes = 0
+            if cursor.skip(":") {
+                guard let value = cursor.number(digits: 2) else {
+                    return nil
+                }
+                minutes = value
+            } else if !cursor.isAtEnd {
+                guard let value = cursor.number(digits: 2) else {
+                    return nil
+                }
+                minutes = value
+            }
+            guard minutes < 60 else {
+                return nil
+            }
+            offset = sign * (hours * 3600 + minutes * 60)
+        } else if !assumingGMT {
+            return nil
+        }
+
+        guard cursor.isAtEnd else {
+            return nil
+        }
+
+        let seconds = daysSince1970(year: year, month: month, day: day) * 86_400
+            + hour * 3600 + minute * 60 + second - offset
+        return Date(timeIntervalSince1970: TimeInterval(seconds) + TimeInterval(nanoseconds) / 1_000_000_000)
+    }
+
+    private static func daysInMonth(_ month: Int, year: Int) -> Int {
+        switch month {
+        case 2:
+            let isLeapYear = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)
+            return isLeapYear ? 29 : 28
+        case 4, 6, 9, 11:
+            return 30
+        default:
+            return 31
+        }
+    }
+
+    /// The number of days between 1970-01-01 and the given date, in the proleptic Gregorian calendar.
+    ///
+    /// - SeeAlso: [`days_from_civil`](http://howardhinnant.github.io/date_algorithms.html#days_from_civil)
+    private static func daysSince1970(year: Int, month: Int, day: Int) -> Int {
+        let year = month <= 2 ? year - 1 : year
+        let era = (year >= 0 ? year : year - 399) / 400
+        let yearOfEra = year - era * 400
+        let dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1
+        let dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear
+        return era * 146_097 + dayOfEra - 719_468
+    }
+
+}
+
+/// Reads the ASCII characters of a date.
+private struct Cursor<Bytes: Collection> where Bytes.Element == UInt8 {
+    let bytes: Bytes
+    private var index: Bytes.Index
+
+    init(bytes: Bytes) {
+        self.bytes = bytes
+        self.index = bytes.startIndex
+    }
+
+    var isAtEnd: Bool {
+        index == bytes.endIndex
+    }
+
+    /// Reads the given character, if it's the next one.
+    mutating func skip(_ character: Unicode.Scalar) -> Bool {
+        guard !isAtEnd, bytes[index] == UInt8(ascii: character) else {
+            return false
+        }
+        advance()
+        return true
+    }
+
+    /// Reads the next character, if it's a digit.
+    mutating func digit() -> Int? {
+        guard !isAtEnd else {
+            return nil
+        }
+        let byte = bytes[index]
+        guard (UInt8(ascii: "0")...UInt8(ascii: "9")).contains(byte) else {
+            return nil
+        }
+        advance()
+        return Int(byte - UInt8(ascii: "0"))
+    }
+
+    /// Reads the sign of an offset, if it's the next character.
+    mutating func sign() -> Int? {
+        if skip("+") {
+            return 1
+        }
+        if skip("-") {
+            return -1
+        }
+        return nil
+    }
+
+    /// Reads a number of exactly the given number of digits.
+    mutating func number(digits: Int) -> Int? {
+        var value = 0
+        for _ in 0..<digits {
+            guard let digit = digit() else {
+                return nil
+            }
+            value = value * 10 + digit
+        }
+        return value
+    }
+
+    private mutating func advance() {
+        bytes.formIndex(after: &index)
+    }
+}
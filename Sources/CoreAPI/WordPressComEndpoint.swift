@@ -0,0 +1,170 @@
+#if SWIFT_PACKAGE
+import APIInterface
+#endif
+import Foundation
+
+/// A WP.com REST API endpoint, whose path template is parsed once, i.e.
+/// `WordPressComEndpoint<TwoPathParameters>("sites/:site/posts/:post?context=edit", version: ._1_1)`.
+///
+/// Endpoints are meant to be created once and stored in static properties. Requests to an endpoint are assembled from
+/// its parsed template and the `WordPressComRestApi`'s parsed base URL, instead of formatting a path string using
+/// `WordPressComRESTAPIVersionedPathBuilder` and parsing it back into a URL for every request.
+///
+/// The `Parameters` type is the number of the template's parameters, so that the `path` function of an endpoint only
+/// takes that many values.
+public struct WordPressComEndpoint<Parameters: WordPressComPathParameterCount> {
+
+    public typealias Path = WordPressComEndpointPath
+
+    private enum Segment {
+        case literal(String)
+        case parameter(name: String)
+    }
+
+    public let template: String
+    public let version: WordPressComRESTAPIVersion
+
+    private let segments: [Segment]
+    private let query: [URLQueryItem]
+    private let hasTrailingSlash: Bool
+    private let literalLength: Int
+
+    /// - Parameters:
+    ///   - template: The endpoint's path, relative to the API version, with an optional query. The path segments that
+    ///         start with ":" are parameters, i.e. `sites/:site/posts`. The other segments must be percent-encoded.
+    ///         A trailing slash is kept, i.e. `read/sites/:site/posts/:post/`.
+    ///   - version: The API version.
+    ///
+    /// - Precondition: The template has as many parameters as `Parameters`.
+    public init(_ template: String, version: WordPressComRESTAPIVersion) {
+        let parts = template.split(separator: "?", maxSplits: 1, omittingEmptySubsequences: false)
+        let versionPath = WordPressComRESTAPIVersionedPathBuilder.path(forEndpoint: "", withVersion: version)
+
+        self.template = template
+        self.version = version
+        self.segments = (versionPath.split(separator: "/") + parts[0].split(separator: "/")).map { segment in
+            segment.hasPrefix(":") ? .parameter(name: String(segment.dropFirst())) : .literal(String(segment))
+        }
+        self.query = parts.count > 1 ? URLComponents(string: "?\(parts[1])")?.queryItems ?? [] : []
+        self.hasTrailingSlash = parts[0].hasSuffix("/")
+        self.literalLength = segments.reduce(0) { length, segment in
+            guard case let .literal(value) = segment else { return length + 1 }
+            return length + value.utf8.count + 1
+        }
+
+        precondition(
+            parameterNames.count == Parameters.count,
+            "\(template) has \(parameterNames.count) parameters, but the endpoint takes \(Parameters.count)"
+        )
+    }
+
+    /// The names of the endpoint's parameters, in the order they appear in the template.
+    public var parameterNames: [String] {
+        segments.compactMap {
+            guard case let .parameter(name) = $0 else { return nil }
+            return name
+        }
+    }
+
+    /// Returns the endpoint's path, using the given values for its parameters, in the order they appear in the template.
+    /// The number of values is checked by the `path` functions of each `Parameters` type.
+    fileprivate func path(values: [WordPressComPathParameter]) -> Path {
+        var path = String()
+        path.reserveCapacity(literalLength + values.count * 8)
+
+        var values = values.makeIterator()
+        for segment in segments {
+            if !path.isEmpty {
+                path.append("/")
+            }
+
+            switch segment {
+            case let .literal(value):
+                path.append(value)
+            case .parameter:
+                path.append(values.next()?.percentEncodedPathSegment ?? "")
+            }
+        }
+
+        if hasTrailingSlash {
+            path.append("/")
+        }
+
+        return Path(percentEncodedPath: path, query: query)
+    }
+
+}
+
+extension WordPressComEndpoint where Parameters == NoPathParameters {
+    public func path() -> Path {
+        path(values: [])
+    }
+}
+
+extension WordPressComEndpoint where Parameters == OnePathParameter {
+    public func path(_ value: WordPressComPathParameter) -> Path {
+        path(values: [value])
+    }
+}
+
+extension WordPressComEndpoint where Parameters == TwoPathParameters {
+    public func path(_ first: WordPressComPathParameter, _ second: WordPressComPathParameter) -> Path {
+        path(values: [first, second])
+    }
+}
+
+/// The path of an endpoint, with the values of its parameters. See `WordPressComEndpoint`.
+public struct WordPressComEndpointPath {
+    /// The percent-encoded path, relative to the API's base URL, i.e. `rest/v1.1/sites/1/posts/2`.
+    let percentEncodedPath: String
+    let query: [URLQueryItem]
+}
+
+/// The number of the parameters of a `WordPressComEndpoint`'s template.
+public protocol WordPressComPathParameterCount {
+    static var count: Int { get }
+}
+
+public enum NoPathParameters: WordPressComPathParameterCount {
+    public static let count = 0
+}
+
+public enum OnePathParameter: WordPressComPathParameterCount {
+    public static let count = 1
+}
+
+public enum TwoPathParameters: WordPressComPathParameterCount {
+    public static let count = 2
+}
+
+/// A value of a `WordPressComEndpoint` path parameter.
+public protocol WordPressComPathParameter {
+    /// The value, as a percent-encoded path segment.
+    var percentEncodedPathSegment: String { get }
+}
+
+extension Int: WordPressComPathParameter {
+    public var percentEncodedPathSegment: String { String(self) }
+}
+
+extension Int64: WordPressComPathParameter {
+    public var percentEncodedPathSegment: String { String(self) }
+}
+
+extension UInt: WordPressComPathParameter {
+    public var percentEncodedPathSegment: String { String(self) }
+}
+
+extension NSNumber: WordPressComPathParameter {
+    public var percentEncodedPathSegment: String { stringValue }
+}
+
+extension String: WordPressComPathParameter {
+    public var percentEncodedPathSegment: String {
+        addingPercentEncoding(withAllowedCharacters: .wordPressComPathSegmentAllowed) ?? self
+    }
+}
+
+private extension CharacterSet {
+    static let wordPressComPathSegmentAllowed = CharacterSet.urlPathAllowed.subtracting(CharacterSet(charactersIn: "/"))
+}
@@ -0,0 +1,243 @@
+import Foundation
+
+/// A GET request that can be sent as part of a WordPress.com REST API batch request.
+///
+/// See `WordPressComRestApi.GET(batch:)`.
+@objc public final class WordPressComRestApiBatchRequest: NSObject {
+    /// The versioned path of the endpoint, i.e. "rest/v1.1/sites/1/settings".
+    @objc public let path: String
+    @objc public let parameters: [String: AnyObject]?
+
+    @objc public let success: WordPressComRestApi.SuccessResponseBlock
+    @objc public let failure: WordPressComRestApi.FailureReponseBlock
+
+    @objc public init(
+        path: String,
+        parameters: [String: AnyObject]?,
+        success: @escaping WordPressComRestApi.SuccessResponseBlock,
+        failure: @escaping WordPressComRestApi.FailureReponseBlock
+    ) {
+        self.path = path
+        self.parameters = parameters
+        self.success = success
+        self.failure = failure
+    }
+}
+
+extension WordPressComRestApi {
+
+    /**
+     Executes the given GET requests using the WordPress.com REST API `batch` endpoint, which returns all responses in one
+     round trip.
+
+     Requests to the same API version ("rest/v1.1", "rest/v1.2", etc) are sent together in one batch request. Requests to
+     other endpoints, which are not supported by the `batch` endpoint, are sent individually.
+
+     Each request's `success` or `failure` callback is called with its own response, as if the request was sent using
+     the `GET` function. The responses of the requests in a batch have their own status code, and the headers of the
+     batch response.
+
+     - parameter requests: the requests to be sent in a batch
+
+     - returns: a `Progress` object that's completed once all requests complete. Cancelling it cancels the requests.
+     */
+    @objc @discardableResult open func GET(batch requests: [WordPressComRestApiBatchRequest]) -> Progress? {
+        let progress = Progress.discreteProgress(totalUnitCount: 100)
+
+        Task { @MainActor in
+            let results = await self.batchGET(
+                requests.map { (path: $0.path, parameters: $0.parameters) },
+                fulfilling: progress
+            )
+
+            for (request, result) in zip(requests, results) {
+                switch result {
+                case let .success(response):
+                    request.success(response.body, response.response)
+                case let .failure(error):
+                    request.failure(error.asNSError(), error.response)
+                }
+            }
+        }
+
+        return progress
+    }
+
+    /// Send GET requests using the WordPress.com REST API `batch` endpoint.
+    ///
+    /// - Parameters:
+    ///   - requests: The versioned paths (i.e. "rest/v1.1/me") and query parameters of the GET requests.
+    ///   - progress: A `Progress` instance that tracks the overall progress of all requests, and cancels them when it's
+    ///     cancelled.
+    /// - Returns: The results of the requests, in the same order as `requests`.
+    func batchGET(
+        _ requests: [(path: String, parameters: [String: AnyObject]?)],
+        fulfilling progress: Progress? = nil
+    ) async -> [APIResult<AnyObject>] {
+        // Group the requests by the API version, since the URLs in a batch request are relative to the API version of
+        // the batch endpoint.
+        var batches: [String: [(index: Int, url: String)]] = [:]
+        var individuals: [Int] = []
+        let locale = localeQueryItem
+        for (index, request) in requests.enumerated() {
+            if let batchURL = Self.batchURL(path: request.path, parameters: request.parameters, locale: locale) {
+                batches[batchURL.version, default: []].append((index, batchURL.url))
+            } else {
+                individuals.append(index)
+            }
+        }
+
+        var results = [APIResult<AnyObject>?](repeating: nil, count: requests.count)
+
+        // Each HTTP request fulfills a child of `progress`, so that cancelling `progress` cancels all of them.
+        progress?.totalUnitCount = Int64(batches.count + individuals.count)
+        let makeProgress = { () -> Progress? in
+            guard let progress else { return nil }
+            let child = Progress.discreteProgress(totalUnitCount: 100)
+            progress.addChild(child, withPendingUnitCount: 1)
+            return child
+        }
+
+        await withTaskGroup(of: [(Int, APIResult<AnyObject>)].self) { group in
+            for (version, batch) in batches {
+                let childProgress = makeProgress()
+                group.addTask {
+                    // There is no point sending a single request in a batch.
+                    guard batch.count > 1 else {
+                        let request = requests[batch[0].index]
+                        return [(batch[0].index, await self.perform(.get, URLString: request.path, parameters: request.parameters, fulfilling: childProgress))]
+                    }
+
+                    let responses = await self.batchGET(version: version, urls: batch.map { $0.url }, fulfilling: childProgress)
+                    return zip(batch, responses).map { ($0.index, $1) }
+                }
+            }
+
+            for index in individuals {
+                let childProgress = makeProgress()
+                group.addTask {
+                    let request = requests[index]
+                    return [(index, await self.perform(.get, URLString: request.path, parameters: request.parameters, fulfilling: childProgress))]
+                }
+            }
+
+            for await completed in group {
+                for (index, result) in completed {
+                    results[index] = result
+                }
+            }
+        }
+
+        progress?.completedUnitCount = progress?.totalUnitCount ?? 0
+
+        return results.map { $0 ?? .failure(.unknown(underlyingError: URLError(.unknown))) }
+    }
+
+    private func batchGET(version: String, urls: [String], fulfilling progress: Progress?) async -> [APIResult<AnyObject>] {
+        let builder: HTTPRequestBuilder
+        do {
+            builder = try requestBuilder(URLString: "\(version)/batch")
+                .method(.get)
+                .append(query: urls.map { URLQueryItem(name: "urls[]", value: $0) })
+        } catch {
+            return urls.map { _ in .failure(.requestEncodingFailure(underlyingError: error)) }
+        }
+
+        let result = await perform(request: builder, fulfilling: progress, decoder: { try JSONSerialization.jsonObject(with: $0) as AnyObject })
+
+        let response: HTTPAPIResponse<AnyObject>
+        switch result {
+        case let .success(success):
+            response = success
+        case let .failure(error):
+            return urls.map { _ in .failure(error) }
+        }
+
+        guard let bodies = response.body as? [String: AnyObject] else {
+            return urls.map { _ in .failure(.endpointError(.init(code: .responseSerializationFailed, response: response.response))) }
+        }
+
+        return urls.map { url in
+            guard let body = bodies[url] else {
+                return .failure(.endpointError(.init(code: .responseSerializationFailed, response: response.response)))
+            }
+
+            let isError = Self.isBatchError(body)
+            let itemResponse = batchItemResponse(
+                version: version,
+                url: url,
+                statusCode: (body as? [String: AnyObject])?["status_code"] as? Int ?? (isError ? 400 : 200),
+                batchResponse: response.response
+            )
+
+            if isError {
+                return .failure(.endpointError(batchError(in: body, response: itemResponse)))
+            }
+
+            return .success(HTTPAPIResponse(response: itemResponse, body: body))
+        }
+    }
+
+    /// Whether a response in a batch is an error: it has a 4xx or 5xx `status_code`, an `error` and a `message`, or a
+    /// non-empty `errors` array. Successful responses of some endpoints have an empty `errors` array.
+    private static func isBatchError(_ body: AnyObject) -> Bool {
+        guard let object = body as? [String: AnyObject] else {
+            return false
+        }
+
+        return (object["status_code"] as? Int).map { $0 >= 400 } == true
+            || (object["error"] is String && object["message"] is String)
+            || (object["errors"] as? [AnyObject])?.isEmpty == false
+    }
+
+    /// Returns the HTTP response of a request in a batch, which has the URL and the status code of the individual
+    /// request, and the headers of the batch response.
+    private func batchItemResponse(version: String, url: String, statusCode: Int, batchResponse: HTTPURLResponse) -> HTTPURLResponse {
+        let itemURL = URL(string: "\(version)\(url)", relativeTo: baseURL)?.absoluteURL ?? batchResponse.url
+        let headers = batchResponse.allHeaderFields as? [String: String]
+        return itemURL.flatMap { HTTPURLResponse(url: $0, statusCode: statusCode, httpVersion: nil, headerFields: headers) }
+            ?? batchResponse
+    }
+
+    /// Returns the error of a response in a batch, which is the same error object returned by the individual endpoint.
+    private func batchError(in body: AnyObject, response: HTTPURLResponse) -> WordPressComRestApiEndpointError {
+        guard let data = try? JSONSerialization.data(withJSONObject: body) else {
+            return .init(code: .unknown, response: response)
+        }
+
+        return processError(response: response, body: data, additionalUserInfo: nil)
+            ?? .init(code: .unknown, response: response)
+    }
+
+    /// Returns the API version and the URL of the request in a batch request. `nil` if the request can't be sent in a
+    /// batch request.
+    ///
+    /// - Parameter locale: The locale that's added to the URL's query, unless the parameters have one, since the
+    ///     individual requests of a batch are localized by their own query.
+    static func batchURL(path: String, parameters: [String: AnyObject]?, locale: URLQueryItem? = nil) -> (version: String, url: String)? {
+        let supportedVersions = ["rest/v1", "rest/v1.1", "rest/v1.2", "rest/v1.3"]
+
+        let versionedPath = path.hasPrefix("/") ? String(path.dropFirst()) : path
+        guard let version = supportedVersions.first(where: { versionedPath.hasPrefix("\($0)/") }) else {
+            return nil
+        }
+
+        let endpoint = String(versionedPath.dropFirst(version.count))
+        guard let url = try? HTTPRequestBuilder(url: URL(string: "https://public-api.wordpress.com")!)
+            .appendURLString(endpoint)
+            .query(parameters ?? [:])
+            .query(defaults: locale.map { [$0] } ?? [])
+            .build()
+            .url,
+            let components = URLComponents(url: url, resolvingAgainstBaseURL: false)
+        else {
+            return nil
+        }
+
+        if let query = components.percentEncodedQuery, !query.isEmpty {
+            return (version, "\(components.percentEncodedPath)?\(query)")
+        }
+        return (version, components.percentEncodedPath)
+    }
+
+}
@@ -102,6 +102,11 @@ open class WordPressComRestApi: NSObject {
 
     @objc public let baseURL: URL
 
+    /// The parsed `baseURL`, which `WordPressComEndpoint` paths are appended to.
+    private let baseURLComponents: URLComponents?
+
+    private let preferredLanguage = PreferredLanguageCache()
+
     private var invalidTokenHandler: (() -> Void)?
 
     /**
@@ -109,6 +114,53 @@ open class WordPressComRestApi: NSObject {
      */
     @objc open var appendsPreferredLanguageLocale = true
 
+    /**
+     Configure whether identical GET requests that are sent while one of them is still in flight should share a single
+     network request. Defaults to false.
+     */
+    @objc open var coalescesInFlightGETRequests = false
+
+    /// Counters of the requests that are sent or coalesced when `coalescesInFlightGETRequests` is enabled.
+    public var inFlightRequestStatistics: InFlightRequestCoalescer.Statistics {
+        inFlightRequestCoalescer.statistics
+    }
+
+    // The coalescer is not shareable among API instances, because their requests are sent using different credentials.
+    private let inFlightRequestCoalescer = InFlightRequestCoalescer()
+
+    /// A cache that's used to send conditional GET requests, so that unchanged responses are neither downloaded nor
+    /// decoded again. Defaults to nil, which disables the caching.
+    public var responseCache: HTTPResponseCache?
+
+    /// The retry policy of the requests that don't specify their own. Defaults to `HTTPRetryPolicy.none`, which
+    /// disables retries.
+    public var retryPolicy: HTTPRetryPolicy {
+        get { retrier.policy }
+        set { retrier.policy = newValue }
+    }
+
+    /// Counters of the retries that are made according to `retryPolicy`, or the requests' own policies.
+    public var retryStatistics: HTTPRequestRetrier.Statistics {
+        retrier.statistics
+    }
+
+    /// A rate limiter that requests wait on before they are sent. It can be shared with other API instances. Defaults
+    /// to nil, which disables the rate limiting.
+    ///
+    /// The limiter is tightened automatically when the API responds that requests are throttled.
+    public var rateLimiter: HTTPRateLimiter?
+
+    /// A scheduler that limits the number of in-flight requests, and sends the queued requests in the order of their
+    /// priority. It can be shared with other API instances. Defaults to nil, which sends all requests right away.
+    public var scheduler: HTTPRequestScheduler?
+
+    /// An observer that collects the network metrics of the requests. It can be shared with other API instances.
+    /// Defaults to nil, which disables the collection.
+    public var metricsObserver: HTTPMetricsObserver?
+
+    // The throttled requests are not retried before the throttling is lifted.
+    private let retrier = HTTPRequestRetrier(throttlingDelay: WordPressComRestApi.throttlingDelay(response:data:))
+
     // MARK: WordPressComRestApi
 
     @objc convenience public init(oAuthToken: String? = nil, userAgent: String? = nil) {
@@ -148,6 +200,7 @@ open class WordPressComRestApi: NSObject {
         self.sharedContainerIdentifier = sharedContainerIdentifier
         self.localeKey = localeKey
         self.baseURL = baseURL
+        self.baseURLComponents = URLComponents(url: baseURL, resolvingAgainstBaseURL: true)
 
         super.init()
     }
@@ -198,10 +251,23 @@ open class WordPressComRestApi: NSObject {
                      parameters: [String: AnyObject]?,
                      success: @escaping SuccessResponseBlock,
                      failure: @escaping FailureReponseBlock) -> Progress? {
+        GET(URLString, parameters: parameters, priority: .default, success: success, failure: failure)
+    }
+
+    /**
+     Executes a GET request to the specified endpoint defined on URLString, in the given `scheduler` lane.
+
+     See `GET(_:parameters:success:failure:)`.
+     */
+    @objc @discardableResult open func GET(_ URLString: String,
+                     parameters: [String: AnyObject]?,
+                     priority: HTTPRequestPriority,
+                     success: @escaping SuccessResponseBlock,
+                     failure: @escaping FailureReponseBlock) -> Progress? {
         let progress = Progress.discreteProgress(totalUnitCount: 100)
 
         Task { @MainActor in
-            let result = await self.perform(.get, URLString: URLString, parameters: parameters, fulfilling: progress)
+            let result = await self.perform(.get, URLString: URLString, parameters: parameters, fulfilling: progress, priority: priority)
 
             switch result {
             case let .success(response):
@@ -244,10 +310,23 @@ open class WordPressComRestApi: NSObject {
                      parameters: [String: AnyObject]?,
                      success: @escaping SuccessResponseBlock,
                      failure: @escaping FailureReponseBlock) -> Progress? {
+        POST(URLString, parameters: parameters, priority: .default, success: success, failure: failure)
+    }
+
+    /**
+     Executes a POST request to the specified endpoint defined on URLString, in the given `scheduler` lane.
+
+     See `POST(_:parameters:success:failure:)`.
+     */
+    @objc @discardableResult open func POST(_ URLString: String,
+                     parameters: [String: AnyObject]?,
+                     priority: HTTPRequestPriority,
+                     success: @escaping SuccessResponseBlock,
+                     failure: @escaping FailureReponseBlock) -> Progress? {
         let progress = Progress.discreteProgress(totalUnitCount: 100)
 
         Task { @MainActor in
-            let result = await self.perform(.post, URLString: URLString, parameters: parameters, fulfilling: progress)
+            let result = await self.perform(.post, URLString: URLString, parameters: parameters, fulfilling: progress, priority: priority)
 
             switch result {
             case let .success(response):
@@ -282,11 +361,35 @@ open class WordPressComRestApi: NSObject {
         requestEnqueued: RequestEnqueuedBlock? = nil,
         success: @escaping SuccessResponseBlock,
         failure: @escaping FailureReponseBlock
+    ) -> Progress? {
+        multipartPOST(URLString, parameters: parameters, fileParts: fileParts, priority: .default, requestEnqueued: requestEnqueued, success: success, failure: failure)
+    }
+
+    /**
+     Executes a multipart POST in the given `scheduler` lane.
+
+     See `multipartPOST(_:parameters:fileParts:requestEnqueued:success:failure:)`.
+     */
+    @nonobjc @discardableResult open func multipartPOST(
+        _ URLString: String,
+        parameters: [String: AnyObject]?,
+        fileParts: [FilePart],
+        priority: HTTPRequestPriority,
+        requestEnqueued: RequestEnqueuedBlock? = nil,
+        success: @escaping SuccessResponseBlock,
+        failure: @escaping FailureReponseBlock
     ) -> Progress? {
         let progress = Progress.discreteProgress(totalUnitCount: 100)
 
         Task { @MainActor in
-            let result = await upload(URLString: URLString, parameters: parameters, fileParts: fileParts, requestEnqueued: requestEnqueued, fulfilling: progress)
+            let result = await upload(
+                URLString: URLString,
+                parameters: parameters,
+                fileParts: fileParts,
+                requestEnqueued: requestEnqueued,
+                fulfilling: progress,
+                priority: priority
+            )
             switch result {
             case let .success(response):
                 success(response.body, response.response)
@@ -314,14 +417,35 @@ open class WordPressComRestApi: NSObject {
             throw URLError(.badURL)
         }
 
-        var builder = HTTPRequestBuilder(url: url)
+        return appendingLocale(to: HTTPRequestBuilder(url: url))
+    }
+
+    func requestBuilder(path: WordPressComEndpointPath) throws -> HTTPRequestBuilder {
+        guard let baseURLComponents else {
+            throw URLError(.badURL)
+        }
+
+        let builder = HTTPRequestBuilder(components: baseURLComponents)
+            .append(percentEncodedPath: path.percentEncodedPath)
+            .append(query: path.query)
+        return appendingLocale(to: builder)
+    }
+
+    private func appendingLocale(to builder: HTTPRequestBuilder) -> HTTPRequestBuilder {
+        guard let localeQueryItem else {
+            return builder
+        }
+
+        return builder.query(defaults: [localeQueryItem])
+    }
 
-        if appendsPreferredLanguageLocale {
-            let preferredLanguageIdentifier = WordPressComLanguageDatabase().deviceLanguage.slug
-            builder = builder.query(defaults: [URLQueryItem(name: localeKey, value: preferredLanguageIdentifier)])
+    /// The locale that's appended to the query of requests. `nil` if `appendsPreferredLanguageLocale` is false.
+    var localeQueryItem: URLQueryItem? {
+        guard appendsPreferredLanguageLocale else {
+            return nil
         }
 
-        return builder
+        return URLQueryItem(name: localeKey, value: preferredLanguage.identifier)
     }
 
     @objc public func temporaryFileURL(withExtension fileExtension: String) -> URL {
@@ -334,7 +458,7 @@ open class WordPressComRestApi: NSObject {
     // MARK: - Async
 
     private lazy var urlSession: URLSession = {
-        URLSession(configuration: sessionConfiguration(background: false))
+        URLSession(configuration: sessionConfiguration(background: false), delegate: BodyStreamURLSessionDelegate(), delegateQueue: nil)
     }()
 
     private lazy var uploadURLSession: URLSession = {
@@ -343,7 +467,7 @@ open class WordPressComRestApi: NSObject {
         if configuration.identifier != nil {
             return URLSession.backgroundSession(configuration: configuration)
         } else {
-            return URLSession(configuration: configuration)
+            return URLSession(configuration: configuration, delegate: BodyStreamURLSessionDelegate(), delegateQueue: nil)
         }
     }()
 
@@ -367,9 +491,24 @@ open class WordPressComRestApi: NSObject {
         _ method: HTTPRequestBuilder.Method,
         URLString: String,
         parameters: [String: AnyObject]? = nil,
-        fulfilling progress: Progress? = nil
+        fulfilling progress: Progress? = nil,
+        retryPolicy: HTTPRetryPolicy? = nil,
+        priority: HTTPRequestPriority = .default
+    ) async -> APIResult<AnyObject> {
+        await perform(method, builder: { try self.requestBuilder(URLString: URLString) }, parameters: parameters, fulfilling: progress, retryPolicy: retryPolicy, priority: priority) {
+            try (JSONSerialization.jsonObject(with: $0) as AnyObject)
+        }
+    }
+
+    func perform(
+        _ method: HTTPRequestBuilder.Method,
+        path: WordPressComEndpointPath,
+        parameters: [String: AnyObject]? = nil,
+        fulfilling progress: Progress? = nil,
+        retryPolicy: HTTPRetryPolicy? = nil,
+        priority: HTTPRequestPriority = .default
     ) async -> APIResult<AnyObject> {
-        await perform(method, URLString: URLString, parameters: parameters, fulfilling: progress) {
+        await perform(method, builder: { try self.requestBuilder(path: path) }, parameters: parameters, fulfilling: progress, retryPolicy: retryPolicy, priority: priority) {
             try (JSONSerialization.jsonObject(with: $0) as AnyObject)
         }
     }
@@ -380,24 +519,113 @@ open class WordPressComRestApi: NSObject {
         parameters: [String: AnyObject]? = nil,
         fulfilling progress: Progress? = nil,
         jsonDecoder: JSONDecoder? = nil,
-        type: T.Type = T.self
+        type: T.Type = T.self,
+        retryPolicy: HTTPRetryPolicy? = nil,
+        priority: HTTPRequestPriority = .default
+    ) async -> APIResult<T> {
+        // Responses can't be shared among requests that use different decoders.
+        await perform(
+            method,
+            builder: { try self.requestBuilder(URLString: URLString) },
+            parameters: parameters,
+            fulfilling: progress,
+            retryPolicy: retryPolicy,
+            priority: priority,
+            sharesDecodedResponse: jsonDecoder == nil
+        ) {
+            let decoder = jsonDecoder ?? JSONDecoder()
+            return try decoder.decode(type, from: $0)
+        }
+    }
+
+    func perform<T: Decodable>(
+        _ method: HTTPRequestBuilder.Method,
+        path: WordPressComEndpointPath,
+        parameters: [String: AnyObject]? = nil,
+        fulfilling progress: Progress? = nil,
+        jsonDecoder: JSONDecoder? = nil,
+        type: T.Type = T.self,
+        retryPolicy: HTTPRetryPolicy? = nil,
+        priority: HTTPRequestPriority = .default
+    ) async -> APIResult<T> {
+        await perform(
+            method,
+            builder: { try self.requestBuilder(path: path) },
+            parameters: parameters,
+            fulfilling: progress,
+            retryPolicy: retryPolicy,
+            priority: priority,
+            sharesDecodedResponse: jsonDecoder == nil
+        ) {
+            let decoder = jsonDecoder ?? JSONDecoder()
+            return try decoder.decode(type, from: $0)
+        }
+    }
+
+    /// Send a request whose JSON body is encoded directly from the given value, using the given encoder.
+    func perform(
+        _ method: HTTPRequestBuilder.Method,
+        path: WordPressComEndpointPath,
+        body: Encodable,
+        jsonEncoder: JSONEncoder = JSONEncoder(),
+        fulfilling progress: Progress? = nil,
+        retryPolicy: HTTPRetryPolicy? = nil,
+        priority: HTTPRequestPriority = .default
+    ) async -> APIResult<AnyObject> {
+        await perform(
+            method,
+            builder: { try self.requestBuilder(path: path).body(json: body, jsonEncoder: jsonEncoder) },
+            parameters: nil,
+            fulfilling: progress,
+            retryPolicy: retryPolicy,
+            priority: priority
+        ) {
+            try (JSONSerialization.jsonObject(with: $0) as AnyObject)
+        }
+    }
+
+    /// Send a request whose JSON body is encoded directly from the given value, using the given encoder.
+    func perform<T: Decodable>(
+        _ method: HTTPRequestBuilder.Method,
+        path: WordPressComEndpointPath,
+        body: Encodable,
+        jsonEncoder: JSONEncoder = JSONEncoder(),
+        fulfilling progress: Progress? = nil,
+        jsonDecoder: JSONDecoder? = nil,
+        type: T.Type = T.self,
+        retryPolicy: HTTPRetryPolicy? = nil,
+        priority: HTTPRequestPriority = .default
     ) async -> APIResult<T> {
-        await perform(method, URLString: URLString, parameters: parameters, fulfilling: progress) {
+        await perform(
+            method,
+            builder: { try self.requestBuilder(path: path).body(json: body, jsonEncoder: jsonEncoder) },
+            parameters: nil,
+            fulfilling: progress,
+            retryPolicy: retryPolicy,
+            priority: priority,
+            sharesDecodedResponse: jsonDecoder == nil
+        ) {
             let decoder = jsonDecoder ?? JSONDecoder()
             return try decoder.decode(type, from: $0)
         }
     }
 
+    /// - Parameter sharesDecodedResponse: Whether the decoded response can be returned to other requests, which is
+    ///     only true when the `decoder` always decodes the same response into the same value. Identical GET requests
+    ///     still share the response's data when it's false, but each of them decodes it.
     private func perform<T>(
         _ method: HTTPRequestBuilder.Method,
-        URLString: String,
+        builder makeBuilder: () throws -> HTTPRequestBuilder,
         parameters: [String: AnyObject]?,
         fulfilling progress: Progress?,
+        retryPolicy: HTTPRetryPolicy? = nil,
+        priority: HTTPRequestPriority = .default,
+        sharesDecodedResponse: Bool = true,
         decoder: @escaping (Data) throws -> T
     ) async -> APIResult<T> {
         var builder: HTTPRequestBuilder
         do {
-            builder = try requestBuilder(URLString: URLString)
+            builder = try makeBuilder()
                 .method(method)
         } catch {
             return .failure(.requestEncodingFailure(underlyingError: error))
@@ -411,24 +639,126 @@ open class WordPressComRestApi: NSObject {
             }
         }
 
-        return await perform(request: builder, fulfilling: progress, decoder: decoder)
+        // The request is built once, and passed down to the URL session.
+        let request: URLRequest
+        do {
+            request = try RequestPhaseTimer.measure(.build, endpoint: builder.endpointTemplate, size: { $0.httpBody?.count ?? 0 }) {
+                try builder.build()
+            }
+        } catch {
+            return .failure(.requestEncodingFailure(underlyingError: error))
+        }
+
+        // The caller may be waiting for an identical request that's still queued with a lower priority, either because
+        // it joins the shared request or because it's a duplicate that's sent after it.
+        scheduler?.promote(request, to: priority)
+
+        if coalescesInFlightGETRequests, method == .get {
+            guard sharesDecodedResponse else {
+                // The response's data is shared instead, and each caller decodes it with its own decoder.
+                let shared: APIResult<Data> = await inFlightRequestCoalescer.perform(
+                    request,
+                    fulfilling: progress,
+                    cancelled: { .failure(.connection(URLError(.cancelled))) },
+                    operation: { [builder] sharedProgress in
+                        await self.perform(
+                            request: builder,
+                            builtRequest: request,
+                            fulfilling: sharedProgress,
+                            decoder: { $0 },
+                            retryPolicy: retryPolicy,
+                            priority: priority,
+                            recordsDecoding: false
+                        )
+                    }
+                )
+                return shared.flatMap { response in
+                    do {
+                        let object = try RequestPhaseTimer.measure(.decode, endpoint: builder.endpointTemplate, size: { _ in response.body.count }) {
+                            try decoder(response.body)
+                        }
+                        return .success(HTTPAPIResponse(response: response.response, body: object))
+                    } catch {
+                        return .failure(.endpointError(.init(code: .responseSerializationFailed, response: response.response)))
+                    }
+                }
+            }
+
+            return await inFlightRequestCoalescer.perform(
+                request,
+                fulfilling: progress,
+                cancelled: { .failure(.connection(URLError(.cancelled))) },
+                operation: { [builder] sharedProgress in
+                    await self.perform(
+                        request: builder,
+                        builtRequest: request,
+                        fulfilling: sharedProgress,
+                        decoder: decoder,
+                        retryPolicy: retryPolicy,
+                        priority: priority,
+                        sharesDecodedResponse: true
+                    )
+                }
+            )
+        }
+
+        return await perform(
+            request: builder,
+            builtRequest: request,
+            fulfilling: progress,
+            decoder: decoder,
+            retryPolicy: retryPolicy,
+            priority: priority,
+            sharesDecodedResponse: sharesDecodedResponse
+        )
     }
 
+    /// - Parameter recordsDecoding: Whether the `decoder` is measured as the decode phase of the request. It's false
+    ///     when the response is decoded later, by each of the requests that share it.
     func perform<T>(
         request: HTTPRequestBuilder,
+        builtRequest: URLRequest? = nil,
         fulfilling progress: Progress? = nil,
         decoder: @escaping (Data) throws -> T,
         taskCreated: ((Int) -> Void)? = nil,
-        session: URLSession? = nil
+        session: URLSession? = nil,
+        retryPolicy: HTTPRetryPolicy? = nil,
+        priority: HTTPRequestPriority = .default,
+        sharesDecodedResponse: Bool = false,
+        recordsDecoding: Bool = true
     ) async -> APIResult<T> {
-        await (session ?? self.urlSession)
-            .perform(request: request, taskCreated: taskCreated, fulfilling: progress, errorType: WordPressComRestApiEndpointError.self)
+        let cache = responseCache
+        return await (session ?? self.urlSession)
+            .perform(
+                request: request,
+                builtRequest: builtRequest,
+                taskCreated: taskCreated,
+                fulfilling: progress,
+                errorType: WordPressComRestApiEndpointError.self,
+                cache: cache,
+                retrier: retrier,
+                retryPolicy: retryPolicy,
+                rateLimiter: rateLimiter,
+                scheduler: scheduler,
+                priority: priority,
+                metricsObserver: metricsObserver
+            )
             .mapSuccess { response -> HTTPAPIResponse<T> in
-                let object = try decoder(response.body)
+                guard recordsDecoding else {
+                    return HTTPAPIResponse(response: response.response, body: try decoder(response.body))
+                }
+                let object = try RequestPhaseTimer.measure(.decode, endpoint: request.endpointTemplate, size: { _ in response.body.count }) {
+                    if let cache, sharesDecodedResponse {
+                        return try cache.decoded(response.body, url: response.response.url, decoder: decoder)
+                    }
+                    return try decoder(response.body)
+                }
 
                 return HTTPAPIResponse(response: response.response, body: object)
             }
             .mapUnacceptableStatusCodeError { response, body in
+                self.tightenRateLimiter(afterThrottledResponse: response, body: body)
+
                 if let error = self.processError(response: response, body: body, additionalUserInfo: nil) {
                     return error
                 }
@@ -453,12 +783,19 @@ open class WordPressComRestApi: NSObject {
         httpHeaders: [String: String]? = nil,
         fileParts: [FilePart],
         requestEnqueued: RequestEnqueuedBlock? = nil,
-        fulfilling progress: Progress? = nil
+        fulfilling progress: Progress? = nil,
+        priority: HTTPRequestPriority = .default
     ) async -> APIResult<AnyObject> {
         let builder: HTTPRequestBuilder
         do {
             let form = try fileParts.map {
-                try MultipartFormField(fileAtPath: $0.url.path, name: $0.parameterName, filename: $0.fileName, mimeType: $0.mimeType)
+                try MultipartFormField(
+                    fileAtPath: $0.url.path,
+                    name: $0.parameterName,
+                    filename: $0.fileName,
+                    mimeType: $0.mimeType,
+                    contentHashHandler: $0.contentHashHandler
+                )
             }
             builder = try requestBuilder(URLString: URLString)
                 .method(.post)
@@ -477,7 +814,8 @@ open class WordPressComRestApi: NSObject {
                     requestEnqueued?(NSNumber(value: taskID))
                 }
             },
-            session: uploadURLSession
+            session: uploadURLSession,
+            priority: priority
         )
     }
 
@@ -550,11 +888,8 @@ extension WordPressComRestApi {
     }
 
     func checkForThrottleErrorIn(response: HTTPURLResponse, data: Data) -> WordPressComRestApiEndpointError? {
-        // This endpoint is throttled, so check if we've sent too many requests and fill that error in as
-        // when too many requests occur the API just spits out an html page.
-        guard let responseString = String(data: data, encoding: .utf8),
-            responseString.contains("Limit reached") else {
-                return nil
+        guard Self.throttlingDelay(response: response, data: data) != nil else {
+            return nil
         }
 
         let message = NSLocalizedString(
@@ -568,6 +903,29 @@ extension WordPressComRestApi {
             apiErrorMessage: message
         )
     }
+
+    /// Tightens the rate limiter for the response's host when the response indicates that the request is throttled, so
+    /// that the queued requests aren't sent before the throttling is lifted.
+    ///
+    /// 429 responses are skipped: `URLSession.perform` has already throttled their host, using their `Retry-After`.
+    func tightenRateLimiter(afterThrottledResponse response: HTTPURLResponse, body: Data) {
+        guard let rateLimiter, response.statusCode != 429, let url = response.url,
+              let delay = Self.throttlingDelay(response: response, data: body) else {
+            return
+        }
+        rateLimiter.throttle(url, for: delay)
+    }
+
+    /// Returns how long to wait before sending the request again, if the response indicates that the request is throttled.
+    static func throttlingDelay(response: HTTPURLResponse, data: Data) -> TimeInterval? {
+        // This endpoint is throttled, so check if we've sent too many requests and fill that error in as
+        // when too many requests occur the API just spits out an html page, which asks to try again in 1 minute.
+        guard let responseString = String(data: data, encoding: .utf8),
+            responseString.contains("Limit reached") else {
+                return nil
+        }
+        return 60
+    }
 }
 // MARK: - Anonymous API support
 
@@ -668,9 +1026,71 @@ extension WordPressComRestApi: WordPressComRESTAPIInterfacing {
             URLString,
             parameters: parameters,
             fileParts: fileParts,
+            priority: .default,
+            requestEnqueued: requestEnqueued,
+            success: success,
+            failure: failure
+        )
+    }
+
+    public func multipartPOST(
+        _ URLString: String,
+        parameters: [String: NSObject]?,
+        fileParts: [FilePart],
+        priority: HTTPRequestPriority,
+        requestEnqueued: ((NSNumber) -> Void)?,
+        success: @escaping (Any, HTTPURLResponse?) -> Void,
+        failure: @escaping (any Error, HTTPURLResponse?) -> Void
+    ) -> Progress? {
+        multipartPOST(
+            URLString,
+            parameters: parameters,
+            fileParts: fileParts,
+            priority: priority,
             requestEnqueued: requestEnqueued,
             success: success as SuccessResponseBlock,
             failure: failure as FailureReponseBlock
         )
     }
 }
+
+/// Caches the slug of the device language, which is appended to requests as their locale.
+///
+/// `WordPressComLanguageDatabase` loads its list of languages every time it's created, which is too expensive to do for
+/// every request. The cached slug is discarded when the current locale changes.
+private final class PreferredLanguageCache {
+    private let lock = NSLock()
+    private var cached: String?
+    private var observer: NSObjectProtocol?
+
+    init() {
+        observer = NotificationCenter.default.addObserver(forName: NSLocale.currentLocaleDidChangeNotification, object: nil, queue: nil) { [weak self] _ in
+            self?.invalidate()
+        }
+    }
+
+    deinit {
+        if let observer {
+            NotificationCenter.default.removeObserver(observer)
+        }
+    }
+
+    var identifier: String {
+        lock.lock()
+        defer { lock.unlock() }
+
+        if let cached {
+            return cached
+        }
+
+        let identifier = WordPressComLanguageDatabase().deviceLanguage.slug
+        cached = identifier
+        return identifier
+    }
+
+    func invalidate() {
+        lock.lock()
+        cached = nil
+        lock.unlock()
+    }
+}
@@ -1,3 +1,6 @@
+#if SWIFT_PACKAGE
+import APIInterface
+#endif
 import Foundation
 import WordPressShared
 
@@ -50,6 +53,36 @@ public final class WordPressOrgRestApi: NSObject {
 
     var selfHostedSiteNonce: String?
 
+    /// A cache that's used to send conditional GET requests, so that unchanged responses are not downloaded again.
+    /// Defaults to nil, which disables the caching.
+    public var responseCache: HTTPResponseCache?
+
+    /// The retry policy of the requests that don't specify their own. Defaults to `HTTPRetryPolicy.none`, which
+    /// disables retries.
+    public var retryPolicy: HTTPRetryPolicy {
+        get { retrier.policy }
+        set { retrier.policy = newValue }
+    }
+
+    /// Counters of the retries that are made according to `retryPolicy`, or the requests' own policies.
+    public var retryStatistics: HTTPRequestRetrier.Statistics {
+        retrier.statistics
+    }
+
+    /// A rate limiter that requests wait on before they are sent. It can be shared with other API instances. Defaults
+    /// to nil, which disables the rate limiting.
+    public var rateLimiter: HTTPRateLimiter?
+
+    /// An observer that collects the network metrics of the requests. It can be shared with other API instances.
+    /// Defaults to nil, which disables the collection.
+    public var metricsObserver: HTTPMetricsObserver?
+
+    /// A scheduler that limits the number of in-flight requests, and sends the queued requests in the order of their
+    /// priority. It can be shared with other API instances. Defaults to nil, which sends all requests right away.
+    public var scheduler: HTTPRequestScheduler?
+
+    private let retrier = HTTPRequestRetrier()
+
     public convenience init(dotComSiteID: UInt64, bearerToken: String, userAgent: String? = nil, apiURL: URL = WordPressComRestApi.apiBaseURL) {
         self.init(site: .dotCom(siteID: dotComSiteID, bearerToken: bearerToken, apiURL: apiURL), userAgent: userAgent)
     }
@@ -75,7 +108,7 @@ public final class WordPressOrgRestApi: NSObject {
 
         let configuration = URLSessionConfiguration.default
         configuration.httpAdditionalHeaders = additionalHeaders
-        urlSession = URLSession(configuration: configuration)
+        urlSession = URLSession(configuration: configuration, delegate: BodyStreamURLSessionDelegate(), delegateQueue: nil)
     }
 
     deinit {
@@ -91,34 +124,38 @@ public final class WordPressOrgRestApi: NSObject {
         path: String,
         parameters: [String: Any]? = nil,
         jsonDecoder: JSONDecoder = JSONDecoder(),
-        type: Success.Type = Success.self
+        type: Success.Type = Success.self,
+        priority: HTTPRequestPriority = .default
     ) async -> WordPressAPIResult<Success, WordPressOrgRestApiError> {
-        await perform(.get, path: path, parameters: parameters, jsonDecoder: jsonDecoder, type: type)
+        await perform(.get, path: path, parameters: parameters, jsonDecoder: jsonDecoder, type: type, priority: priority)
     }
 
     public func get(
         path: String,
         parameters: [String: Any]? = nil,
-        options: JSONSerialization.ReadingOptions = []
+        options: JSONSerialization.ReadingOptions = [],
+        priority: HTTPRequestPriority = .default
     ) async -> WordPressAPIResult<Any, WordPressOrgRestApiError> {
-        await perform(.get, path: path, parameters: parameters, options: options)
+        await perform(.get, path: path, parameters: parameters, options: options, priority: priority)
     }
 
     public func post<Success: Decodable>(
         path: String,
         parameters: [String: Any]? = nil,
         jsonDecoder: JSONDecoder = JSONDecoder(),
-        type: Success.Type = Success.self
+        type: Success.Type = Success.self,
+        priority: HTTPRequestPriority = .default
     ) async -> WordPressAPIResult<Success, WordPressOrgRestApiError> {
-        await perform(.post, path: path, parameters: parameters, jsonDecoder: jsonDecoder, type: type)
+        await perform(.post, path: path, parameters: parameters, jsonDecoder: jsonDecoder, type: type, priority: priority)
     }
 
     public func post(
         path: String,
         parameters: [String: Any]? = nil,
-        options: JSONSerialization.ReadingOptions = []
+        options: JSONSerialization.ReadingOptions = [],
+        priority: HTTPRequestPriority = .default
     ) async -> WordPressAPIResult<Any, WordPressOrgRestApiError> {
-        await perform(.post, path: path, parameters: parameters, options: options)
+        await perform(.post, path: path, parameters: parameters, options: options, priority: priority)
     }
 
     func perform<Success: Decodable>(
@@ -126,9 +163,10 @@ public final class WordPressOrgRestApi: NSObject {
         path: String,
         parameters: [String: Any]? = nil,
         jsonDecoder: JSONDecoder = JSONDecoder(),
-        type: Success.Type = Success.self
+        type: Success.Type = Success.self,
+        priority: HTTPRequestPriority = .default
     ) async -> WordPressAPIResult<Success, WordPressOrgRestApiError> {
-        await perform(method, path: path, parameters: parameters) {
+        await perform(method, path: path, parameters: parameters, priority: priority) {
             try jsonDecoder.decode(type, from: $0)
         }
     }
@@ -137,9 +175,10 @@ public final class WordPressOrgRestApi: NSObject {
         _ method: HTTPRequestBuilder.Method,
         path: String,
         parameters: [String: Any]? = nil,
-        options: JSONSerialization.ReadingOptions = []
+        options: JSONSerialization.ReadingOptions = [],
+        priority: HTTPRequestPriority = .default
     ) async -> WordPressAPIResult<Any, WordPressOrgRestApiError> {
-        await perform(method, path: path, parameters: parameters) {
+        await perform(method, path: path, parameters: parameters, priority: priority) {
             try JSONSerialization.jsonObject(with: $0, options: options)
         }
     }
@@ -148,6 +187,7 @@ public final class WordPressOrgRestApi: NSObject {
         _ method: HTTPRequestBuilder.Method,
         path: String,
         parameters: [String: Any]? = nil,
+        priority: HTTPRequestPriority,
         decoder: @escaping (Data) throws -> Success
     ) async -> WordPressAPIResult<Success, WordPressOrgRestApiError> {
         var builder = HTTPRequestBuilder(url: apiBaseURL())
@@ -159,18 +199,36 @@ public final class WordPressOrgRestApi: NSObject {
             builder = builder.query(parameters ?? [:])
         }
 
-        return await perform(builder: builder)
-            .mapSuccess { try decoder($0.body) }
+        return await perform(builder: builder, priority: priority)
+            .mapSuccess { response in
+                try RequestPhaseTimer.measure(.decode, endpoint: builder.endpointTemplate, size: { _ in response.body.count }) {
+                    try decoder(response.body)
+                }
+            }
     }
 
-    func perform(builder originalBuilder: HTTPRequestBuilder) async -> WordPressAPIResult<HTTPAPIResponse<Data>, WordPressOrgRestApiError> {
+    func perform(
+        builder originalBuilder: HTTPRequestBuilder,
+        retryPolicy: HTTPRetryPolicy? = nil,
+        priority: HTTPRequestPriority = .default
+    ) async -> WordPressAPIResult<HTTPAPIResponse<Data>, WordPressOrgRestApiError> {
         var builder = originalBuilder
 
         if case .selfHosted = site, let nonce = selfHostedSiteNonce {
             builder = originalBuilder.header(name: "X-WP-Nonce", value: nonce)
         }
 
-        var result = await urlSession.perform(request: builder, errorType: WordPressOrgRestApiError.self)
+        var result = await urlSession.perform(
+            request: builder,
+            errorType: WordPressOrgRestApiError.self,
+            cache: responseCache,
+            retrier: retrier,
+            retryPolicy: retryPolicy,
+            rateLimiter: rateLimiter,
+            scheduler: scheduler,
+            priority: priority,
+            metricsObserver: metricsObserver
+        )
 
         // When a self hosted site request fails with 401, authenticate and retry the request.
         if case .selfHosted = site,
@@ -179,7 +237,17 @@ public final class WordPressOrgRestApi: NSObject {
             await refreshNonce(),
             let nonce = selfHostedSiteNonce {
             builder = originalBuilder.header(name: "X-WP-Nonce", value: nonce)
-            result = await urlSession.perform(request: builder, errorType: WordPressOrgRestApiError.self)
+            result = await urlSession.perform(
+                request: builder,
+                errorType: WordPressOrgRestApiError.self,
+                cache: responseCache,
+                retrier: retrier,
+                retryPolicy: retryPolicy,
+                rateLimiter: rateLimiter,
+                scheduler: scheduler,
+                priority: priority,
+                metricsObserver: metricsObserver
+            )
         }
 
         return result
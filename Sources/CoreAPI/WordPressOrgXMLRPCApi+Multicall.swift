@@ -0,0 +1,193 @@
+import Foundation
+
+/// An XMLRPC method call that can be sent as part of a `system.multicall` request.
+///
+/// See `WordPressOrgXMLRPCApi.callMethods(_:)`.
+@objc public final class WordPressOrgXMLRPCApiMethodCall: NSObject {
+    @objc public let method: String
+    @objc public let parameters: [AnyObject]?
+
+    @objc public let success: WordPressOrgXMLRPCApi.SuccessResponseBlock
+    @objc public let failure: WordPressOrgXMLRPCApi.FailureReponseBlock
+
+    @objc public init(
+        method: String,
+        parameters: [AnyObject]?,
+        success: @escaping WordPressOrgXMLRPCApi.SuccessResponseBlock,
+        failure: @escaping WordPressOrgXMLRPCApi.FailureReponseBlock
+    ) {
+        self.method = method
+        self.parameters = parameters
+        self.success = success
+        self.failure = failure
+    }
+}
+
+extension WordPressOrgXMLRPCApi {
+
+    /**
+     Executes the given XMLRPC calls in one `system.multicall` request.
+
+     Each call's `success` or `failure` callback is called with its own result, as if the call was made using the
+     `callMethod` function. If the site doesn't support `system.multicall`, the calls are made one after another. If
+     the `system.multicall` request fails otherwise, every call fails with its error.
+
+     - parameter calls: the XMLRPC calls to be executed
+
+     - returns: a `Progress` object that's completed once all calls complete.
+     */
+    @objc @discardableResult open func callMethods(_ calls: [WordPressOrgXMLRPCApiMethodCall]) -> Progress? {
+        let progress = Progress.discreteProgress(totalUnitCount: 100)
+
+        Task { @MainActor in
+            let results = await self.multicall(
+                calls.map { (method: $0.method, parameters: $0.parameters) },
+                fulfilling: progress
+            )
+
+            for (call, result) in zip(calls, results) {
+                switch result {
+                case let .success(response):
+                    call.success(response.body, response.response)
+                case let .failure(error):
+                    call.failure(error.asNSError(), error.response)
+                }
+            }
+        }
+
+        return progress
+    }
+
+    /// Call several XMLRPC methods in one `system.multicall` request.
+    ///
+    /// The fault of an individual call is returned as that call's `WordPressOrgXMLRPCApiFault`, which means one failed
+    /// call doesn't fail the others.
+    ///
+    /// The calls are made sequentially instead, if the site doesn't support `system.multicall`. Any other failure of
+    /// the `system.multicall` request, like an authentication fault, is returned as the result of every call.
+    ///
+    /// - Parameters:
+    ///   - calls: The methods and parameters of the XMLRPC calls.
+    ///   - progress: A `Progress` instance that tracks the overall progress of all calls, and cancels them when it's
+    ///         cancelled. It has the same requirements as the `URLSession.perform` function's.
+    /// - Returns: The results of the calls, in the same order as `calls`.
+    func multicall(
+        _ calls: [(method: String, parameters: [AnyObject]?)],
+        fulfilling progress: Progress? = nil
+    ) async -> [WordPressAPIResult<HTTPAPIResponse<AnyObject>, WordPressOrgXMLRPCApiFault>] {
+        guard calls.count > 1, supportsMulticall else {
+            return await callSequentially(calls, fulfilling: progress)
+        }
+
+        let parameters = calls.map { call -> AnyObject in
+            ["methodName": call.method, "params": call.parameters ?? []] as NSDictionary
+        }
+
+        // The request fulfills a child of `progress`, so that the sequential calls can add theirs if the site doesn't
+        // support `system.multicall`.
+        progress?.totalUnitCount = Int64(calls.count)
+        let multicallProgress = Self.makeChild(of: progress, pendingUnitCount: Int64(calls.count))
+        let result = await send(method: "system.multicall", parameters: [parameters as NSArray], fulfilling: multicallProgress)
+
+        let response: HTTPAPIResponse<Data>
+        switch result {
+        case let .success(success):
+            response = success
+        case let .failure(error):
+            // The request never reached the site, which means the individual calls would fail the same way.
+            return calls.map { _ in .failure(error) }
+        }
+
+        if Self.isMethodNotFoundFault(response) {
+            supportsMulticall = false
+            return await callSequentially(calls, fulfilling: progress)
+        }
+
+        guard let results = Self.multicallResults(from: response, count: calls.count) else {
+            // Other failures, like an authentication fault or a temporary server error, would fail the individual
+            // calls too, so they're not repeated. They don't mean that the site doesn't support multicall either, so
+            // it's used again for the next calls.
+            let error: WordPressAPIError<WordPressOrgXMLRPCApiFault>
+            switch WordPressAPIResult<HTTPAPIResponse<Data>, WordPressOrgXMLRPCApiFault>.success(response).decodeXMLRPCResult() {
+            case let .failure(failure):
+                error = failure
+            case .success:
+                error = .unparsableResponse(response: response.response, body: response.body)
+            }
+            return calls.map { _ in .failure(error) }
+        }
+
+        return results
+    }
+
+    private func callSequentially(
+        _ calls: [(method: String, parameters: [AnyObject]?)],
+        fulfilling progress: Progress?
+    ) async -> [WordPressAPIResult<HTTPAPIResponse<AnyObject>, WordPressOrgXMLRPCApiFault>] {
+        // Each call fulfills a child of `progress`, so that cancelling `progress` cancels the call that's in flight. The
+        // units of the calls are added to the units of the `system.multicall` request, if it's sent before.
+        progress?.totalUnitCount = (progress?.completedUnitCount ?? 0) + Int64(calls.count)
+
+        var results = [WordPressAPIResult<HTTPAPIResponse<AnyObject>, WordPressOrgXMLRPCApiFault>]()
+        for call in calls {
+            if progress?.isCancelled == true {
+                results.append(.failure(.connection(URLError(.cancelled))))
+                continue
+            }
+            let callProgress = Self.makeChild(of: progress, pendingUnitCount: 1)
+            results.append(await self.call(method: call.method, parameters: call.parameters, fulfilling: callProgress))
+        }
+
+        progress?.completedUnitCount = progress?.totalUnitCount ?? 0
+
+        return results
+    }
+
+    private static func makeChild(of progress: Progress?, pendingUnitCount: Int64) -> Progress? {
+        guard let progress else { return nil }
+        let child = Progress.discreteProgress(totalUnitCount: 100)
+        progress.addChild(child, withPendingUnitCount: pendingUnitCount)
+        return child
+    }
+
+    /// Whether the response is the fault that XML-RPC servers return for a method that doesn't exist, which is how a
+    /// site that doesn't support `system.multicall` responds.
+    static func isMethodNotFoundFault(_ response: HTTPAPIResponse<Data>) -> Bool {
+        guard case let .failure(.endpointError(fault)) = WordPressAPIResult<HTTPAPIResponse<Data>, WordPressOrgXMLRPCApiFault>.success(response).decodeXMLRPCResult() else {
+            return false
+        }
+        return fault.code == -32601
+    }
+
+    /// Split a `system.multicall` response into the results of its calls. `nil` if the response isn't a valid
+    /// `system.multicall` response, i.e. the site doesn't support `system.multicall`.
+    ///
+    /// Each item in a `system.multicall` response is either an one-element array that contains the call's return value,
+    /// or a fault struct.
+    static func multicallResults(
+        from response: HTTPAPIResponse<Data>,
+        count: Int
+    ) -> [WordPressAPIResult<HTTPAPIResponse<AnyObject>, WordPressOrgXMLRPCApiFault>]? {
+        guard case let .success(decoded) = WordPressAPIResult<HTTPAPIResponse<Data>, WordPressOrgXMLRPCApiFault>.success(response).decodeXMLRPCResult(),
+              let items = decoded.body as? [AnyObject],
+              items.count == count
+        else {
+            return nil
+        }
+
+        return items.map { item in
+            if let values = item as? [AnyObject], values.count == 1 {
+                return .success(HTTPAPIResponse(response: response.response, body: values[0]))
+            }
+
+            if let fault = item as? [String: AnyObject], fault["faultCode"] != nil {
+                let code = (fault["faultCode"] as? NSNumber)?.intValue ?? Int(fault["faultCode"] as? String ?? "")
+                let message = fault["faultString"] as? String
+                return .failure(.endpointError(.init(response: response, code: code, message: message)))
+            }
+
+            return .failure(.unparsableResponse(response: response.response, body: response.body))
+        }
+    }
+
+}
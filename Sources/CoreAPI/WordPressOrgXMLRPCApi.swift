@@ -55,6 +55,28 @@ open class WordPressOrgXMLRPCApi: NSObject {
     private let sessionDelegate = SessionDelegate()
     // swiftlint:enable weak_delegate
 
+    /// An observer that collects the network metrics of the requests. It can be shared with other API instances.
+    /// Defaults to nil, which disables the collection.
+    public var metricsObserver: HTTPMetricsObserver?
+
+    /// Whether the site may support `system.multicall`. It's set to false once the site responds that the method
+    /// doesn't exist. It's read and written by concurrent requests.
+    var supportsMulticall: Bool {
+        get {
+            multicallLock.lock()
+            defer { multicallLock.unlock() }
+            return _supportsMulticall
+        }
+        set {
+            multicallLock.lock()
+            defer { multicallLock.unlock() }
+            _supportsMulticall = newValue
+        }
+    }
+
+    private let multicallLock = NSLock()
+    private var _supportsMulticall = true
+
     /// Creates a new API object to connect to the WordPress XMLRPC API for the specified endpoint.
     ///
     /// - Parameters:
@@ -169,6 +191,40 @@ open class WordPressOrgXMLRPCApi: NSObject {
         return progress
     }
 
+    /**
+     Executes a XMLRPC call whose response is an array, and passes the array elements to the `element` callback one at a
+     time, as the response is being downloaded.
+
+     Only one array element is kept in memory at a time, which makes this method suitable for methods that may return a
+     large number of items, like `wp.getPosts` and `wp.getMediaLibrary`.
+
+     - parameter method:  the xmlrpc method to be invoked
+     - parameter parameters: the parameters to be encoded on the request
+     - parameter element:    callback to be called with each element of the response array, on a background queue.
+                             `success` and `failure` are called on the main queue.
+     - parameter success:    callback to be called on successful request, after all elements are passed to `element`
+     - parameter failure:    callback to be called on failed request
+
+     - returns:  a NSProgress object that can be used to track the progress of the request and to cancel the request.
+     */
+    @objc @discardableResult open func callMethod(_ method: String,
+                           parameters: [AnyObject]?,
+                           element: @escaping (AnyObject) -> Void,
+                           success: @escaping (HTTPURLResponse?) -> Void,
+                           failure: @escaping FailureReponseBlock) -> Progress? {
+        let progress = Progress.discreteProgress(totalUnitCount: 100)
+        Task { @MainActor in
+            let result = await self.call(method: method, parameters: parameters, fulfilling: progress, forEachElement: element)
+            switch result {
+            case let .success(response):
+                success(response.response)
+            case let .failure(error):
+                failure(error.asNSError(), error.response)
+            }
+        }
+        return progress
+    }
+
     /// Call an XMLRPC method.
     ///
     /// ## Error handling
@@ -181,6 +237,44 @@ open class WordPressOrgXMLRPCApi: NSObject {
     ///   - streaming: set to `true` if there are large data (i.e. uploading files) in given `parameters`. `false` by default.
     /// - Returns: A `Result` type that contains the XMLRPC success or failure result.
     func call(method: String, parameters: [AnyObject]?, fulfilling progress: Progress? = nil, streaming: Bool = false) async -> WordPressAPIResult<HTTPAPIResponse<AnyObject>, WordPressOrgXMLRPCApiFault> {
+        let response = await send(method: method, parameters: parameters, fulfilling: progress, streaming: streaming)
+        return RequestPhaseTimer.measure(.decode, endpoint: "XMLRPC \(method)", size: { _ in (try? response.get().body.count) ?? 0 }) {
+            response.decodeXMLRPCResult()
+        }
+    }
+
+    /// Call an XMLRPC method whose response is an array, and decode the array elements as the response is being
+    /// downloaded.
+    ///
+    /// - Parameters:
+    ///   - element: Called with each element of the response array, serially on the session's delegate queue.
+    /// - Returns: The number of elements in the response array, or the XMLRPC failure result. A response that's not
+    ///     an array is returned as `WordPressAPIError.unparsableResponse`.
+    func call(
+        method: String,
+        parameters: [AnyObject]?,
+        fulfilling progress: Progress? = nil,
+        forEachElement element: @escaping (AnyObject) -> Void
+    ) async -> WordPressAPIResult<HTTPAPIResponse<Int>, WordPressOrgXMLRPCApiFault> {
+        let builder = HTTPRequestBuilder(url: endpoint)
+            .method(.post)
+            .body(xmlrpc: method, parameters: parameters)
+        let body = StreamingXMLRPCResponse(element: element)
+        let result = await urlSession
+            .stream(request: builder, fulfilling: progress, errorType: WordPressOrgXMLRPCApiFault.self, metricsObserver: metricsObserver) { response, data in
+                body.append(data, response: response)
+            }
+        // The response is finished on the delegate queue too, so that the elements of a buffered response are passed
+        // to `element` on the same queue as the streamed ones, instead of the caller's executor.
+        return await withCheckedContinuation { continuation in
+            urlSession.delegateQueue.addOperation {
+                continuation.resume(returning: result.flatMap { body.finish(response: $0) })
+            }
+        }
+    }
+
+    /// Send an XMLRPC request and return its raw response, which can be decoded using `decodeXMLRPCResult`.
+    func send(method: String, parameters: [AnyObject]?, fulfilling progress: Progress? = nil, streaming: Bool = false) async -> WordPressAPIResult<HTTPAPIResponse<Data>, WordPressOrgXMLRPCApiFault> {
         let session = streaming ? uploadURLSession : urlSession
         let builder = HTTPRequestBuilder(url: endpoint)
             .method(.post)
@@ -191,9 +285,9 @@ open class WordPressOrgXMLRPCApi: NSObject {
                 // All HTTP responses are treated as successful result. Error handling will be done in `decodeXMLRPCResult`.
                 acceptableStatusCodes: [1...999],
                 fulfilling: progress,
-                errorType: WordPressOrgXMLRPCApiFault.self
+                errorType: WordPressOrgXMLRPCApiFault.self,
+                metricsObserver: metricsObserver
             )
-            .decodeXMLRPCResult()
     }
 
     @objc public static let WordPressOrgXMLRPCApiErrorKeyData: NSError.UserInfoKey = "WordPressOrgXMLRPCApiErrorKeyData"
@@ -222,7 +316,7 @@ open class WordPressOrgXMLRPCApi: NSObject {
     }
 }
 
-private class SessionDelegate: NSObject, URLSessionDelegate {
+private class SessionDelegate: StreamingURLSessionDelegate {
 
     @objc func urlSession(
         _ session: URLSession,
@@ -320,6 +414,85 @@ extension WordPressOrgXMLRPCApiError: LocalizedError {
     }
 }
 
+/// Decodes a streamed XMLRPC response using `XMLRPCStreamingDecoder`.
+///
+/// Error responses are kept in memory and decoded using `decodeXMLRPCResult`, so that they are handled the same way as
+/// non-streamed responses.
+private final class StreamingXMLRPCResponse {
+    // The amount of response data that's kept for error reporting.
+    private static let maxBufferedDataSize = 64 * 1024
+
+    private let element: (AnyObject) -> Void
+    private let decoder: XMLRPCStreamingDecoder
+    private var isStreaming: Bool?
+    private var decodingError: Error?
+    private var buffered = Data()
+
+    init(element: @escaping (AnyObject) -> Void) {
+        self.element = element
+        self.decoder = XMLRPCStreamingDecoder(element: element)
+    }
+
+    func append(_ data: Data, response: HTTPURLResponse) {
+        if isStreaming == nil {
+            let contentType = response.allHeaderFields["Content-Type"] as? String ?? ""
+            isStreaming = !(400..<600).contains(response.statusCode)
+                && (contentType.hasPrefix("application/xml") || contentType.hasPrefix("text/xml"))
+        }
+
+        guard isStreaming == true else {
+            buffered.append(data)
+            return
+        }
+
+        if buffered.count < Self.maxBufferedDataSize {
+            buffered.append(data.prefix(Self.maxBufferedDataSize - buffered.count))
+        }
+
+        guard decodingError == nil else { return }
+
+        do {
+            try decoder.append(data)
+        } catch {
+            decodingError = error
+        }
+    }
+
+    func finish(response: HTTPURLResponse) -> WordPressAPIResult<HTTPAPIResponse<Int>, WordPressOrgXMLRPCApiFault> {
+        guard isStreaming == true else {
+            return WordPressAPIResult<HTTPAPIResponse<Data>, WordPressOrgXMLRPCApiFault>
+                .success(HTTPAPIResponse(response: response, body: buffered))
+                .decodeXMLRPCResult()
+                .flatMap { decoded in
+                    guard let elements = decoded.body as? [AnyObject] else {
+                        return .failure(.unparsableResponse(response: response, body: buffered))
+                    }
+                    elements.forEach(element)
+                    return .success(HTTPAPIResponse(response: response, body: elements.count))
+                }
+        }
+
+        let decoded: XMLRPCStreamingDecoder.Response
+        do {
+            if let decodingError {
+                throw decodingError
+            }
+            decoded = try decoder.finish()
+        } catch {
+            return .failure(.unparsableResponse(response: response, body: buffered, underlyingError: error))
+        }
+
+        switch decoded {
+        case let .elements(count):
+            return .success(HTTPAPIResponse(response: response, body: count))
+        case let .fault(code, message):
+            return .failure(.endpointError(.init(response: HTTPAPIResponse(response: response, body: buffered), code: code, message: message)))
+        case .value:
+            return .failure(.unparsableResponse(response: response, body: buffered))
+        }
+    }
+}
+
 public struct WordPressOrgXMLRPCApiFault: LocalizedError, HTTPURLResponseProviding {
     public var response: HTTPAPIResponse<Data>
     public let code: Int?
@@ -340,7 +513,7 @@ public struct WordPressOrgXMLRPCApiFault: LocalizedError, HTTPURLResponseProvidi
     }
 }
 
-private extension WordPressAPIResult<HTTPAPIResponse<Data>, WordPressOrgXMLRPCApiFault> {
+extension WordPressAPIResult<HTTPAPIResponse<Data>, WordPressOrgXMLRPCApiFault> {
 
     func decodeXMLRPCResult() -> WordPressAPIResult<HTTPAPIResponse<AnyObject>, WordPressOrgXMLRPCApiFault> {
         // This is a re-implementation of `WordPressOrgXMLRPCApi.handleResponseWithData` function:
@@ -386,7 +559,7 @@ private extension WordPressAPIResult<HTTPAPIResponse<Data>, WordPressOrgXMLRPCAp
 
 }
 
-private extension WordPressAPIError where EndpointError == WordPressOrgXMLRPCApiFault {
+extension WordPressAPIError where EndpointError == WordPressOrgXMLRPCApiFault {
 
     /// Convert to NSError for backwards compatiblity.
     ///
@@ -0,0 +1,390 @@
+import Foundation
+
+/// Decodes an XML-RPC response incrementally, as its data is being downloaded.
+///
+/// Unlike `WPXMLRPCDecoder`, which requires the whole response data upfront, this decoder takes the response in chunks.
+/// When the response is an array, its elements are passed to the `element` closure as soon as each of them is decoded,
+/// and then released. That means only one array element is kept in memory at a time, regardless of the response size.
+///
+/// The decoded values have the same types as `WPXMLRPCDecoder`'s: `NSDictionary`, `NSArray`, `String`, `NSNumber`,
+/// `Date`, `Data` and `NSNull`.
+final class XMLRPCStreamingDecoder {
+
+    enum Response {
+        /// The response is an array. Its elements have been passed to the `element` closure.
+        case elements(count: Int)
+        /// The response is a non-array value, or an array when there is no `element` closure.
+        case value(AnyObject)
+        case fault(code: Int?, message: String?)
+    }
+
+    enum DecodingError: Error {
+        case invalidXML
+        case missingValue
+    }
+
+    private final class Container {
+        let isStruct: Bool
+        let isStreamed: Bool
+        let array = NSMutableArray()
+        let dictionary = NSMutableDictionary()
+        var memberName: String?
+        var count = 0
+
+        init(isStruct: Bool, isStreamed: Bool) {
+            self.isStruct = isStruct
+            self.isStreamed = isStreamed
+        }
+    }
+
+    private static let textElements: Set<String> = [
+        "value", "name", "string", "int", "i4", "i8", "boolean", "double", "dateTime.iso8601", "base64", "nil"
+    ]
+
+    private let element: ((AnyObject) -> Void)?
+
+    private var buffer = [UInt8]()
+    private var searchStart = 0
+
+    private var elements = [String]()
+    private var containers = [Container]()
+    // The values decoded from the typed child elements of the open `value` elements.
+    private var values = [AnyObject?]()
+    private var text = [UInt8]()
+
+    private var rootValue: AnyObject?
+    private var streamedCount: Int?
+    private var isFault = false
+
+    /// - Parameter element: The closure that's called with each element when the response is an array. Pass `nil` to
+    ///     decode the whole response into one value.
+    init(element: ((AnyObject) -> Void)?) {
+        self.element = element
+    }
+
+    /// Decode the next chunk of the response.
+    func append(_ data: Data) throws {
+        buffer.append(contentsOf: data)
+
+        var position = 0
+        defer {
+            buffer.removeFirst(position)
+            searchStart = max(0, searchStart - position)
+        }
+
+        while position < buffer.count {
+            if buffer[position] != UInt8(ascii: "<") {
+                guard let end = firstIndex(of: UInt8(ascii: "<"), from: max(position, searchStart)) else {
+                    // Keep the text in the buffer, since it may be followed by more text.
+                    searchStart = buffer.count
+                    return
+                }
+                handleText(buffer[position..<end])
+                position = end
+                continue
+            }
+
+            let remaining = buffer[position...]
+            let terminator: [UInt8]
+            if remaining.starts(with: Self.commentStart) {
+                terminator = Self.commentEnd
+            } else if remaining.starts(with: Self.cdataStart) {
+                terminator = Self.cdataEnd
+            } else if Self.commentStart.starts(with: remaining) || Self.cdataStart.starts(with: remaining) {
+                // Wait for more data to find out whether it's a comment or CDATA section.
+                return
+            } else {
+                terminator = [UInt8(ascii: ">")]
+            }
+
+            guard let end = firstIndex(of: terminator, from: max(position + 1, searchStart)) else {
+                searchStart = max(position + 1, buffer.count - terminator.count + 1)
+                return
+            }
+
+            try handleMarkup(buffer[position..<(end + terminator.count)])
+            position = end + terminator.count
+            searchStart = position
+        }
+    }
+
+    /// Finish decoding, after all response data is passed to `append`.
+    func finish() throws -> Response {
+        guard elements.isEmpty, buffer.allSatisfy(Self.isWhitespace) else {
+            throw DecodingError.invalidXML
+        }
+
+        if isFault {
+            guard let fault = rootValue as? [String: AnyObject] else {
+                throw DecodingError.missingValue
+            }
+            let code = fault["faultCode"] as? NSNumber
+            return .fault(code: code?.intValue, message: fault["faultString"] as? String)
+        }
+
+        if let streamedCount {
+            return .elements(count: streamedCount)
+        }
+
+        guard let rootValue else {
+            throw DecodingError.missingValue
+        }
+        return .value(rootValue)
+    }
+
+    // MARK: - Tokens
+
+    private static let commentStart = Array("<!--".utf8)
+    private static let commentEnd = Array("-->".utf8)
+    private static let cdataStart = Array("<![CDATA[".utf8)
+    private static let cdataEnd = Array("]]>".utf8)
+
+    private func handleText(_ bytes: ArraySlice<UInt8>) {
+        guard let current = elements.last, Self.textElements.contains(current) else {
+            return
+        }
+        text.append(contentsOf: bytes)
+    }
+
+    private func handleMarkup(_ markup: ArraySlice<UInt8>) throws {
+        if markup.starts(with: Self.cdataStart) {
+            let content = markup.dropFirst(Self.cdataStart.count).dropLast(Self.cdataEnd.count)
+            // Escape the content, since the text is unescaped once the element ends.
+            handleText(ArraySlice(Array(String(decoding: content, as: UTF8.self).xmlEscaped.utf8)))
+            return
+        }
+
+        let second = markup.dropFirst().first
+        // Skip comments, processing instructions (i.e. the XML declaration) and DTD.
+        if second == UInt8(ascii: "!") || second == UInt8(ascii: "?") {
+            return
+        }
+
+        var tag = markup.dropFirst().dropLast()
+        if tag.first == UInt8(ascii: "/") {
+            try endElement(Self.name(of: tag.dropFirst()))
+            return
+        }
+
+        let isEmptyElement = tag.last == UInt8(ascii: "/")
+        if isEmptyElement {
+            tag = tag.dropLast()
+        }
+
+        let name = Self.name(of: tag)
+        try startElement(name)
+        if isEmptyElement {
+            try endElement(name)
+        }
+    }
+
+    private static func name(of tag: ArraySlice<UInt8>) -> String {
+        String(decoding: tag.prefix(while: { !isWhitespace($0) }), as: UTF8.self)
+    }
+
+    // MARK: - Elements
+
+    private func startElement(_ name: String) throws {
+        if elements.isEmpty, name != "methodResponse" {
+            throw DecodingError.invalidXML
+        }
+
+        elements.append(name)
+        text.removeAll(keepingCapacity: true)
+
+        switch name {
+        case "value":
+            values.append(nil)
+        case "fault":
+            isFault = true
+        case "array":
+            let isStreamed = element != nil && containers.isEmpty && !isFault && values.count == 1
+            containers.append(Container(isStruct: false, isStreamed: isStreamed))
+        case "struct":
+            containers.append(Container(isStruct: true, isStreamed: false))
+        default:
+            break
+        }
+    }
+
+    private func endElement(_ name: String) throws {
+        guard elements.last == name else {
+            throw DecodingError.invalidXML
+        }
+        elements.removeLast()
+
+        switch name {
+        case "value":
+            guard let typedValue = values.popLast() else {
+                throw DecodingError.invalidXML
+            }
+            // A value without a type element is a string.
+            add(typedValue ?? textValue as NSString)
+        case "name":
+            containers.last?.memberName = textValue
+        case "array", "struct":
+            guard let container = containers.popLast() else {
+                throw DecodingError.invalidXML
+            }
+            if container.isStreamed {
+                streamedCount = container.count
+                setValue(NSArray())
+            } else {
+                setValue(container.isStruct ? container.dictionary : container.array)
+            }
+        case "string":
+            setValue(textValue as NSString)
+        case "int", "i4", "i8":
+            setValue(NSNumber(value: (textValue as NSString).longLongValue))
+        case "double":
+            setValue(NSNumber(value: (textValue as NSString).doubleValue))
+        case "boolean":
+            setValue(NSNumber(value: textValue.trimmingCharacters(in: .whitespacesAndNewlines) == "1"))
+        case "base64":
+            setValue((Data(base64Encoded: textValue, options: .ignoreUnknownCharacters) ?? Data()) as NSData)
+        case "dateTime.iso8601":
+            setValue(Self.date(from: textValue).map { $0 as NSDate } ?? NSNull())
+        case "nil":
+            setValue(NSNull())
+        default:
+            break
+        }
+
+        text.removeAll(keepingCapacity: true)
+    }
+
+    private var textValue: String {
+        let string = String(decoding: text, as: UTF8.self)
+        return string.contains("&") ? string.xmlUnescaped : string
+    }
+
+    private func setValue(_ value: AnyObject) {
+        guard !values.isEmpty else { return }
+        values[values.count - 1] = value
+    }
+
+    private func add(_ value: AnyObject) {
+        guard let container = containers.last else {
+            if values.isEmpty {
+                rootValue = value
+            }
+            return
+        }
+
+        if container.isStruct {
+            container.dictionary[container.memberName ?? ""] = value
+            container.memberName = nil
+        } else if container.isStreamed {
+            container.count += 1
+            element?(value)
+        } else {
+            container.array.add(value)
+        }
+    }
+
+    // MARK: - Helpers
+
+    private static let dateFormatters: [DateFormatter] = [
+        "yyyyMMdd'T'HH:mm:ss",
+        "yyyyMMdd'T'HH:mm:ssZ",
+        "yyyy-MM-dd'T'HH:mm:ssZ",
+        "yyyy-MM-dd'T'HH:mm:ss",
+    ].map { format in
+        let formatter = DateFormatter()
+        formatter.locale = Locale(identifier: "en_US_POSIX")
+        formatter.timeZone = TimeZone(secondsFromGMT: 0)
+        formatter.dateFormat = format
+        return formatter
+    }
+
+    private static func date(from string: String) -> Date? {
+        let string = string.trimmingCharacters(in: .whitespacesAndNewlines)
+        for formatter in dateFormatters {
+            if let date = formatter.date(from: string) {
+                return date
+            }
+        }
+        return nil
+    }
+
+    private static func isWhitespace(_ byte: UInt8) -> Bool {
+        byte == 0x20 || byte == 0x09 || byte == 0x0A || byte == 0x0D
+    }
+
+    private func firstIndex(of byte: UInt8, from start: Int) -> Int? {
+        buffer[start...].firstIndex(of: byte)
+    }
+
+    private func firstIndex(of pattern: [UInt8], from start: Int) -> Int? {
+        guard pattern.count > 1 else {
+            return firstIndex(of: pattern[0], from: start)
+        }
+
+        var index = start
+        while let candidate = firstIndex(of: pattern[0], from: index) {
+            guard candidate + pattern.count <= buffer.count else {
+                return nil
+            }
+            if buffer[candidate..<(candidate + pattern.count)].elementsEqual(pattern) {
+                return candidate
+            }
+            index = candidate + 1
+        }
+        return nil
+    }
+
+}
+
+private extension String {
+
+    var xmlEscaped: String {
+        replacingOccurrences(of: "&", with: "&amp;").replacingOccurrences(of: "<", with: "&lt;")
+    }
+
+    var xmlUnescaped: String {
+        var result = ""
+        result.reserveCapacity(utf8.count)
+
+        var remaining = self[...]
+        while let ampersand = remaining.firstIndex(of: "&") {
+            result += remaining[..<ampersand]
+            remaining = remaining[ampersand...]
+
+            guard let semicolon = remaining.firstIndex(of: ";") else {
+                break
+            }
+
+            let entity = remaining[remaining.index(after: ampersand)..<semicolon]
+            if let character = Self.character(forEntity: entity) {
+                result.append(character)
+            } else {
+                result += remaining[...semicolon]
+            }
+            remaining = remaining[remaining.index(after: semicolon)...]
+        }
+
+        result += remaining
+        return result
+    }
+
+    static func character(forEntity entity: Substring) -> Character? {
+        switch entity {
+        case "amp": return "&"
+        case "lt": return "<"
+        case "gt": return ">"
+        case "quot": return "\""
+        case "apos": return "'"
+        default:
+            let code: UInt32?
+            if entity.hasPrefix("#x") || entity.hasPrefix("#X") {
+                code = UInt32(entity.dropFirst(2), radix: 16)
+            } else if entity.hasPrefix("#") {
+                code = UInt32(entity.dropFirst())
+            } else {
+                code = nil
+            }
+            return code.flatMap(Unicode.Scalar.init).map(Character.init)
+        }
+    }
+
+}
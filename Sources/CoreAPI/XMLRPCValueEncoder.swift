@@ -0,0 +1,211 @@
+import Foundation
+
+/// Encodes `Encodable` values into the values that XML-RPC requests are made of: `NSDictionary`, `NSArray`, `String`,
+/// `NSNumber`, `Date` and `Data`.
+///
+/// The values are built in one pass, unlike encoding them into a property list and parsing it back, and they're the same
+/// as the property list's, i.e. a `URL` is encoded as a dictionary, like `PropertyListEncoder` does. XML-RPC has no
+/// null value, so encoding `nil` (other than by skipping it using `encodeIfPresent`) throws an error.
+struct XMLRPCValueEncoder {
+
+    func encode<T: Encodable>(_ value: T) throws -> Any {
+        try Self.box(value, codingPath: [])
+    }
+
+    fileprivate static func box<T: Encodable>(_ value: T, codingPath: [CodingKey]) throws -> Any {
+        switch value {
+        case let value as String:
+            return value
+        case let value as Date:
+            return value
+        case let value as Data:
+            return value
+        case let value as Bool:
+            return NSNumber(value: value)
+        case let value as NSNumber:
+            return value
+        default:
+            let encoder = ValueEncoder(codingPath: codingPath)
+            try value.encode(to: encoder)
+            return encoder.value ?? NSDictionary()
+        }
+    }
+
+    fileprivate static func nilError(codingPath: [CodingKey]) -> EncodingError {
+        EncodingError.invalidValue(
+            NSNull(),
+            EncodingError.Context(codingPath: codingPath, debugDescription: "XML-RPC doesn't support null values")
+        )
+    }
+}
+
+private final class ValueEncoder: Encoder {
+    let codingPath: [CodingKey]
+    let userInfo: [CodingUserInfoKey: Any] = [:]
+
+    private(set) var value: Any?
+    // Writes the value into its parent container, when the encoder is a super encoder.
+    private let commit: ((Any) -> Void)?
+
+    init(codingPath: [CodingKey], commit: ((Any) -> Void)? = nil) {
+        self.codingPath = codingPath
+        self.commit = commit
+    }
+
+    deinit {
+        commit?(value ?? NSDictionary())
+    }
+
+    func container<Key: CodingKey>(keyedBy type: Key.Type) -> KeyedEncodingContainer<Key> {
+        let dictionary = value as? NSMutableDictionary ?? NSMutableDictionary()
+        value = dictionary
+        return KeyedEncodingContainer(KeyedContainer(dictionary: dictionary, codingPath: codingPath))
+    }
+
+    func unkeyedContainer() -> UnkeyedEncodingContainer {
+        let array = value as? NSMutableArray ?? NSMutableArray()
+        value = array
+        return UnkeyedContainer(array: array, codingPath: codingPath)
+    }
+
+    func singleValueContainer() -> SingleValueEncodingContainer {
+        SingleValueContainer(encoder: self)
+    }
+
+    fileprivate func set(_ value: Any) {
+        self.value = value
+    }
+}
+
+private struct KeyedContainer<Key: CodingKey>: KeyedEncodingContainerProtocol {
+    let dictionary: NSMutableDictionary
+    let codingPath: [CodingKey]
+
+    mutating func encodeNil(forKey key: Key) throws {
+        throw XMLRPCValueEncoder.nilError(codingPath: codingPath + [key])
+    }
+
+    mutating func encode(_ value: Bool, forKey key: Key) throws { dictionary[key.stringValue] = NSNumber(value: value) }
+    mutating func encode(_ value: String, forKey key: Key) throws { dictionary[key.stringValue] = value }
+    mutating func encode(_ value: Double, forKey key: Key) throws { dictionary[key.stringValue] = NSNumber(value: value) }
+    mutating func encode(_ value: Float, forKey key: Key) throws { dictionary[key.stringValue] = NSNumber(value: value) }
+    mutating func encode(_ value: Int, forKey key: Key) throws { dictionary[key.stringValue] = NSNumber(value: value) }
+    mutating func encode(_ value: Int8, forKey key: Key) throws { dictionary[key.stringValue] = NSNumber(value: value) }
+    mutating func encode(_ value: Int16, forKey key: Key) throws { dictionary[key.stringValue] = NSNumber(value: value) }
+    mutating func encode(_ value: Int32, forKey key: Key) throws { dictionary[key.stringValue] = NSNumber(value: value) }
+    mutating func encode(_ value: Int64, forKey key: Key) throws { dictionary[key.stringValue] = NSNumber(value: value) }
+    mutating func encode(_ value: UInt, forKey key: Key) throws { dictionary[key.stringValue] = NSNumber(value: value) }
+    mutating func encode(_ value: UInt8, forKey key: Key) throws { dictionary[key.stringValue] = NSNumber(value: value) }
+    mutating func encode(_ value: UInt16, forKey key: Key) throws { dictionary[key.stringValue] = NSNumber(value: value) }
+    mutating func encode(_ value: UInt32, forKey key: Key) throws { dictionary[key.stringValue] = NSNumber(value: value) }
+    mutating func encode(_ value: UInt64, forKey key: Key) throws { dictionary[key.stringValue] = NSNumber(value: value) }
+
+    mutating func encode<T: Encodable>(_ value: T, forKey key: Key) throws {
+        dictionary[key.stringValue] = try XMLRPCValueEncoder.box(value, codingPath: codingPath + [key])
+    }
+
+    mutating func nestedContainer<NestedKey: CodingKey>(keyedBy keyType: NestedKey.Type, forKey key: Key) -> KeyedEncodingContainer<NestedKey> {
+        let nested = NSMutableDictionary()
+        dictionary[key.stringValue] = nested
+        return KeyedEncodingContainer(KeyedContainer<NestedKey>(dictionary: nested, codingPath: codingPath + [key]))
+    }
+
+    mutating func nestedUnkeyedContainer(forKey key: Key) -> UnkeyedEncodingContainer {
+        let nested = NSMutableArray()
+        dictionary[key.stringValue] = nested
+        return UnkeyedContainer(array: nested, codingPath: codingPath + [key])
+    }
+
+    mutating func superEncoder() -> Encoder {
+        superEncoder(forKey: Key(stringValue: "super")!)
+    }
+
+    mutating func superEncoder(forKey key: Key) -> Encoder {
+        ValueEncoder(codingPath: codingPath + [key]) { [dictionary] in dictionary[key.stringValue] = $0 }
+    }
+}
+
+private struct UnkeyedContainer: UnkeyedEncodingContainer {
+    let array: NSMutableArray
+    let codingPath: [CodingKey]
+
+    var count: Int {
+        array.count
+    }
+
+    mutating func encodeNil() throws {
+        throw XMLRPCValueEncoder.nilError(codingPath: codingPath + [IndexKey(intValue: count)])
+    }
+
+    mutating func encode<T: Encodable>(_ value: T) throws {
+        array.add(try XMLRPCValueEncoder.box(value, codingPath: codingPath + [IndexKey(intValue: count)]))
+    }
+
+    mutating func nestedContainer<NestedKey: CodingKey>(keyedBy keyType: NestedKey.Type) -> KeyedEncodingContainer<NestedKey> {
+        let nested = NSMutableDictionary()
+        let path = codingPath + [IndexKey(intValue: count)]
+        array.add(nested)
+        return KeyedEncodingContainer(KeyedContainer<NestedKey>(dictionary: nested, codingPath: path))
+    }
+
+    mutating func nestedUnkeyedContainer() -> UnkeyedEncodingContainer {
+        let nested = NSMutableArray()
+        let path = codingPath + [IndexKey(intValue: count)]
+        array.add(nested)
+        return UnkeyedContainer(array: nested, codingPath: path)
+    }
+
+    mutating func superEncoder() -> Encoder {
+        // Reserve the element's position, which is replaced by the encoded value.
+        let index = count
+        array.add(NSDictionary())
+        return ValueEncoder(codingPath: codingPath + [IndexKey(intValue: index)]) { [array] in array[index] = $0 }
+    }
+}
+
+private struct SingleValueContainer: SingleValueEncodingContainer {
+    let encoder: ValueEncoder
+
+    var codingPath: [CodingKey] {
+        encoder.codingPath
+    }
+
+    mutating func encodeNil() throws {
+        throw XMLRPCValueEncoder.nilError(codingPath: codingPath)
+    }
+
+    mutating func encode(_ value: Bool) throws { encoder.set(NSNumber(value: value)) }
+    mutating func encode(_ value: String) throws { encoder.set(value) }
+    mutating func encode(_ value: Double) throws { encoder.set(NSNumber(value: value)) }
+    mutating func encode(_ value: Float) throws { encoder.set(NSNumber(value: value)) }
+    mutating func encode(_ value: Int) throws { encoder.set(NSNumber(value: value)) }
+    mutating func encode(_ value: Int8) throws { encoder.set(NSNumber(value: value)) }
+    mutating func encode(_ value: Int16) throws { encoder.set(NSNumber(value: value)) }
+    mutating func encode(_ value: Int32) throws { encoder.set(NSNumber(value: value)) }
+    mutating func encode(_ value: Int64) throws { encoder.set(NSNumber(value: value)) }
+    mutating func encode(_ value: UInt) throws { encoder.set(NSNumber(value: value)) }
+    mutating func encode(_ value: UInt8) throws { encoder.set(NSNumber(value: value)) }
+    mutating func encode(_ value: UInt16) throws { encoder.set(NSNumber(value: value)) }
+    mutating func encode(_ value: UInt32) throws { encoder.set(NSNumber(value: value)) }
+    mutating func encode(_ value: UInt64) throws { encoder.set(NSNumber(value: value)) }
+
+    mutating func encode<T: Encodable>(_ value: T) throws {
+        encoder.set(try XMLRPCValueEncoder.box(value, codingPath: codingPath))
+    }
+}
+
+private struct IndexKey: CodingKey {
+    let intValue: Int?
+
+    var stringValue: String {
+        "Index \(intValue ?? 0)"
+    }
+
+    init(intValue: Int) {
+        self.intValue = intValue
+    }
+
+    init?(stringValue: String) {
+        return nil
+    }
+}
@@ -1,24 +1,9 @@
-struct JSONCodingKeys: CodingKey {
-    var stringValue: String
-
-    init?(stringValue: String) {
-        self.stringValue = stringValue
-    }
-
-    var intValue: Int?
-
-    init?(intValue: Int) {
-        self.init(stringValue: "\(intValue)")
-        self.intValue = intValue
-    }
-}
-
 /// Add support to decode to a Dictionary
-/// From: https://stackoverflow.com/q/44603248
+///
+/// The values are decoded as `JSONValue`s, and bridged to Foundation objects. See `JSONValue.jsonObject`.
 extension KeyedDecodingContainer {
     func decode(_ type: Dictionary<String, Any>.Type, forKey key: K) throws -> [String: Any] {
-        let container = try self.nestedContainer(keyedBy: JSONCodingKeys.self, forKey: key)
-        return try container.decode(type)
+        try decode([String: JSONValue].self, forKey: key).compactMapValues(\.jsonObject)
     }
 
     func decodeIfPresent(_ type: Dictionary<String, Any>.Type, forKey key: K) throws -> [String: Any]? {
@@ -32,8 +17,7 @@ extension KeyedDecodingContainer {
     }
 
     func decode(_ type: Array<Any>.Type, forKey key: K) throws -> [Any] {
-        var container = try self.nestedUnkeyedContainer(forKey: key)
-        return try container.decode(type)
+        try decode([JSONValue].self, forKey: key).compactMap(\.jsonObject)
     }
 
     func decodeIfPresent(_ type: Array<Any>.Type, forKey key: K) throws -> [Any]? {
@@ -50,19 +34,7 @@ extension KeyedDecodingContainer {
         var dictionary = [String: Any]()
 
         for key in allKeys {
-            if let boolValue = try? decode(Bool.self, forKey: key) {
-                dictionary[key.stringValue] = boolValue
-            } else if let stringValue = try? decode(String.self, forKey: key) {
-                dictionary[key.stringValue] = stringValue
-            } else if let intValue = try? decode(Int.self, forKey: key) {
-                dictionary[key.stringValue] = intValue
-            } else if let doubleValue = try? decode(Double.self, forKey: key) {
-                dictionary[key.stringValue] = doubleValue
-            } else if let nestedDictionary = try? decode(Dictionary<String, Any>.self, forKey: key) {
-                dictionary[key.stringValue] = nestedDictionary
-            } else if let nestedArray = try? decode(Array<Any>.self, forKey: key) {
-                dictionary[key.stringValue] = nestedArray
-            }
+            dictionary[key.stringValue] = try decode(JSONValue.self, forKey: key).jsonObject
         }
         return dictionary
     }
@@ -71,29 +43,10 @@ extension KeyedDecodingContainer {
 extension UnkeyedDecodingContainer {
 
     mutating func decode(_ type: Array<Any>.Type) throws -> [Any] {
-        var array: [Any] = []
-        while isAtEnd == false {
-            // See if the current value in the JSON array is `null` first and prevent infite recursion with nested arrays.
-            if try decodeNil() {
-                continue
-            } else if let value = try? decode(Bool.self) {
-                array.append(value)
-            } else if let value = try? decode(Double.self) {
-                array.append(value)
-            } else if let value = try? decode(String.self) {
-                array.append(value)
-            } else if let nestedDictionary = try? decode(Dictionary<String, Any>.self) {
-                array.append(nestedDictionary)
-            } else if var nestedContainer = try? nestedUnkeyedContainer(), let nestedArray = try? nestedContainer.decode(Array<Any>.self) {
-                array.append(nestedArray)
-            }
-        }
-        return array
+        try decode([JSONValue].self).compactMap(\.jsonObject)
     }
 
     mutating func decode(_ type: Dictionary<String, Any>.Type) throws -> [String: Any] {
-
-        let nestedContainer = try self.nestedContainer(keyedBy: JSONCodingKeys.self)
-        return try nestedContainer.decode(type)
+        try decode([String: JSONValue].self).compactMapValues(\.jsonObject)
     }
 }
@@ -0,0 +1,130 @@
+import Foundation
+
+/// Decodes values as leniently as `NSObject_SafeExpectations` reads them from the dictionaries of `JSONSerialization`,
+/// for the models that are mapped from both: a value of an unexpected type is `nil`, instead of an error.
+///
+/// The types are tried in the order of how common they are for the value, because each failed attempt allocates a
+/// `DecodingError`.
+extension KeyedDecodingContainer {
+
+    /// Like `-[NSDictionary numberForKey:]`: a number, or a string that's a number.
+    func lenientNumber(forKey key: K) -> NSNumber? {
+        guard hasValue(forKey: key) else {
+            return nil
+        }
+        if let value = try? decode(Int64.self, forKey: key) {
+            return NSNumber(value: value)
+        }
+        if let value = try? decode(Bool.self, forKey: key) {
+            return NSNumber(value: value)
+        }
+        if let value = try? decode(Double.self, forKey: key) {
+            return NSNumber(value: value)
+        }
+        guard let string = try? decode(String.self, forKey: key) else {
+            return nil
+        }
+        if let value = Int64(string) {
+            return NSNumber(value: value)
+        }
+        return Double(string).map { NSNumber(value: $0) }
+    }
+
+    /// Like `[[NSDictionary numberForKey:] boolValue]`: `false` unless the value is `true` or a non-zero number.
+    func lenientBool(forKey key: K) -> Bool {
+        guard hasValue(forKey: key) else {
+            return false
+        }
+        if let value = try? decode(Bool.self, forKey: key) {
+            return value
+        }
+        return lenientNumber(forKey: key)?.boolValue ?? false
+    }
+
+    /// Like `-[NSDictionary stringForKey:]`: a string, or the `stringValue` of a number.
+    func lenientString(forKey key: K) -> String? {
+        guard hasValue(forKey: key) else {
+            return nil
+        }
+        if let value = try? decode(String.self, forKey: key) {
+            return value
+        }
+        return lenientNumber(forKey: key)?.stringValue
+    }
+
+    /// Like `-[NSDictionary dictionaryForKey:]`: the container of an object, and `nil` for any other value.
+    func lenientContainer<NestedKey: CodingKey>(keyedBy type: NestedKey.Type, forKey key: K) -> KeyedDecodingContainer<NestedKey>? {
+        guard hasValue(forKey: key) else {
+            return nil
+        }
+        return try? nestedContainer(keyedBy: type, forKey: key)
+    }
+
+    /// Like `-[NSDictionary dictionaryForKey:]`, bridged to Foundation objects. See `JSONValue.jsonObject`.
+    func lenientDictionary(forKey key: K) -> [String: Any]? {
+        guard hasValue(forKey: key), case let .object(values)? = try? decode(JSONValue.self, forKey: key) else {
+            return nil
+        }
+        return values.compactMapValues(\.jsonObject)
+    }
+
+    /// Like `-[NSDictionary arrayForKey:]`: the elements of an array, and `nil` for any other value.
+    func lenientArray(forKey key: K) -> [JSONValue]? {
+        guard hasValue(forKey: key) else {
+            return nil
+        }
+        return try? decode([JSONValue].self, forKey: key)
+    }
+
+    /// Like `-[[NSDictionary dictionaryForKey:] allKeys]`, without decoding the values of the object.
+    func lenientKeys(forKey key: K) -> [String]? {
+        lenientContainer(keyedBy: ObjectKey.self, forKey: key)?.allKeys.map(\.stringValue)
+    }
+
+    private func hasValue(forKey key: K) -> Bool {
+        contains(key) && (try? decodeNil(forKey: key)) == false
+    }
+
+}
+
+/// Any key of an object.
+private struct ObjectKey: CodingKey {
+    let stringValue: String
+    var intValue: Int? { nil }
+
+    init(stringValue: String) {
+        self.stringValue = stringValue
+    }
+
+    init?(intValue: Int) {
+        return nil
+    }
+}
+
+extension CodingUserInfoKey {
+
+    /// The `StringInterningPool` that the decoded models intern their repeated values in, if any.
+    static let stringPool = CodingUserInfoKey(rawValue: "org.wordpress.kit.stringPool")!
+
+}
+
+extension Decoder {
+
+    var stringPool: StringInterningPool? {
+        userInfo[.stringPool] as? StringInterningPool
+    }
+
+}
+
+extension JSONDecoder {
+
+    /// A decoder whose models intern their repeated values in the given pool, if any.
+    ///
+    /// Each request gets its own decoder, which also keeps the decoded models from being shared with the requests that
+    /// are coalesced with it, since they're mutable.
+    convenience init(stringPool: StringInterningPool?) {
+        self.init()
+        userInfo[.stringPool] = stringPool
+    }
+
+}
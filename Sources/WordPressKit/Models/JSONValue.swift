@@ -0,0 +1,69 @@
+import Foundation
+
+/// A JSON value of any type, i.e. the value of a key whose type varies, or isn't modeled.
+///
+/// `Decoder` doesn't expose the type of a value, so the types are tried in turn, in the order of how common they are in
+/// API responses: a string is decoded in one attempt, while a double is decoded after five failed attempts, each of
+/// which allocates a `DecodingError`.
+enum JSONValue: Equatable {
+    case null
+    case bool(Bool)
+    case int(Int)
+    case double(Double)
+    case string(String)
+    case array([JSONValue])
+    case object([String: JSONValue])
+}
+
+extension JSONValue: Decodable {
+
+    init(from decoder: Decoder) throws {
+        let container = try decoder.singleValueContainer()
+
+        if container.decodeNil() {
+            self = .null
+        } else if let value = try? container.decode(String.self) {
+            self = .string(value)
+        } else if let value = try? container.decode(Int.self) {
+            self = .int(value)
+        } else if let value = try? container.decode([String: JSONValue].self) {
+            self = .object(value)
+        } else if let value = try? container.decode(Bool.self) {
+            self = .bool(value)
+        } else if let value = try? container.decode([JSONValue].self) {
+            self = .array(value)
+        } else {
+            self = .double(try container.decode(Double.self))
+        }
+    }
+
+}
+
+extension JSONValue {
+
+    /// The value as a Foundation object, like the ones `JSONSerialization` returns, except that `null` values are
+    /// `nil` and are left out of arrays and dictionaries.
+    ///
+    /// Numbers are `NSNumber`s, so that they can be cast to any numeric type that represents them exactly. Like the
+    /// numbers of `JSONSerialization`, they can also be cast to `Bool`: `1` casts to `true`. Match on `.bool` instead
+    /// where a boolean must be told apart from a number.
+    var jsonObject: Any? {
+        switch self {
+        case .null:
+            return nil
+        case let .bool(value):
+            return value
+        case let .int(value):
+            return NSNumber(value: value)
+        case let .double(value):
+            return NSNumber(value: value)
+        case let .string(value):
+            return value
+        case let .array(values):
+            return values.compactMap(\.jsonObject)
+        case let .object(values):
+            return values.compactMapValues(\.jsonObject)
+        }
+    }
+
+}
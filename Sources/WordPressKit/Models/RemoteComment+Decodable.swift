@@ -0,0 +1,105 @@
+import Foundation
+
+/// A comment object of the REST API, decoded straight from the response data into a `RemoteComment`.
+///
+/// It maps the comment like `CommentServiceRemoteREST.remoteComment(fromJSONDictionary:)`, which maps the dictionaries
+/// of `JSONSerialization`. The comment's repeated values are interned in the decoder's `stringPool`, if any.
+struct RemoteCommentPayload: Decodable {
+    let comment: RemoteComment
+
+    private enum CodingKeys: String, CodingKey {
+        case id = "ID"
+        case author
+        case date
+        case url = "URL"
+        case parent
+        case post
+        case status
+        case type
+        case iLike = "i_like"
+        case likeCount = "like_count"
+        case canModerate = "can_moderate"
+        case content
+        case rawContent = "raw_content"
+    }
+
+    private enum AuthorKeys: String, CodingKey {
+        case id = "ID"
+        case name
+        case email
+        case url = "URL"
+        case avatarURL = "avatar_URL"
+        case ipAddress = "ip_address"
+    }
+
+    private enum PostKeys: String, CodingKey {
+        case id = "ID"
+        case title
+    }
+
+    init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+        let comment = RemoteComment()
+
+        if let author = container.lenientContainer(keyedBy: AuthorKeys.self, forKey: .author) {
+            comment.authorID = author.lenientNumber(forKey: .id)
+            comment.author = author.lenientString(forKey: .name)
+            // Email might be `false`, turn into `nil`
+            comment.authorEmail = author.lenientString(forKey: .email)
+            comment.authorUrl = author.lenientString(forKey: .url)
+            comment.authorAvatarURL = author.lenientString(forKey: .avatarURL)
+            comment.authorIP = author.lenientString(forKey: .ipAddress)
+        }
+        comment.commentID = container.lenientNumber(forKey: .id)
+        comment.date = container.lenientString(forKey: .date).flatMap(NSDate.with(wordPressComJSONString:))
+        comment.link = container.lenientString(forKey: .url)
+        comment.parentID = container.lenientContainer(keyedBy: PostKeys.self, forKey: .parent)?.lenientNumber(forKey: .id)
+        if let post = container.lenientContainer(keyedBy: PostKeys.self, forKey: .post) {
+            comment.postID = post.lenientNumber(forKey: .id)
+            comment.postTitle = post.lenientString(forKey: .title)
+        }
+        comment.status = Self.status(fromRemoteStatus: container.lenientString(forKey: .status))
+        comment.type = container.lenientString(forKey: .type)
+        comment.isLiked = container.lenientBool(forKey: .iLike)
+        comment.likeCount = container.lenientNumber(forKey: .likeCount)
+        comment.canModerate = container.lenientBool(forKey: .canModerate)
+        comment.content = container.lenientString(forKey: .content)
+        comment.rawContent = container.lenientString(forKey: .rawContent)
+
+        if let stringPool = decoder.stringPool {
+            comment.internStrings(in: stringPool)
+        }
+
+        self.comment = comment
+    }
+
+    /// Like `-[CommentServiceRemoteREST statusWithRemoteStatus:]`.
+    private static func status(fromRemoteStatus remoteStatus: String?) -> String? {
+        switch remoteStatus {
+        case "unapproved":
+            return "hold"
+        case "approved":
+            return "approve"
+        default:
+            return remoteStatus
+        }
+    }
+
+}
+
+/// The comments of a response of the `sites/:site/posts/:post/replies` endpoint.
+struct RemoteCommentsEnvelope: Decodable {
+    let comments: [RemoteComment]
+    let found: Int
+
+    private enum CodingKeys: String, CodingKey {
+        case comments
+        case found
+    }
+
+    init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+        comments = try container.decodeIfPresent([RemoteCommentPayload].self, forKey: .comments)?.map(\.comment) ?? []
+        found = container.lenientNumber(forKey: .found)?.intValue ?? 0
+    }
+}
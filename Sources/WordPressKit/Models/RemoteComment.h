@@ -1,5 +1,7 @@
 #import <Foundation/Foundation.h>
 
+@class StringInterningPool;
+
 @interface RemoteComment : NSObject
 @property (nonatomic, strong) NSNumber *commentID;
 @property (nonatomic, strong) NSNumber *authorID;
@@ -20,4 +22,13 @@
 @property (nonatomic) BOOL isLiked;
 @property (nonatomic, strong) NSNumber *likeCount;
 @property (nonatomic) BOOL canModerate;
+
+/**
+ Replaces the values that are repeated across comments, like the authors and their avatar URLs, with the pool's equal
+ strings.
+
+ @param stringPool The pool to intern the values in.
+ */
+- (void)internStringsInPool:(StringInterningPool *)stringPool;
+
 @end
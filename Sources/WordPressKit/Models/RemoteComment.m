@@ -1,5 +1,16 @@
 #import "RemoteComment.h"
+#import "WPKit-Swift.h"
 
 @implementation RemoteComment
 
+- (void)internStringsInPool:(StringInterningPool *)stringPool
+{
+    self.author = [stringPool internString:self.author];
+    self.authorUrl = [stringPool internString:self.authorUrl];
+    self.authorAvatarURL = [stringPool internString:self.authorAvatarURL];
+    self.postTitle = [stringPool internString:self.postTitle];
+    self.status = [stringPool internString:self.status];
+    self.type = [stringPool internString:self.type];
+}
+
 @end
@@ -1,6 +1,6 @@
 #import <Foundation/Foundation.h>
 
-@interface RemoteMedia : NSObject
+@interface RemoteMedia : NSObject <NSCopying>
 
 @property (nonatomic, strong, nullable) NSNumber *mediaID;
 @property (nonatomic, strong, nullable) NSURL *url;
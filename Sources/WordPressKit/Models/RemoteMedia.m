@@ -27,4 +27,17 @@
     return [NSDictionary dictionaryWithDictionary:debugProperties];
 }
 
+- (id)copyWithZone:(NSZone *)zone {
+    RemoteMedia *copy = [[[self class] allocWithZone:zone] init];
+    unsigned int propertyCount;
+    objc_property_t *properties = class_copyPropertyList([RemoteMedia class], &propertyCount);
+    for (int i = 0; i < propertyCount; i++)
+    {
+        NSString *propertyName = @(property_getName(properties[i]));
+        [copy setValue:[self valueForKey:propertyName] forKey:propertyName];
+    }
+    free(properties);
+    return copy;
+}
+
 @end
\ No newline at end of file
@@ -58,19 +58,30 @@ public struct RemoteNotification {
 
     /// Designed Initializer
     ///
-    public init?(document: [String: AnyObject]) {
+    /// - Parameters:
+    ///     - document: The notification's JSON.
+    ///     - stringPool: The pool that the values that are repeated across notifications, like the type and the
+    ///       icon, are interned in, if any.
+    ///
+    public init?(document: [String: AnyObject], stringPool: StringInterningPool? = nil) {
         guard let noteId = document.valueAsString(forKey: "id"),
             let noteHash = document.valueAsString(forKey: "note_hash") else {
             return nil
         }
 
+        // The values that are repeated across notifications are shared, when there's a pool.
+        func internedString(forKey key: String) -> String? {
+            let string = document[key] as? String
+            return stringPool?.intern(string) ?? string
+        }
+
         notificationId = noteId
         notificationHash = noteHash
         read = document["read"] as? Bool ?? false
-        icon = document["icon"] as? String
-        noticon = document["noticon"] as? String
+        icon = internedString(forKey: "icon")
+        noticon = internedString(forKey: "noticon")
         timestamp = document["timestamp"] as? String
-        type = document["type"] as? String
+        type = internedString(forKey: "type")
         url = document["url"] as? String
         title = document["title"] as? String
         subject = document["subject"] as? [AnyObject]
@@ -0,0 +1,197 @@
+import Foundation
+import WordPressShared
+
+/// A post object of the REST API, decoded straight from the response data into a `RemotePost`.
+///
+/// It maps the post like `PostServiceRemoteREST.remotePost(fromJSONDictionary:)`, which maps the dictionaries of
+/// `JSONSerialization`, but the keys are read once, through the coding keys, instead of looking up each key path in
+/// the post's dictionary.
+struct RemotePostPayload: Decodable {
+    let post: RemotePost
+
+    private enum CodingKeys: String, CodingKey {
+        case id = "ID"
+        case siteID = "site_ID"
+        case author
+        case date
+        case modified
+        case title
+        case url = "URL"
+        case shortURL = "short_URL"
+        case content
+        case excerpt
+        case slug
+        case otherURLs = "other_URLs"
+        case status
+        case password
+        case parent
+        case postThumbnail = "post_thumbnail"
+        case type
+        case format
+        case discussion
+        case likeCount = "like_count"
+        case sticky
+        case metadata
+        case categories
+        case tags
+        case revisions
+        case meta
+        case attachments
+    }
+
+    private enum AuthorKeys: String, CodingKey {
+        case id = "ID"
+        case avatarURL = "avatar_URL"
+        case name
+        case email
+        case url = "URL"
+    }
+
+    private enum OtherURLsKeys: String, CodingKey {
+        case suggestedSlug = "suggested_slug"
+    }
+
+    private enum IDKeys: String, CodingKey {
+        case id = "ID"
+    }
+
+    private enum PostThumbnailKeys: String, CodingKey {
+        case id = "ID"
+        case url = "URL"
+    }
+
+    private enum DiscussionKeys: String, CodingKey {
+        case commentCount = "comment_count"
+    }
+
+    private enum MetaKeys: String, CodingKey {
+        case data
+        case autosave
+    }
+
+    private enum AutosaveKeys: String, CodingKey {
+        case id = "ID"
+        case title
+        case content
+        case excerpt
+        case modified
+        case authorID = "author_ID"
+        case postID = "post_ID"
+        case previewURL = "preview_URL"
+    }
+
+    init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+        let post = RemotePost()
+
+        post.postID = container.lenientNumber(forKey: .id)
+        post.siteID = container.lenientNumber(forKey: .siteID)
+        if let author = container.lenientContainer(keyedBy: AuthorKeys.self, forKey: .author) {
+            post.authorAvatarURL = author.lenientString(forKey: .avatarURL)
+            post.authorDisplayName = author.lenientString(forKey: .name)
+            post.authorEmail = author.lenientString(forKey: .email)
+            post.authorURL = author.lenientString(forKey: .url)
+            post.authorID = author.lenientNumber(forKey: .id)
+        }
+        post.date = container.lenientString(forKey: .date).flatMap(NSDate.with(wordPressComJSONString:))
+        post.dateModified = container.lenientString(forKey: .modified).flatMap(NSDate.with(wordPressComJSONString:))
+        post.title = container.lenientString(forKey: .title)
+        post.url = container.lenientString(forKey: .url).flatMap(URL.init(string:))
+        post.shortURL = container.lenientString(forKey: .shortURL).flatMap(URL.init(string:))
+        post.content = container.lenientString(forKey: .content)
+        post.excerpt = container.lenientString(forKey: .excerpt)
+        post.slug = container.lenientString(forKey: .slug)
+        post.suggestedSlug = container.lenientContainer(keyedBy: OtherURLsKeys.self, forKey: .otherURLs)?
+            .lenientString(forKey: .suggestedSlug)
+        post.status = container.lenientString(forKey: .status)
+        post.password = container.lenientString(forKey: .password).flatMap { $0.isEmpty ? nil : $0 }
+        post.parentID = container.lenientContainer(keyedBy: IDKeys.self, forKey: .parent)?.lenientNumber(forKey: .id)
+        let postThumbnail = container.lenientContainer(keyedBy: PostThumbnailKeys.self, forKey: .postThumbnail)
+        post.postThumbnailID = postThumbnail?.lenientNumber(forKey: .id)
+        post.postThumbnailPath = postThumbnail?.lenientString(forKey: .url)
+        post.type = container.lenientString(forKey: .type)
+        post.format = container.lenientString(forKey: .format)
+
+        post.commentCount = container.lenientContainer(keyedBy: DiscussionKeys.self, forKey: .discussion)?
+            .lenientNumber(forKey: .commentCount) ?? 0
+        post.likeCount = container.lenientNumber(forKey: .likeCount) ?? 0
+
+        post.isStickyPost = container.lenientNumber(forKey: .sticky)
+
+        // The metadata is `false` when there are no custom fields, or, on some sites, an array that contains `false`.
+        post.metadata = container.lenientArray(forKey: .metadata)?.compactMap { value -> Any? in
+            guard case .object = value else {
+                return nil
+            }
+            return value.jsonObject
+        }
+
+        if let categories = try? container.decodeIfPresent([String: [String: JSONValue]].self, forKey: .categories) {
+            post.categories = categories.values.map(Self.category(from:))
+        }
+        // Only the tags' names are mapped, which are the keys of the tags' object.
+        post.tags = container.lenientKeys(forKey: .tags)
+
+        post.revisions = container.lenientArray(forKey: .revisions)?.compactMap(\.jsonObject)
+
+        if let autosave = container.lenientContainer(keyedBy: MetaKeys.self, forKey: .meta)?
+            .lenientContainer(keyedBy: MetaKeys.self, forKey: .data)?
+            .lenientContainer(keyedBy: AutosaveKeys.self, forKey: .autosave) {
+            post.autosave = Self.autosave(from: autosave)
+        }
+
+        // Pick an image to use for display
+        if let postThumbnailPath = post.postThumbnailPath {
+            post.pathForDisplayImage = postThumbnailPath
+        } else {
+            // parse contents for a suitable image
+            post.pathForDisplayImage = DisplayableImageHelper.searchPostContentForImage(toDisplay: post.content)
+            if (post.pathForDisplayImage ?? "").isEmpty {
+                // The attachments are only decoded when the content has no image.
+                let attachments = container.lenientDictionary(forKey: .attachments)
+                post.pathForDisplayImage = DisplayableImageHelper.searchPostAttachmentsForImage(
+                    toDisplay: attachments,
+                    existingInContent: post.content
+                )
+            }
+        }
+
+        self.post = post
+    }
+
+    private static func category(from json: [String: JSONValue]) -> RemotePostCategory {
+        let category = RemotePostCategory()
+        category.categoryID = json["ID"]?.jsonObject as? NSNumber
+        category.name = json["name"]?.jsonObject as? String
+        category.parentID = json["parent"]?.jsonObject as? NSNumber
+        return category
+    }
+
+    private static func autosave(from container: KeyedDecodingContainer<AutosaveKeys>) -> RemotePostAutosave {
+        let autosave = RemotePostAutosave()
+        autosave.title = container.lenientString(forKey: .title)
+        autosave.content = container.lenientString(forKey: .content)
+        autosave.excerpt = container.lenientString(forKey: .excerpt)
+        autosave.modifiedDate = container.lenientString(forKey: .modified).flatMap(NSDate.with(wordPressComJSONString:))
+        autosave.identifier = container.lenientNumber(forKey: .id)
+        autosave.authorID = container.lenientString(forKey: .authorID)
+        autosave.postID = container.lenientNumber(forKey: .postID)
+        autosave.previewURL = container.lenientString(forKey: .previewURL)
+        return autosave
+    }
+
+}
+
+/// The posts of a response of the `sites/:site/posts` endpoint.
+struct RemotePostsEnvelope: Decodable {
+    let posts: [RemotePost]
+
+    private enum CodingKeys: String, CodingKey {
+        case posts
+    }
+
+    init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+        posts = try container.decodeIfPresent([RemotePostPayload].self, forKey: .posts)?.map(\.post) ?? []
+    }
+}
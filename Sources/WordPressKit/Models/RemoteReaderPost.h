@@ -2,6 +2,7 @@
 
 @class RemoteSourcePostAttribution;
 @class RemoteReaderCrossPostMeta;
+@class StringInterningPool;
 
 @interface RemoteReaderPost : NSObject
 
@@ -67,4 +68,24 @@
 
 - (instancetype)initWithDictionary:(NSDictionary *)dict;
 
+/**
+ Maps a post object from the REST API, interning the values that are repeated across posts, like the site's name and
+ URLs, in the given pool.
+
+ @param dict A dictionary representing a post object from the REST API.
+ @param stringPool The pool that the repeated values are interned in, or `nil` to not intern them.
+ */
+- (instancetype)initWithDictionary:(NSDictionary *)dict stringPool:(StringInterningPool *)stringPool;
+
+/**
+ Makes a post whose derived values, like its summary and featured image, are made from the given values of a post
+ object from the REST API when they're first read. The other values are left to the caller to set, which is how the
+ posts that are decoded from the response data are made.
+
+ @param source A dictionary that has the `content`, `editorial`, `excerpt`, `featured_image`, `featured_media`, `meta`,
+ `metadata`, `railcar`, `site_name`, `tags` and `title` values of a post object, when it has them.
+ @param stringPool The pool that the repeated derived values are interned in, or `nil` to not intern them.
+ */
+- (instancetype)initWithDerivedValuesSource:(NSDictionary *)source stringPool:(StringInterningPool *)stringPool;
+
 @end
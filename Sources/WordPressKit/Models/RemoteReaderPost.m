@@ -79,8 +79,45 @@ static const NSInteger AvgWordsPerMinuteRead = 250;
 static const NSInteger MinutesToReadThreshold = 2;
 static const NSUInteger ReaderPostTitleLength = 30;
 
+// The values that are derived from the post dictionary on first access, instead of when the post is mapped.
+typedef NS_OPTIONS(NSUInteger, RemoteReaderPostDerivedValues) {
+    RemoteReaderPostDerivedValueBlogName = 1 << 0,
+    RemoteReaderPostDerivedValueBlogDescription = 1 << 1,
+    RemoteReaderPostDerivedValueFeaturedImage = 1 << 2,
+    RemoteReaderPostDerivedValuePostTitle = 1 << 3,
+    RemoteReaderPostDerivedValueSummary = 1 << 4,
+    RemoteReaderPostDerivedValueTags = 1 << 5,
+    RemoteReaderPostDerivedValuePrimaryAndSecondaryTags = 1 << 6,
+    RemoteReaderPostDerivedValueCrossPostMeta = 1 << 7,
+    RemoteReaderPostDerivedValueRailcar = 1 << 8,
+    RemoteReaderPostDerivedValueAll = (1 << 9) - 1,
+};
+
+@interface RemoteReaderPost ()
+
+/// The values of the post dictionary that the pending derived values are made from.
+@property (nonatomic, strong) NSDictionary *derivedValuesSource;
+@property (nonatomic) RemoteReaderPostDerivedValues pendingDerivedValues;
+/// The pool that the derived values are interned in, as long as it's in use.
+@property (nonatomic, weak) StringInterningPool *stringPool;
+
+@end
+
 @implementation RemoteReaderPost
 
+@synthesize blogName = _blogName;
+@synthesize blogDescription = _blogDescription;
+@synthesize featuredImage = _featuredImage;
+@synthesize postTitle = _postTitle;
+@synthesize summary = _summary;
+@synthesize tags = _tags;
+@synthesize primaryTag = _primaryTag;
+@synthesize primaryTagSlug = _primaryTagSlug;
+@synthesize secondaryTag = _secondaryTag;
+@synthesize secondaryTagSlug = _secondaryTagSlug;
+@synthesize crossPostMeta = _crossPostMeta;
+@synthesize railcar = _railcar;
+
 /**
  Sanitizes a post object from the REST API.
 
@@ -89,24 +126,28 @@ static const NSUInteger ReaderPostTitleLength = 30;
  */
 - (instancetype)initWithDictionary:(NSDictionary *)dict;
 {
+    return [self initWithDictionary:dict stringPool:nil];
+}
+
+- (instancetype)initWithDictionary:(NSDictionary *)dict stringPool:(StringInterningPool *)stringPool
+{
+    self.stringPool = stringPool;
+
     NSDictionary *authorDict = [dict dictionaryForKey:PostRESTKeyAuthor];
     NSDictionary *discussionDict = [dict dictionaryForKey:PostRESTKeyDiscussion] ?: dict;
 
     self.authorID = [authorDict numberForKey:PostRESTKeyID];
-    self.author = [self stringOrEmptyString:[authorDict stringForKey:PostRESTKeyNiceName]]; // typically the author's screen name
-    self.authorAvatarURL = [self stringOrEmptyString:[authorDict stringForKey:PostRESTKeyAvatarURL]];
-    self.authorDisplayName = [[self stringOrEmptyString:[authorDict stringForKey:PostRESTKeyName]] stringByDecodingXMLCharacters]; // Typically the author's given name
+    self.author = [self internString:[self stringOrEmptyString:[authorDict stringForKey:PostRESTKeyNiceName]]]; // typically the author's screen name
+    self.authorAvatarURL = [self internString:[self stringOrEmptyString:[authorDict stringForKey:PostRESTKeyAvatarURL]]];
+    self.authorDisplayName = [self internString:[[self stringOrEmptyString:[authorDict stringForKey:PostRESTKeyName]] stringByDecodingXMLCharacters]]; // Typically the author's given name
     self.authorEmail = [self authorEmailFromAuthorDictionary:authorDict];
-    self.authorURL = [self stringOrEmptyString:[authorDict stringForKey:PostRESTKeyURL]];
-    self.siteIconURL = [self stringOrEmptyString:[dict stringForKeyPath:@"meta.data.site.icon.img"]];
-    self.blogName = [self siteNameFromPostDictionary:dict];
-    self.blogDescription = [self siteDescriptionFromPostDictionary:dict];
-    self.blogURL = [self siteURLFromPostDictionary:dict];
+    self.authorURL = [self internString:[self stringOrEmptyString:[authorDict stringForKey:PostRESTKeyURL]]];
+    self.siteIconURL = [self internString:[self stringOrEmptyString:[dict stringForKeyPath:@"meta.data.site.icon.img"]]];
+    self.blogURL = [self internString:[self siteURLFromPostDictionary:dict]];
     self.commentCount = [discussionDict numberForKey:PostRESTKeyCommentCount];
     self.commentsOpen = [[discussionDict numberForKey:PostRESTKeyCommentsOpen] boolValue];
     self.content = [self postContentFromPostDictionary:dict];
     self.date_created_gmt = [self stringOrEmptyString:[dict stringForKey:PostRESTKeyDate]];
-    self.featuredImage = [self featuredImageFromPostDictionary:dict];
     self.feedID = [dict numberForKey:PostRESTKeyFeedID];
     self.feedItemID = [dict numberForKey:PostRESTKeyFeedItemID];
     self.globalID = [self stringOrEmptyString:[dict stringForKey:PostRESTKeyGlobalID]];
@@ -119,14 +160,11 @@ static const NSUInteger ReaderPostTitleLength = 30;
     self.likeCount = [dict numberForKey:PostRESTKeyLikeCount];
     self.permalink = [self stringOrEmptyString:[dict stringForKey:PostRESTKeyURL]];
     self.postID = [dict numberForKey:PostRESTKeyID];
-    self.postTitle = [self postTitleFromPostDictionary:dict];
     self.score = [dict numberForKey:PostRESTKeyScore];
     self.siteID = [dict numberForKey:PostRESTKeySiteID];
     self.sortDate = [self sortDateFromPostDictionary:dict];
     self.sortRank = @(self.sortDate.timeIntervalSinceReferenceDate);
-    self.status = [self stringOrEmptyString:[dict stringForKey:PostRESTKeyStatus]];
-    self.summary = [self postSummaryFromPostDictionary:dict orPostContent:self.content];
-    self.tags = [self tagsFromPostDictionary:dict];
+    self.status = [self internString:[self stringOrEmptyString:[dict stringForKey:PostRESTKeyStatus]]];
     self.isSharingEnabled = [[dict numberForKey:PostRESTKeySharingEnabled] boolValue];
     self.isLikesEnabled = [[dict numberForKey:PostRESTKeyLikesEnabled] boolValue];
     self.organizationID = [dict numberForKeyPath:PostRESTKeyOrganizationID] ?: @0;
@@ -142,43 +180,349 @@ static const NSUInteger ReaderPostTitleLength = 30;
         self.isSeenSupported = NO;
     }
 
-    // Construct a title if necessary.
-    if ([self.postTitle length] == 0 && [self.summary length] > 0) {
-        self.postTitle = [self titleFromSummary:self.summary];
-    }
-
-    NSDictionary *tags = [self primaryAndSecondaryTagsFromPostDictionary:dict];
-    if (tags) {
-        self.primaryTag = [tags stringForKey:TagKeyPrimary];
-        self.primaryTagSlug = [tags stringForKey:TagKeyPrimarySlug];
-        self.secondaryTag = [tags stringForKey:TagKeySecondary];
-        self.secondaryTagSlug = [tags stringForKey:TagKeySecondarySlug];
-    }
-
     self.isExternal = [[dict numberForKey:PostRESTKeyIsExternal] boolValue];
     self.isJetpack = [[dict numberForKey:PostRESTKeyIsJetpack] boolValue];
     self.wordCount = [dict numberForKey:PostRESTKeyWordCount];
     self.readingTime = [self readingTimeForWordCount:self.wordCount];
 
-    NSDictionary *railcar = [dict dictionaryForKey:PostRESTKeyRailcar];
-    if (railcar) {
-        NSError *error;
-        NSData *railcarData = [NSJSONSerialization dataWithJSONObject:railcar options:NSJSONWritingPrettyPrinted error:&error];
-        self.railcar = [[NSString alloc] initWithData:railcarData encoding:NSUTF8StringEncoding];
-    }
-
     if ([dict arrayForKeyPath:@"discover_metadata.discover_fp_post_formats"]) {
         self.sourceAttribution = [self sourceAttributionFromDictionary:[dict dictionaryForKey:PostRESTKeyDiscoverMetadata]];
     }
 
-    RemoteReaderCrossPostMeta *crossPostMeta = [self crossPostMetaFromPostDictionary:dict];
-    if (crossPostMeta) {
-        self.crossPostMeta = crossPostMeta;
-    }
+    // The plain text, summary, featured image and tags are made when they're first read, because making them is the
+    // expensive part of mapping a post, and most of the posts of a page are never displayed.
+    self.derivedValuesSource = [self derivedValuesSourceFromPostDictionary:dict];
+    self.pendingDerivedValues = RemoteReaderPostDerivedValueAll;
+
+    return self;
+}
 
+- (instancetype)initWithDerivedValuesSource:(NSDictionary *)source stringPool:(StringInterningPool *)stringPool
+{
+    self = [super init];
+    if (self) {
+        self.stringPool = stringPool;
+        self.derivedValuesSource = source;
+        self.pendingDerivedValues = RemoteReaderPostDerivedValueAll;
+    }
     return self;
 }
 
+#pragma mark - Derived values
+
+/**
+ Returns the values of the post dictionary that the derived values are made from. The values aren't copied.
+
+ @param dict A dictionary representing a post object from the REST API.
+ @return A dictionary that only has the keys that the derived values are made from.
+ */
+- (NSDictionary *)derivedValuesSourceFromPostDictionary:(NSDictionary *)dict
+{
+    static NSArray *keys;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        keys = @[PostRESTKeyContent, PostRESTKeyEditorial, PostRESTKeyExcerpt, PostRESTKeyFeaturedImage,
+                 PostRESTKeyFeaturedMedia, @"meta", PostRESTKeyMetadata, PostRESTKeyRailcar, PostRESTKeySiteName,
+                 PostRESTKeyTags, PostRESTKeyTitle];
+    });
+
+    NSMutableDictionary *source = [NSMutableDictionary dictionaryWithCapacity:keys.count];
+    for (NSString *key in keys) {
+        id value = dict[key];
+        if (value) {
+            source[key] = value;
+        }
+    }
+    return source;
+}
+
+/**
+ Makes the given derived values, unless they were already made or set.
+
+ The models are read from several threads, e.g. when they're saved on a background context, so the derived values are
+ only read and written while holding the post's lock, which this method must be called with. A value stays pending
+ until its instance variable is assigned.
+
+ @param values The derived values to make.
+ */
+- (void)deriveValuesIfNeeded:(RemoteReaderPostDerivedValues)values
+{
+    values &= self.pendingDerivedValues;
+    if (values == 0) {
+        return;
+    }
+
+    NSDictionary *dict = self.derivedValuesSource;
+
+    if (values & RemoteReaderPostDerivedValueBlogName) {
+        _blogName = [self internString:[self siteNameFromPostDictionary:dict]];
+        [self discardPendingDerivedValues:RemoteReaderPostDerivedValueBlogName];
+    }
+    if (values & RemoteReaderPostDerivedValueBlogDescription) {
+        _blogDescription = [self internString:[self siteDescriptionFromPostDictionary:dict]];
+        [self discardPendingDerivedValues:RemoteReaderPostDerivedValueBlogDescription];
+    }
+    if (values & RemoteReaderPostDerivedValueFeaturedImage) {
+        _featuredImage = [self featuredImageFromPostDictionary:dict];
+        [self discardPendingDerivedValues:RemoteReaderPostDerivedValueFeaturedImage];
+    }
+    if (values & RemoteReaderPostDerivedValueSummary) {
+        _summary = [self postSummaryFromPostDictionary:dict orPostContent:[self postContentFromPostDictionary:dict]];
+        [self discardPendingDerivedValues:RemoteReaderPostDerivedValueSummary];
+    }
+    if (values & RemoteReaderPostDerivedValuePostTitle) {
+        NSString *postTitle = [self postTitleFromPostDictionary:dict];
+        // Construct a title if necessary.
+        if ([postTitle length] == 0) {
+            [self deriveValuesIfNeeded:RemoteReaderPostDerivedValueSummary];
+            if ([_summary length] > 0) {
+                postTitle = [self titleFromSummary:_summary];
+            }
+        }
+        _postTitle = postTitle;
+        [self discardPendingDerivedValues:RemoteReaderPostDerivedValuePostTitle];
+    }
+    if (values & RemoteReaderPostDerivedValueTags) {
+        _tags = [self tagsFromPostDictionary:dict];
+        [self discardPendingDerivedValues:RemoteReaderPostDerivedValueTags];
+    }
+    if (values & RemoteReaderPostDerivedValuePrimaryAndSecondaryTags) {
+        NSDictionary *tags = [self primaryAndSecondaryTagsFromPostDictionary:dict];
+        _primaryTag = [self internString:[tags stringForKey:TagKeyPrimary]];
+        _primaryTagSlug = [self internString:[tags stringForKey:TagKeyPrimarySlug]];
+        _secondaryTag = [self internString:[tags stringForKey:TagKeySecondary]];
+        _secondaryTagSlug = [self internString:[tags stringForKey:TagKeySecondarySlug]];
+        [self discardPendingDerivedValues:RemoteReaderPostDerivedValuePrimaryAndSecondaryTags];
+    }
+    if (values & RemoteReaderPostDerivedValueCrossPostMeta) {
+        _crossPostMeta = [self crossPostMetaFromPostDictionary:dict];
+        [self discardPendingDerivedValues:RemoteReaderPostDerivedValueCrossPostMeta];
+    }
+    if (values & RemoteReaderPostDerivedValueRailcar) {
+        NSDictionary *railcar = [dict dictionaryForKey:PostRESTKeyRailcar];
+        if (railcar) {
+            NSError *error;
+            NSData *railcarData = [NSJSONSerialization dataWithJSONObject:railcar options:NSJSONWritingPrettyPrinted error:&error];
+            _railcar = [[NSString alloc] initWithData:railcarData encoding:NSUTF8StringEncoding];
+        }
+        [self discardPendingDerivedValues:RemoteReaderPostDerivedValueRailcar];
+    }
+}
+
+/**
+ Marks the given derived values as made, e.g. because they were set. The source values are released once there are no
+ pending values. It must be called with the post's lock held, after the values are assigned.
+
+ @param values The derived values that aren't pending anymore.
+ */
+- (void)discardPendingDerivedValues:(RemoteReaderPostDerivedValues)values
+{
+    self.pendingDerivedValues &= ~values;
+    if (self.pendingDerivedValues == 0) {
+        self.derivedValuesSource = nil;
+        self.stringPool = nil;
+    }
+}
+
+// The getters and setters of the derived values hold the post's lock, so that a value is never read while it's being
+// made or set on another thread.
+
+- (NSString *)blogName
+{
+    @synchronized (self) {
+        [self deriveValuesIfNeeded:RemoteReaderPostDerivedValueBlogName];
+        return _blogName;
+    }
+}
+
+- (void)setBlogName:(NSString *)blogName
+{
+    @synchronized (self) {
+        _blogName = blogName;
+        [self discardPendingDerivedValues:RemoteReaderPostDerivedValueBlogName];
+    }
+}
+
+- (NSString *)blogDescription
+{
+    @synchronized (self) {
+        [self deriveValuesIfNeeded:RemoteReaderPostDerivedValueBlogDescription];
+        return _blogDescription;
+    }
+}
+
+- (void)setBlogDescription:(NSString *)blogDescription
+{
+    @synchronized (self) {
+        _blogDescription = blogDescription;
+        [self discardPendingDerivedValues:RemoteReaderPostDerivedValueBlogDescription];
+    }
+}
+
+- (NSString *)featuredImage
+{
+    @synchronized (self) {
+        [self deriveValuesIfNeeded:RemoteReaderPostDerivedValueFeaturedImage];
+        return _featuredImage;
+    }
+}
+
+- (void)setFeaturedImage:(NSString *)featuredImage
+{
+    @synchronized (self) {
+        _featuredImage = featuredImage;
+        [self discardPendingDerivedValues:RemoteReaderPostDerivedValueFeaturedImage];
+    }
+}
+
+- (NSString *)postTitle
+{
+    @synchronized (self) {
+        [self deriveValuesIfNeeded:RemoteReaderPostDerivedValuePostTitle];
+        return _postTitle;
+    }
+}
+
+- (void)setPostTitle:(NSString *)postTitle
+{
+    @synchronized (self) {
+        _postTitle = postTitle;
+        [self discardPendingDerivedValues:RemoteReaderPostDerivedValuePostTitle];
+    }
+}
+
+- (NSString *)summary
+{
+    @synchronized (self) {
+        [self deriveValuesIfNeeded:RemoteReaderPostDerivedValueSummary];
+        return _summary;
+    }
+}
+
+- (void)setSummary:(NSString *)summary
+{
+    @synchronized (self) {
+        _summary = summary;
+        [self discardPendingDerivedValues:RemoteReaderPostDerivedValueSummary];
+    }
+}
+
+- (NSString *)tags
+{
+    @synchronized (self) {
+        [self deriveValuesIfNeeded:RemoteReaderPostDerivedValueTags];
+        return _tags;
+    }
+}
+
+- (void)setTags:(NSString *)tags
+{
+    @synchronized (self) {
+        _tags = tags;
+        [self discardPendingDerivedValues:RemoteReaderPostDerivedValueTags];
+    }
+}
+
+// The primary and secondary tags are made together, but each of them can be set.
+
+- (NSString *)primaryTag
+{
+    @synchronized (self) {
+        [self deriveValuesIfNeeded:RemoteReaderPostDerivedValuePrimaryAndSecondaryTags];
+        return _primaryTag;
+    }
+}
+
+- (void)setPrimaryTag:(NSString *)primaryTag
+{
+    @synchronized (self) {
+        [self deriveValuesIfNeeded:RemoteReaderPostDerivedValuePrimaryAndSecondaryTags];
+        _primaryTag = primaryTag;
+    }
+}
+
+- (NSString *)primaryTagSlug
+{
+    @synchronized (self) {
+        [self deriveValuesIfNeeded:RemoteReaderPostDerivedValuePrimaryAndSecondaryTags];
+        return _primaryTagSlug;
+    }
+}
+
+- (void)setPrimaryTagSlug:(NSString *)primaryTagSlug
+{
+    @synchronized (self) {
+        [self deriveValuesIfNeeded:RemoteReaderPostDerivedValuePrimaryAndSecondaryTags];
+        _primaryTagSlug = primaryTagSlug;
+    }
+}
+
+- (NSString *)secondaryTag
+{
+    @synchronized (self) {
+        [self deriveValuesIfNeeded:RemoteReaderPostDerivedValuePrimaryAndSecondaryTags];
+        return _secondaryTag;
+    }
+}
+
+- (void)setSecondaryTag:(NSString *)secondaryTag
+{
+    @synchronized (self) {
+        [self deriveValuesIfNeeded:RemoteReaderPostDerivedValuePrimaryAndSecondaryTags];
+        _secondaryTag = secondaryTag;
+    }
+}
+
+- (NSString *)secondaryTagSlug
+{
+    @synchronized (self) {
+        [self deriveValuesIfNeeded:RemoteReaderPostDerivedValuePrimaryAndSecondaryTags];
+        return _secondaryTagSlug;
+    }
+}
+
+- (void)setSecondaryTagSlug:(NSString *)secondaryTagSlug
+{
+    @synchronized (self) {
+        [self deriveValuesIfNeeded:RemoteReaderPostDerivedValuePrimaryAndSecondaryTags];
+        _secondaryTagSlug = secondaryTagSlug;
+    }
+}
+
+- (RemoteReaderCrossPostMeta *)crossPostMeta
+{
+    @synchronized (self) {
+        [self deriveValuesIfNeeded:RemoteReaderPostDerivedValueCrossPostMeta];
+        return _crossPostMeta;
+    }
+}
+
+- (void)setCrossPostMeta:(RemoteReaderCrossPostMeta *)crossPostMeta
+{
+    @synchronized (self) {
+        _crossPostMeta = crossPostMeta;
+        [self discardPendingDerivedValues:RemoteReaderPostDerivedValueCrossPostMeta];
+    }
+}
+
+- (NSString *)railcar
+{
+    @synchronized (self) {
+        [self deriveValuesIfNeeded:RemoteReaderPostDerivedValueRailcar];
+        return _railcar;
+    }
+}
+
+- (void)setRailcar:(NSString *)railcar
+{
+    @synchronized (self) {
+        _railcar = railcar;
+        [self discardPendingDerivedValues:RemoteReaderPostDerivedValueRailcar];
+    }
+}
+
+#pragma mark - Derived values from the post dictionary
+
 - (RemoteReaderCrossPostMeta *)crossPostMetaFromPostDictionary:(NSDictionary *)dict
 {
     BOOL crossPostMetaFound = NO;
@@ -323,6 +667,21 @@ static const NSUInteger ReaderPostTitleLength = 30;
 
 #pragma mark - Utils
 
+/**
+ Interns the string in the post's string pool, if it has one.
+
+ @param string The string to intern.
+ @return The pool's equal string, or the string passed if the post has no pool.
+ */
+- (NSString *)internString:(NSString *)string
+{
+    StringInterningPool *stringPool = self.stringPool;
+    if (!stringPool) {
+        return string;
+    }
+    return [stringPool internString:string];
+}
+
 /**
  Checks the value of the string passed. If the string is nil, an empty string is returned.
 
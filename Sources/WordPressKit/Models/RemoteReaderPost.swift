@@ -1,4 +1,5 @@
 import Foundation
+import WordPressShared
 
 struct ReaderPostsEnvelope: Decodable {
     var posts: [RemoteReaderPost]
@@ -15,3 +16,345 @@ struct ReaderPostsEnvelope: Decodable {
         posts = [RemoteReaderPost(dictionary: postDictionary)]
     }
 }
+
+/// A post object of the REST API, decoded straight from the response data into a `RemoteReaderPost`.
+///
+/// It maps the post like `RemoteReaderPost(dictionary:stringPool:)`, which maps the dictionaries of
+/// `JSONSerialization`, but the keys are read once, through the coding keys, instead of looking up each key path in
+/// the post's dictionary. Like that initializer, the derived values, like the summary, are made when they're first
+/// read, from the few values of the post that they're made from. The post's repeated values are interned in the
+/// decoder's `stringPool`, if any.
+struct RemoteReaderPostPayload: Decodable {
+    let post: RemoteReaderPost
+
+    private enum CodingKeys: String, CodingKey {
+        case id = "ID"
+        case author
+        case canSubscribeComments = "can_subscribe_comments"
+        case content
+        case date
+        case dateLiked = "date_liked"
+        case discoverMetadata = "discover_metadata"
+        case discussion
+        case editorial
+        case excerpt
+        case featuredImage = "featured_image"
+        case featuredMedia = "featured_media"
+        case feedID = "feed_ID"
+        case feedItemID = "feed_item_ID"
+        case globalID = "global_ID"
+        case iLike = "i_like"
+        case isExternal = "is_external"
+        case isFollowing = "is_following"
+        case isJetpack = "is_jetpack"
+        case isReblogged = "is_reblogged"
+        case isSeen = "is_seen"
+        case isSubscribedComments = "is_subscribed_comments"
+        case likeCount = "like_count"
+        case likesEnabled = "likes_enabled"
+        case meta
+        case metadata
+        case railcar
+        case score
+        case sharingEnabled = "sharing_enabled"
+        case siteID = "site_ID"
+        case siteIsAtomic = "site_is_atomic"
+        case siteIsPrivate = "site_is_private"
+        case siteName = "site_name"
+        case siteURL = "site_URL"
+        case status
+        case subscribedCommentsNotifications = "subscribed_comments_notifications"
+        case taggedOn = "tagged_on"
+        case tags
+        case title
+        case url = "URL"
+        case wordCount = "word_count"
+    }
+
+    private enum AuthorKeys: String, CodingKey {
+        case id = "ID"
+        case niceName = "nice_name"
+        case avatarURL = "avatar_URL"
+        case name
+        case email
+        case url = "URL"
+    }
+
+    private enum DiscussionKeys: String, CodingKey {
+        case commentCount = "comment_count"
+        case commentsOpen = "comments_open"
+    }
+
+    private enum EditorialKeys: String, CodingKey {
+        case displayedOn = "displayed_on"
+    }
+
+    private enum MetaKeys: String, CodingKey {
+        case data
+        case site
+    }
+
+    private enum SiteKeys: String, CodingKey {
+        case icon
+        case url = "URL"
+        case isPrivate = "is_private"
+        case organizationID = "organization_id"
+        case name
+        case description
+    }
+
+    private enum IconKeys: String, CodingKey {
+        case img
+    }
+
+    private enum DiscoverMetadataKeys: String, CodingKey {
+        case postFormats = "discover_fp_post_formats"
+        case permalink
+        case attribution
+        case featuredPostData = "featured_post_wpcom_data"
+    }
+
+    private enum AttributionKeys: String, CodingKey {
+        case authorName = "author_name"
+        case authorURL = "author_url"
+        case avatarURL = "avatar_url"
+        case blogName = "blog_name"
+        case blogURL = "blog_url"
+    }
+
+    private enum FeaturedPostDataKeys: String, CodingKey {
+        case blogID = "blog_id"
+        case postID = "post_id"
+        case commentCount = "comment_count"
+        case likeCount = "like_count"
+    }
+
+    init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+        let stringPool = decoder.stringPool
+        let site = container.lenientContainer(keyedBy: MetaKeys.self, forKey: .meta)?
+            .lenientContainer(keyedBy: MetaKeys.self, forKey: .data)?
+            .lenientContainer(keyedBy: SiteKeys.self, forKey: .site)
+
+        let post = RemoteReaderPost(
+            derivedValuesSource: Self.derivedValuesSource(from: container, site: site),
+            stringPool: stringPool
+        )
+
+        let author = container.lenientContainer(keyedBy: AuthorKeys.self, forKey: .author)
+        post.authorID = author?.lenientNumber(forKey: .id)
+        // typically the author's screen name
+        post.author = stringPool.intern(author?.lenientString(forKey: .niceName) ?? "")
+        post.authorAvatarURL = stringPool.intern(author?.lenientString(forKey: .avatarURL) ?? "")
+        // Typically the author's given name
+        post.authorDisplayName = stringPool.intern((author?.lenientString(forKey: .name) ?? "").stringByDecodingXMLCharacters())
+        post.authorEmail = Self.authorEmail(author?.lenientString(forKey: .email))
+        post.authorURL = stringPool.intern(author?.lenientString(forKey: .url) ?? "")
+        post.siteIconURL = stringPool.intern(
+            site?.lenientContainer(keyedBy: IconKeys.self, forKey: .icon)?.lenientString(forKey: .img) ?? ""
+        )
+        post.blogURL = stringPool.intern(site?.lenientString(forKey: .url) ?? container.lenientString(forKey: .siteURL) ?? "")
+
+        // The discussion values are in the post object itself for some endpoints.
+        let discussion = try container.lenientContainer(keyedBy: DiscussionKeys.self, forKey: .discussion)
+            ?? decoder.container(keyedBy: DiscussionKeys.self)
+        post.commentCount = discussion.lenientNumber(forKey: .commentCount)
+        post.commentsOpen = discussion.lenientBool(forKey: .commentsOpen)
+
+        post.content = container.lenientString(forKey: .content) ?? ""
+        post.date_created_gmt = container.lenientString(forKey: .date) ?? ""
+        post.feedID = container.lenientNumber(forKey: .feedID)
+        post.feedItemID = container.lenientNumber(forKey: .feedItemID)
+        post.globalID = container.lenientString(forKey: .globalID) ?? ""
+        post.isBlogAtomic = container.lenientBool(forKey: .siteIsAtomic)
+        post.isBlogPrivate = site?.lenientNumber(forKey: .isPrivate)?.boolValue ?? container.lenientBool(forKey: .siteIsPrivate)
+        post.isFollowing = container.lenientBool(forKey: .isFollowing)
+        post.isLiked = container.lenientBool(forKey: .iLike)
+        post.isReblogged = container.lenientBool(forKey: .isReblogged)
+        post.likeCount = container.lenientNumber(forKey: .likeCount)
+        post.permalink = container.lenientString(forKey: .url) ?? ""
+        post.postID = container.lenientNumber(forKey: .id)
+        post.score = container.lenientNumber(forKey: .score)
+        post.siteID = container.lenientNumber(forKey: .siteID)
+        post.sortDate = DateUtils.date(fromISOString: Self.sortDate(from: container))
+        post.sortRank = NSNumber(value: post.sortDate?.timeIntervalSinceReferenceDate ?? 0)
+        post.status = stringPool.intern(container.lenientString(forKey: .status) ?? "")
+        post.isSharingEnabled = container.lenientBool(forKey: .sharingEnabled)
+        post.isLikesEnabled = container.lenientBool(forKey: .likesEnabled)
+        post.organizationID = site?.lenientNumber(forKey: .organizationID) ?? 0
+        post.canSubscribeComments = container.lenientBool(forKey: .canSubscribeComments)
+        post.isSubscribedComments = container.lenientBool(forKey: .isSubscribedComments)
+        post.receivesCommentNotifications = container.lenientBool(forKey: .subscribedCommentsNotifications)
+
+        if let isSeen = container.lenientNumber(forKey: .isSeen) {
+            post.isSeen = isSeen.boolValue
+            post.isSeenSupported = true
+        } else {
+            post.isSeen = true
+            post.isSeenSupported = false
+        }
+
+        post.isExternal = container.lenientBool(forKey: .isExternal)
+        post.isJetpack = container.lenientBool(forKey: .isJetpack)
+        post.isWPCom = !post.isJetpack && !post.isExternal
+        post.wordCount = container.lenientNumber(forKey: .wordCount)
+        post.readingTime = Self.readingTime(forWordCount: post.wordCount?.intValue ?? 0)
+
+        if let discoverMetadata = container.lenientContainer(keyedBy: DiscoverMetadataKeys.self, forKey: .discoverMetadata) {
+            post.sourceAttribution = Self.sourceAttribution(from: discoverMetadata)
+        }
+
+        self.post = post
+    }
+
+    /// The values that the derived values are made from. See `RemoteReaderPost(derivedValuesSource:stringPool:)`.
+    ///
+    /// Only the site's name and description are kept of the `meta` object, which is the only part of it that the
+    /// derived values are made from.
+    private static func derivedValuesSource(
+        from container: KeyedDecodingContainer<CodingKeys>,
+        site: KeyedDecodingContainer<SiteKeys>?
+    ) -> [String: Any] {
+        var source = [String: Any]()
+        source["content"] = container.lenientString(forKey: .content)
+        source["editorial"] = container.lenientDictionary(forKey: .editorial)
+        source["excerpt"] = container.lenientString(forKey: .excerpt)
+        source["featured_image"] = container.lenientString(forKey: .featuredImage)
+        source["featured_media"] = container.lenientDictionary(forKey: .featuredMedia)
+        source["metadata"] = container.lenientArray(forKey: .metadata)?.compactMap(\.jsonObject)
+        source["railcar"] = container.lenientDictionary(forKey: .railcar)
+        source["site_name"] = container.lenientString(forKey: .siteName)
+        source["tags"] = container.lenientDictionary(forKey: .tags)
+        source["title"] = container.lenientString(forKey: .title)
+
+        if let site {
+            var siteSource = [String: Any]()
+            siteSource["name"] = site.lenientString(forKey: .name)
+            siteSource["description"] = site.lenientString(forKey: .description)
+            source["meta"] = ["data": ["site": siteSource]]
+        }
+        return source
+    }
+
+    /// Like `-[RemoteReaderPost authorEmailFromAuthorDictionary:]`: the v1 API returns `0` when there's no email.
+    private static func authorEmail(_ email: String?) -> String {
+        // if 0 or less than minimum email length. a@a.aa
+        guard let email, email != "0", email.count >= 6 else {
+            return ""
+        }
+        return email
+    }
+
+    /// Like `-[RemoteReaderPost sortDateFromPostDictionary:]`: the date varies depending on the endpoint.
+    private static func sortDate(from container: KeyedDecodingContainer<CodingKeys>) -> String {
+        // Values set in editorial trumps the rest
+        container.lenientContainer(keyedBy: EditorialKeys.self, forKey: .editorial)?.lenientString(forKey: .displayedOn)
+            // Date liked is returned by the read/liked end point.
+            ?? container.lenientString(forKey: .dateLiked)
+            // Date tagged on is returned by read/tags/%s/posts endpoints.
+            ?? container.lenientString(forKey: .taggedOn)
+            ?? container.lenientString(forKey: .date)
+            ?? ""
+    }
+
+    /// Like `-[RemoteReaderPost readingTimeForWordCount:]`.
+    private static func readingTime(forWordCount wordCount: Int) -> NSNumber {
+        let minutesToRead = wordCount / 250
+        return NSNumber(value: minutesToRead < 2 ? 0 : minutesToRead)
+    }
+
+    /// Like `-[RemoteReaderPost sourceAttributionFromDictionary:]`.
+    private static func sourceAttribution(
+        from container: KeyedDecodingContainer<DiscoverMetadataKeys>
+    ) -> RemoteSourcePostAttribution? {
+        guard let taxonomies = container.lenientArray(forKey: .postFormats), !taxonomies.isEmpty else {
+            return nil
+        }
+
+        let attribution = container.lenientContainer(keyedBy: AttributionKeys.self, forKey: .attribution)
+        let featuredPostData = container.lenientContainer(keyedBy: FeaturedPostDataKeys.self, forKey: .featuredPostData)
+
+        let sourceAttribution = RemoteSourcePostAttribution()
+        sourceAttribution.permalink = container.lenientString(forKey: .permalink)
+        sourceAttribution.authorName = attribution?.lenientString(forKey: .authorName)
+        sourceAttribution.authorURL = attribution?.lenientString(forKey: .authorURL)
+        sourceAttribution.avatarURL = attribution?.lenientString(forKey: .avatarURL)
+        sourceAttribution.blogName = attribution?.lenientString(forKey: .blogName)
+        sourceAttribution.blogURL = attribution?.lenientString(forKey: .blogURL)
+        sourceAttribution.blogID = featuredPostData?.lenientNumber(forKey: .blogID)
+        sourceAttribution.postID = featuredPostData?.lenientNumber(forKey: .postID)
+        sourceAttribution.commentCount = featuredPostData?.lenientNumber(forKey: .commentCount)
+        sourceAttribution.likeCount = featuredPostData?.lenientNumber(forKey: .likeCount)
+        sourceAttribution.taxonomies = taxonomies.compactMap { taxonomy -> String? in
+            guard case let .object(values) = taxonomy else {
+                return nil
+            }
+            return values["slug"]?.jsonObject as? String
+        }
+        return sourceAttribution
+    }
+
+}
+
+/// The posts of a response of a Reader stream endpoint, like `read/following`.
+struct RemoteReaderPostsEnvelope: Decodable {
+    let posts: [RemoteReaderPost]
+    let algorithm: String?
+
+    private enum CodingKeys: String, CodingKey {
+        case posts
+        case algorithm
+    }
+
+    init(from decoder: Decoder) throws {
+        let container = try decoder.container(keyedBy: CodingKeys.self)
+        posts = try container.decodeIfPresent([RemoteReaderPostPayload].self, forKey: .posts)?.map(\.post) ?? []
+        algorithm = container.lenientString(forKey: .algorithm)
+    }
+}
+
+private extension Optional where Wrapped == StringInterningPool {
+
+    /// Interns the string in the pool, if there's one.
+    func intern(_ string: String) -> String {
+        self?.intern(string) ?? string
+    }
+
+}
+
+extension RemoteReaderPost {
+
+    /// Maps the posts of a Reader stream response, in the order of the response.
+    ///
+    /// The posts are mapped serially, on the caller's thread. Mapping them concurrently would block the caller while
+    /// other threads map them, which is the main thread for the Objective-C fetch and a thread of the cooperative pool
+    /// for the async ones.
+    ///
+    /// - Parameters:
+    ///   - offset: The offset of the first post, which the posts' `sortRank` is derived from. Pass `nil` to leave the
+    ///     `sortRank` that's derived from the posts' dates.
+    ///   - stringPool: The pool that the values that are repeated across posts are interned in, if any.
+    @objc(postsFromJSONArray:rankingFromOffset:stringPool:)
+    public static func posts(
+        fromJSONArray array: [[AnyHashable: Any]],
+        rankingFromOffset offset: NSNumber?,
+        stringPool: StringInterningPool? = nil
+    ) -> [RemoteReaderPost] {
+        let posts = array.map { RemoteReaderPost(dictionary: $0, stringPool: stringPool) }
+        rank(posts, fromOffset: offset?.doubleValue)
+        return posts
+    }
+
+    /// Sets the posts' `sortRank`, from the offset of the first post. The `sortRank` that's derived from the posts'
+    /// dates is left when the offset is `nil`.
+    static func rank(_ posts: [RemoteReaderPost], fromOffset offset: Double?) {
+        guard let offset else {
+            return
+        }
+        for (index, post) in posts.enumerated() {
+            // `sortRank`s are in descending order, whereas offsets are ascending.
+            post.sortRank = NSNumber(value: -(offset + Double(index)))
+        }
+    }
+
+}
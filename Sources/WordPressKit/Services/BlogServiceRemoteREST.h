@@ -2,6 +2,8 @@
 #import <WordPressKit/BlogServiceRemote.h>
 #import <WordPressKit/SiteServiceRemoteWordPressComREST.h>
 
+@class WordPressComRestApiBatchRequest;
+
 typedef void (^BlogDetailsHandler)(RemoteBlog *remoteBlog);
 typedef void (^SettingsHandler)(RemoteBlogSettings *settings);
 
@@ -66,4 +68,54 @@ typedef void (^SettingsHandler)(RemoteBlogSettings *settings);
                         success:(void(^)(NSDictionary *siteInfoDict))success
                         failure:(void (^)(NSError *error))failure;
 
+#pragma mark - Batch requests
+
+/**
+ *  @brief      Creates a request that synchronizes a blog and its top-level details.
+ *
+ *  @note       The request can be sent along with other requests in one round trip, using
+ *              `-[WordPressComRestApi GETWithBatch:]`.
+ *
+ *  @param      success     The block that will be executed on success.  Can be nil.
+ *  @param      failure     The block that will be executed on failure.  Can be nil.
+ */
+- (WordPressComRestApiBatchRequest *)batchRequestToSyncBlogWithSuccess:(BlogDetailsHandler)success
+                                                               failure:(void (^)(NSError *error))failure;
+
+/**
+ *  @brief      Creates a request that synchronizes a blog's settings.
+ *
+ *  @note       The request can be sent along with other requests in one round trip, using
+ *              `-[WordPressComRestApi GETWithBatch:]`.
+ *
+ *  @param      success     The block that will be executed on success.  Can be nil.
+ *  @param      failure     The block that will be executed on failure.  Can be nil.
+ */
+- (WordPressComRestApiBatchRequest *)batchRequestToSyncBlogSettingsWithSuccess:(SettingsHandler)success
+                                                                       failure:(void (^)(NSError *error))failure;
+
+/**
+ *  @brief      Creates a request that synchronizes a blog's post types.
+ *
+ *  @note       The request can be sent along with other requests in one round trip, using
+ *              `-[WordPressComRestApi GETWithBatch:]`.
+ *
+ *  @param      success     The block that will be executed on success.  Can be nil.
+ *  @param      failure     The block that will be executed on failure.  Can be nil.
+ */
+- (WordPressComRestApiBatchRequest *)batchRequestToSyncPostTypesWithSuccess:(PostTypesHandler)success
+                                                                    failure:(void (^)(NSError *error))failure;
+
+/**
+ *  @brief      Creates a request that synchronizes a blog's post formats.
+ *
+ *  @note       The request can be sent along with other requests in one round trip, using
+ *              `-[WordPressComRestApi GETWithBatch:]`.
+ *
+ *  @param      success     The block that will be executed on success.  Can be nil.
+ *  @param      failure     The block that will be executed on failure.  Can be nil.
+ */
+- (WordPressComRestApiBatchRequest *)batchRequestToSyncPostFormatsWithSuccess:(PostFormatsHandler)success
+                                                                      failure:(void (^)(NSError *error))failure;
+
 @end
@@ -133,101 +133,135 @@ static NSInteger const RemoteBlogUncategorizedCategory                      = 1;
 
 - (void)syncPostTypesWithSuccess:(PostTypesHandler)success
                          failure:(void (^)(NSError *error))failure
+{
+    [self getRequest:[self batchRequestToSyncPostTypesWithSuccess:success failure:failure]];
+}
+
+- (void)syncPostFormatsWithSuccess:(PostFormatsHandler)success
+                           failure:(void (^)(NSError *))failure
+{
+    [self getRequest:[self batchRequestToSyncPostFormatsWithSuccess:success failure:failure]];
+}
+
+- (void)syncBlogWithSuccess:(BlogDetailsHandler)success
+                    failure:(void (^)(NSError *))failure
+{
+    [self getRequest:[self batchRequestToSyncBlogWithSuccess:success failure:failure]];
+}
+
+- (void)syncBlogSettingsWithSuccess:(SettingsHandler)success
+                        failure:(void (^)(NSError *error))failure
+{
+    [self getRequest:[self batchRequestToSyncBlogSettingsWithSuccess:success failure:failure]];
+}
+
+#pragma mark - Batch requests
+
+- (WordPressComRestApiBatchRequest *)batchRequestToSyncPostTypesWithSuccess:(PostTypesHandler)success
+                                                                    failure:(void (^)(NSError *error))failure
 {
     NSString *path = [self pathForPostTypes];
     NSString *requestUrl = [self pathForEndpoint:path
                                      withVersion:WordPressComRESTAPIVersion_1_1];
     NSDictionary *parameters = @{@"context": @"edit"};
-    [self.wordPressComRESTAPI get:requestUrl
-       parameters:parameters
-          success:^(NSDictionary *responseObject, NSHTTPURLResponse *httpResponse) {
-             
-              NSAssert([responseObject isKindOfClass:[NSDictionary class]], @"Response should be a dictionary.");
-              NSArray <RemotePostType *> *postTypes = [[responseObject arrayForKey:RemotePostTypesKey] wp_map:^id(NSDictionary *json) {
-                  return [self remotePostTypeWithDictionary:json];
-              }];
-              if (!postTypes.count) {
-                  WPKitLogError(@"Response to %@ did not include post types for site.", requestUrl);
-                  failure(nil);
-                  return;
-              }
-              if (success) {
-                  success(postTypes);
-              }
-          } failure:^(NSError *error, NSHTTPURLResponse *httpResponse) {
-              if (failure) {
-                  failure(error);
-              }
-          }];
+    return [[WordPressComRestApiBatchRequest alloc] initWithPath:requestUrl
+                                                      parameters:parameters
+                                                         success:^(NSDictionary *responseObject, NSHTTPURLResponse *httpResponse) {
+
+                                                             NSAssert([responseObject isKindOfClass:[NSDictionary class]], @"Response should be a dictionary.");
+                                                             NSArray <RemotePostType *> *postTypes = [[responseObject arrayForKey:RemotePostTypesKey] wp_map:^id(NSDictionary *json) {
+                                                                 return [self remotePostTypeWithDictionary:json];
+                                                             }];
+                                                             if (!postTypes.count) {
+                                                                 WPKitLogError(@"Response to %@ did not include post types for site.", requestUrl);
+                                                                 failure(nil);
+                                                                 return;
+                                                             }
+                                                             if (success) {
+                                                                 success(postTypes);
+                                                             }
+                                                         } failure:^(NSError *error, NSHTTPURLResponse *httpResponse) {
+                                                             if (failure) {
+                                                                 failure(error);
+                                                             }
+                                                         }];
 }
 
-- (void)syncPostFormatsWithSuccess:(PostFormatsHandler)success
-                           failure:(void (^)(NSError *))failure
+- (WordPressComRestApiBatchRequest *)batchRequestToSyncPostFormatsWithSuccess:(PostFormatsHandler)success
+                                                                      failure:(void (^)(NSError *error))failure
 {
     NSString *path = [self pathForPostFormats];
     NSString *requestUrl = [self pathForEndpoint:path
                                      withVersion:WordPressComRESTAPIVersion_1_1];
     
-    [self.wordPressComRESTAPI get:requestUrl
-       parameters:nil
-          success:^(id responseObject, NSHTTPURLResponse *httpResponse) {
-              NSDictionary *formats = [self mapPostFormatsFromResponse:responseObject[@"formats"]];
-              if (success) {
-                  success(formats);
-              }
-          } failure:^(NSError *error, NSHTTPURLResponse *httpResponse) {
-              if (failure) {
-                  failure(error);
-              }
-          }];
+    return [[WordPressComRestApiBatchRequest alloc] initWithPath:requestUrl
+                                                      parameters:nil
+                                                         success:^(id responseObject, NSHTTPURLResponse *httpResponse) {
+                                                             NSDictionary *formats = [self mapPostFormatsFromResponse:responseObject[@"formats"]];
+                                                             if (success) {
+                                                                 success(formats);
+                                                             }
+                                                         } failure:^(NSError *error, NSHTTPURLResponse *httpResponse) {
+                                                             if (failure) {
+                                                                 failure(error);
+                                                             }
+                                                         }];
 }
 
-- (void)syncBlogWithSuccess:(BlogDetailsHandler)success
-                    failure:(void (^)(NSError *))failure
+- (WordPressComRestApiBatchRequest *)batchRequestToSyncBlogWithSuccess:(BlogDetailsHandler)success
+                                                               failure:(void (^)(NSError *error))failure
 {
     NSString *path = [self pathForSite];
     NSString *requestUrl = [self pathForEndpoint:path
                                      withVersion:WordPressComRESTAPIVersion_1_1];
 
-    [self.wordPressComRESTAPI get:requestUrl
-                       parameters:nil
-                          success:^(id responseObject, NSHTTPURLResponse *httpResponse) {
-                              NSDictionary *responseDict = (NSDictionary *)responseObject;
-                              RemoteBlog *remoteBlog = [[RemoteBlog alloc] initWithJSONDictionary:responseDict];
-                              if (success) {
-                                  success(remoteBlog);
-                              }
-                          } failure:^(NSError *error, NSHTTPURLResponse *httpResponse) {
-                              if (failure) {
-                                  failure(error);
-                              }
-                          }];
+    return [[WordPressComRestApiBatchRequest alloc] initWithPath:requestUrl
+                                                      parameters:nil
+                                                         success:^(id responseObject, NSHTTPURLResponse *httpResponse) {
+                                                             NSDictionary *responseDict = (NSDictionary *)responseObject;
+                                                             RemoteBlog *remoteBlog = [[RemoteBlog alloc] initWithJSONDictionary:responseDict];
+                                                             if (success) {
+                                                                 success(remoteBlog);
+                                                             }
+                                                         } failure:^(NSError *error, NSHTTPURLResponse *httpResponse) {
+                                                             if (failure) {
+                                                                 failure(error);
+                                                             }
+                                                         }];
 }
 
-- (void)syncBlogSettingsWithSuccess:(SettingsHandler)success
-                        failure:(void (^)(NSError *error))failure
+- (WordPressComRestApiBatchRequest *)batchRequestToSyncBlogSettingsWithSuccess:(SettingsHandler)success
+                                                                       failure:(void (^)(NSError *error))failure
 {
     NSString *path = [self pathForSettings];
     NSString *requestUrl = [self pathForEndpoint:path withVersion:WordPressComRESTAPIVersion_1_1];
     
-    [self.wordPressComRESTAPI get:requestUrl
-       parameters:nil
-          success:^(id responseObject, NSHTTPURLResponse *httpResponse) {
-              if (![responseObject isKindOfClass:[NSDictionary class]]){
-                  if (failure) {
-                      failure(nil);
-                  }
-                  return;
-              }
-              RemoteBlogSettings *remoteSettings = [self remoteBlogSettingFromJSONDictionary:responseObject];
-              if (success) {
-                  success(remoteSettings);
-              }
-          } failure:^(NSError *error, NSHTTPURLResponse *httpResponse) {
-              if (failure) {
-                  failure(error);
-              }
-          }];
+    return [[WordPressComRestApiBatchRequest alloc] initWithPath:requestUrl
+                                                      parameters:nil
+                                                         success:^(id responseObject, NSHTTPURLResponse *httpResponse) {
+                                                             if (![responseObject isKindOfClass:[NSDictionary class]]){
+                                                                 if (failure) {
+                                                                     failure(nil);
+                                                                 }
+                                                                 return;
+                                                             }
+                                                             RemoteBlogSettings *remoteSettings = [self remoteBlogSettingFromJSONDictionary:responseObject];
+                                                             if (success) {
+                                                                 success(remoteSettings);
+                                                             }
+                                                         } failure:^(NSError *error, NSHTTPURLResponse *httpResponse) {
+                                                             if (failure) {
+                                                                 failure(error);
+                                                             }
+                                                         }];
+}
+
+- (void)getRequest:(WordPressComRestApiBatchRequest *)request
+{
+    [self.wordPressComRESTAPI get:request.path
+                       parameters:request.parameters
+                          success:request.success
+                          failure:request.failure];
 }
 
 - (void)updateBlogSettings:(RemoteBlogSettings *)settings
@@ -2,6 +2,8 @@
 #import <WordPressKit/BlogServiceRemote.h>
 #import <WordPressKit/ServiceRemoteWordPressXMLRPC.h>
 
+@class WordPressOrgXMLRPCApiMethodCall;
+
 typedef void (^OptionsHandler)(NSDictionary *options);
 
 @interface BlogServiceRemoteXMLRPC : ServiceRemoteWordPressXMLRPC<BlogServiceRemote>
@@ -29,4 +31,42 @@ typedef void (^OptionsHandler)(NSDictionary *options);
                       success:(SuccessHandler)success
                       failure:(void (^)(NSError *error))failure;
 
+#pragma mark - Multicall
+
+/**
+ *  @brief      Creates a method call that synchronizes a blog's options.
+ *
+ *  @note       The call can be sent along with other calls in one round trip, using
+ *              `-[WordPressOrgXMLRPCApi callMethods:]`.
+ *
+ *  @param      success     The block that will be executed on success.  Can be nil.
+ *  @param      failure     The block that will be executed on failure.  Can be nil.
+ */
+- (WordPressOrgXMLRPCApiMethodCall *)methodCallToSyncBlogOptionsWithSuccess:(OptionsHandler)success
+                                                                    failure:(void (^)(NSError *error))failure;
+
+/**
+ *  @brief      Creates a method call that synchronizes a blog's post types.
+ *
+ *  @note       The call can be sent along with other calls in one round trip, using
+ *              `-[WordPressOrgXMLRPCApi callMethods:]`.
+ *
+ *  @param      success     The block that will be executed on success.  Can be nil.
+ *  @param      failure     The block that will be executed on failure.  Can be nil.
+ */
+- (WordPressOrgXMLRPCApiMethodCall *)methodCallToSyncPostTypesWithSuccess:(PostTypesHandler)success
+                                                                  failure:(void (^)(NSError *error))failure;
+
+/**
+ *  @brief      Creates a method call that synchronizes a blog's post formats.
+ *
+ *  @note       The call can be sent along with other calls in one round trip, using
+ *              `-[WordPressOrgXMLRPCApi callMethods:]`.
+ *
+ *  @param      success     The block that will be executed on success.  Can be nil.
+ *  @param      failure     The block that will be executed on failure.  Can be nil.
+ */
+- (WordPressOrgXMLRPCApiMethodCall *)methodCallToSyncPostFormatsWithSuccess:(PostFormatsHandler)success
+                                                                    failure:(void (^)(NSError *error))failure;
+
 @end
@@ -74,96 +74,118 @@ static NSString * const RemotePostTypePublicKey = @"public";
 
 - (void)syncPostTypesWithSuccess:(PostTypesHandler)success failure:(void (^)(NSError *error))failure
 {
-    NSArray *parameters = [self defaultXMLRPCArguments];
-    [self.api callMethod:@"wp.getPostTypes"
-              parameters:parameters
-                 success:^(id responseObject, NSHTTPURLResponse *response) {
-
-                     NSAssert([responseObject isKindOfClass:[NSDictionary class]], @"Response should be a dictionary.");
-                     NSArray <RemotePostType *> *postTypes = [[responseObject allObjects] wp_map:^id(NSDictionary *json) {
-                         return [self remotePostTypeFromXMLRPCDictionary:json];
-                     }];
-                     if (!postTypes.count) {
-                         WPKitLogError(@"Response to wp.getPostTypes did not include post types for site.");
-                         failure(nil);
-                         return;
-                     }
-                     if (success) {
-                         success(postTypes);
-                     }
-                 } failure:^(NSError *error, NSHTTPURLResponse *response) {
-                     WPKitLogError(@"Error syncing post types (%@): %@", response.URL, error);
-                     
-                     if (failure) {
-                         failure(error);
-                     }
-                 }];
+    [self callMethod:[self methodCallToSyncPostTypesWithSuccess:success failure:failure]];
 }
 
 - (void)syncPostFormatsWithSuccess:(PostFormatsHandler)success failure:(void (^)(NSError *))failure
 {
-    NSDictionary *dict = @{@"show-supported": @"1"};
-    NSArray *parameters = [self XMLRPCArgumentsWithExtra:dict];
+    [self callMethod:[self methodCallToSyncPostFormatsWithSuccess:success failure:failure]];
+}
 
-    [self.api callMethod:@"wp.getPostFormats"
-              parameters:parameters
-                 success:^(id responseObject, NSHTTPURLResponse *response) {
-                     NSAssert([responseObject isKindOfClass:[NSDictionary class]], @"Response should be a dictionary.");
-
-                     NSDictionary *postFormats = responseObject;
-                     NSDictionary *respDict = responseObject;
-                     if ([postFormats objectForKey:@"supported"]) {
-                         NSMutableArray *supportedKeys;
-                         if ([[postFormats objectForKey:@"supported"] isKindOfClass:[NSArray class]]) {
-                             supportedKeys = [NSMutableArray arrayWithArray:[postFormats objectForKey:@"supported"]];
-                         } else if ([[postFormats objectForKey:@"supported"] isKindOfClass:[NSDictionary class]]) {
-                             supportedKeys = [NSMutableArray arrayWithArray:[[postFormats objectForKey:@"supported"] allValues]];
-                         }
+- (void)syncBlogOptionsWithSuccess:(OptionsHandler)success failure:(void (^)(NSError *))failure
+{
+    [self callMethod:[self methodCallToSyncBlogOptionsWithSuccess:success failure:failure]];
+}
 
-                         // Standard isn't included in the list of supported formats? Maybe it will be one day?
-                         if (![supportedKeys containsObject:@"standard"]) {
-                             [supportedKeys addObject:@"standard"];
-                         }
-
-                         NSDictionary *allFormats = [postFormats objectForKey:@"all"];
-                         NSMutableArray *supportedValues = [NSMutableArray array];
-                         for (NSString *key in supportedKeys) {
-                             [supportedValues addObject:[allFormats objectForKey:key]];
-                         }
-                         respDict = [NSDictionary dictionaryWithObjects:supportedValues forKeys:supportedKeys];
-                     }
-                     
-                     if (success) {
-                         success(respDict);
-                     }
-                 } failure:^(NSError *error, NSHTTPURLResponse *response) {
-                     WPKitLogError(@"Error syncing post formats (%@): %@", response.URL, error);
-                     
-                     if (failure) {
-                         failure(error);
-                     }
-                 }];
+#pragma mark - Multicall
 
+- (WordPressOrgXMLRPCApiMethodCall *)methodCallToSyncPostTypesWithSuccess:(PostTypesHandler)success
+                                                                  failure:(void (^)(NSError *error))failure
+{
+    NSArray *parameters = [self defaultXMLRPCArguments];
+    return [[WordPressOrgXMLRPCApiMethodCall alloc] initWithMethod:@"wp.getPostTypes"
+                                                        parameters:parameters
+                                                           success:^(id responseObject, NSHTTPURLResponse *response) {
+
+                                                               NSAssert([responseObject isKindOfClass:[NSDictionary class]], @"Response should be a dictionary.");
+                                                               NSArray <RemotePostType *> *postTypes = [[responseObject allObjects] wp_map:^id(NSDictionary *json) {
+                                                                   return [self remotePostTypeFromXMLRPCDictionary:json];
+                                                               }];
+                                                               if (!postTypes.count) {
+                                                                   WPKitLogError(@"Response to wp.getPostTypes did not include post types for site.");
+                                                                   if (failure) {
+                                                                       failure(nil);
+                                                                   }
+                                                                   return;
+                                                               }
+                                                               if (success) {
+                                                                   success(postTypes);
+                                                               }
+                                                           } failure:^(NSError *error, NSHTTPURLResponse *response) {
+                                                               WPKitLogError(@"Error syncing post types (%@): %@", response.URL, error);
+
+                                                               if (failure) {
+                                                                   failure(error);
+                                                               }
+                                                           }];
 }
 
-- (void)syncBlogOptionsWithSuccess:(OptionsHandler)success failure:(void (^)(NSError *))failure
+- (WordPressOrgXMLRPCApiMethodCall *)methodCallToSyncPostFormatsWithSuccess:(PostFormatsHandler)success
+                                                                    failure:(void (^)(NSError *error))failure
 {
-    NSArray *parameters = [self defaultXMLRPCArguments];
-    [self.api callMethod:@"wp.getOptions"
-              parameters:parameters
-                 success:^(id responseObject, NSHTTPURLResponse *response) {
-                     NSAssert([responseObject isKindOfClass:[NSDictionary class]], @"Response should be a dictionary.");
+    NSDictionary *dict = @{@"show-supported": @"1"};
+    NSArray *parameters = [self XMLRPCArgumentsWithExtra:dict];
 
-                     if (success) {
-                         success(responseObject);
-                     }
-                 } failure:^(NSError *error, NSHTTPURLResponse *response) {
-                     WPKitLogError(@"Error syncing blog options: %@", error);
+    return [[WordPressOrgXMLRPCApiMethodCall alloc] initWithMethod:@"wp.getPostFormats"
+                                                        parameters:parameters
+                                                           success:^(id responseObject, NSHTTPURLResponse *response) {
+                                                               NSAssert([responseObject isKindOfClass:[NSDictionary class]], @"Response should be a dictionary.");
+
+                                                               NSDictionary *postFormats = responseObject;
+                                                               NSDictionary *respDict = responseObject;
+                                                               if ([postFormats objectForKey:@"supported"]) {
+                                                                   NSMutableArray *supportedKeys;
+                                                                   if ([[postFormats objectForKey:@"supported"] isKindOfClass:[NSArray class]]) {
+                                                                       supportedKeys = [NSMutableArray arrayWithArray:[postFormats objectForKey:@"supported"]];
+                                                                   } else if ([[postFormats objectForKey:@"supported"] isKindOfClass:[NSDictionary class]]) {
+                                                                       supportedKeys = [NSMutableArray arrayWithArray:[[postFormats objectForKey:@"supported"] allValues]];
+                                                                   }
+
+                                                                   // Standard isn't included in the list of supported formats? Maybe it will be one day?
+                                                                   if (![supportedKeys containsObject:@"standard"]) {
+                                                                       [supportedKeys addObject:@"standard"];
+                                                                   }
+
+                                                                   NSDictionary *allFormats = [postFormats objectForKey:@"all"];
+                                                                   NSMutableArray *supportedValues = [NSMutableArray array];
+                                                                   for (NSString *key in supportedKeys) {
+                                                                       [supportedValues addObject:[allFormats objectForKey:key]];
+                                                                   }
+                                                                   respDict = [NSDictionary dictionaryWithObjects:supportedValues forKeys:supportedKeys];
+                                                               }
+
+                                                               if (success) {
+                                                                   success(respDict);
+                                                               }
+                                                           } failure:^(NSError *error, NSHTTPURLResponse *response) {
+                                                               WPKitLogError(@"Error syncing post formats (%@): %@", response.URL, error);
+
+                                                               if (failure) {
+                                                                   failure(error);
+                                                               }
+                                                           }];
 
-                     if (failure) {
-                         failure(error);
-                     }
-                 }];
+}
+
+- (WordPressOrgXMLRPCApiMethodCall *)methodCallToSyncBlogOptionsWithSuccess:(OptionsHandler)success
+                                                                    failure:(void (^)(NSError *error))failure
+{
+    NSArray *parameters = [self defaultXMLRPCArguments];
+    return [[WordPressOrgXMLRPCApiMethodCall alloc] initWithMethod:@"wp.getOptions"
+                                                        parameters:parameters
+                                                           success:^(id responseObject, NSHTTPURLResponse *response) {
+                                                               NSAssert([responseObject isKindOfClass:[NSDictionary class]], @"Response should be a dictionary.");
+
+                                                               if (success) {
+                                                                   success(responseObject);
+                                                               }
+                                                           } failure:^(NSError *error, NSHTTPURLResponse *response) {
+                                                               WPKitLogError(@"Error syncing blog options: %@", error);
+
+                                                               if (failure) {
+                                                                   failure(error);
+                                                               }
+                                                           }];
 }
 
 - (void)updateBlogOptionsWith:(NSDictionary *)remoteBlogOptions success:(SuccessHandler)success failure:(void (^)(NSError *))failure
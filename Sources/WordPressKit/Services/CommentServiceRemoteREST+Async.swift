@@ -0,0 +1,44 @@
+import Foundation
+
+extension CommentServiceRemoteREST {
+
+    /// Fetches a comment.
+    ///
+    /// See `getComment(withID:success:failure:)`.
+    public func getComment(withID commentID: Int) async throws -> RemoteComment {
+        try await wordPressComRestApi.perform(
+            .get,
+            path: Endpoint.comment.path(siteID, commentID),
+            jsonDecoder: JSONDecoder(stringPool: stringPool),
+            type: RemoteCommentPayload.self
+        ).get().body.comment
+    }
+
+    /// Fetches a page of the hierarchical list of comments on a post.
+    ///
+    /// See `syncHierarchicalComments(forPost:page:number:success:failure:)`.
+    public func syncHierarchicalComments(forPost postID: Int, page: Int, number: Int) async throws -> (comments: [RemoteComment], found: Int) {
+        let path = Endpoint.replies.path(siteID, postID)
+        let parameters: [String: AnyObject] = [
+            "page": page as NSNumber,
+            "number": number as NSNumber,
+            // Force fetching data from shadow site on Jetpack sites
+            "force": "wpcom" as NSString,
+        ]
+        // The comments are decoded straight from the response data, which is measured as the decode phase of the request.
+        let body = try await wordPressComRestApi.perform(
+            .get,
+            path: path,
+            parameters: parameters,
+            jsonDecoder: JSONDecoder(stringPool: stringPool),
+            type: RemoteCommentsEnvelope.self
+        ).get().body
+        return (body.comments, body.found)
+    }
+
+}
+
+private enum Endpoint {
+    static let comment = WordPressComEndpoint<TwoPathParameters>("sites/:site/comments/:comment", version: ._1_1)
+    static let replies = WordPressComEndpoint<TwoPathParameters>("sites/:site/posts/:post/replies?order=ASC&hierarchical=1", version: ._1_1)
+}
@@ -4,9 +4,17 @@
 
 @class RemoteUser;
 @class RemoteLikeUser;
+@class StringInterningPool;
 
 @interface CommentServiceRemoteREST : SiteServiceRemoteWordPressComREST <CommentServiceRemote>
 
+/**
+ The pool that the values that are repeated across comments, like the authors and their avatar URLs, are interned in
+ while the responses are mapped. Set it for the duration of a sync session to share the strings across responses. The
+ values aren't interned by default.
+ */
+@property (nonatomic, strong, nullable) StringInterningPool *stringPool;
+
 /**
  Fetch a hierarchical list of comments for the specified post on the specified site.
  The comments are returned in the order of nesting, not date.
@@ -97,4 +105,7 @@
                      success:(void (^ _Nullable)(NSArray<RemoteLikeUser *> * _Nonnull users, NSNumber * _Nonnull found))success
                      failure:(void (^ _Nullable)(NSError * _Nullable))failure;
 
+/// Returns a remote comment with the given data.
+- (RemoteComment * _Nonnull)remoteCommentFromJSONDictionary:(NSDictionary * _Nonnull)jsonDictionary;
+
 @end
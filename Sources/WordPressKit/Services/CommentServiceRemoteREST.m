@@ -494,6 +494,10 @@
     comment.content = jsonDictionary[@"content"];
     comment.rawContent = jsonDictionary[@"raw_content"];
 
+    if (self.stringPool) {
+        [comment internStringsInPool:self.stringPool];
+    }
+
     return comment;
 }
 
@@ -0,0 +1,118 @@
+import Foundation
+
+extension MediaServiceRemoteREST {
+
+    /// Returns an asynchronous sequence of the site's media library pages.
+    ///
+    /// Unlike `getMediaLibrary(pageLoad:success:failure:)`, the media items are not accumulated: each page is returned
+    /// as soon as it's loaded, and can be persisted and released before the next page is requested. The next page is
+    /// prefetched while the current page is being mapped and processed by the caller.
+    ///
+    /// To sync only the media items that were changed since the last sync, record the date when a sync starts, and pass
+    /// it as `modifiedAfter` in the next sync.
+    ///
+    /// - Parameters:
+    ///   - modifiedAfter: Only load the media items that were modified after this date. Pass `nil` to load all items.
+    ///   - pageSize: The number of media items in each page.
+    public func mediaLibraryPages(modifiedAfter: Date? = nil, pageSize: Int = 100) -> MediaLibraryPages {
+        let path = Endpoint.media.path(siteID)
+
+        var parameters: [String: AnyObject] = ["number": pageSize as NSNumber]
+        if let modifiedAfter {
+            parameters["modified_after"] = DateFormatter.wordPressCom.string(from: modifiedAfter) as NSString
+        }
+
+        return MediaLibraryPages { [wordPressComRestApi] pageHandle in
+            var pageParameters = parameters
+            pageParameters["page_handle"] = pageHandle as NSString?
+
+            // Cancelling the task doesn't cancel the HTTP request, which is only cancelled through its progress.
+            let progress = Progress(totalUnitCount: 1)
+            let response = try await withTaskCancellationHandler {
+                try await wordPressComRestApi.perform(.get, path: path, parameters: pageParameters, fulfilling: progress).get()
+            } onCancel: {
+                progress.cancel()
+            }
+            guard let body = response.body as? [String: AnyObject] else {
+                throw WordPressAPIError<WordPressComRestApiEndpointError>.unparsableResponse(response: response.response, body: nil)
+            }
+
+            let media = body["media"] as? [[String: AnyObject]] ?? []
+            let nextPage = (body["meta"] as? [String: AnyObject])?["next_page"] as? String
+            return (media, nextPage?.isEmpty == false ? nextPage : nil)
+        }
+    }
+
+}
+
+/// An asynchronous sequence of media library pages. See `MediaServiceRemoteREST.mediaLibraryPages(modifiedAfter:pageSize:)`.
+public struct MediaLibraryPages: AsyncSequence {
+    public typealias Element = [RemoteMedia]
+
+    typealias Page = (media: [[String: AnyObject]], nextPageHandle: String?)
+
+    private let loadPage: (_ pageHandle: String?) async throws -> Page
+
+    init(loadPage: @escaping (_ pageHandle: String?) async throws -> Page) {
+        self.loadPage = loadPage
+    }
+
+    public func makeAsyncIterator() -> AsyncIterator {
+        AsyncIterator(loadPage: loadPage)
+    }
+
+    public struct AsyncIterator: AsyncIteratorProtocol {
+        private let loadPage: (_ pageHandle: String?) async throws -> Page
+        private let prefetch = Prefetch()
+        private var isFinished = false
+
+        init(loadPage: @escaping (_ pageHandle: String?) async throws -> Page) {
+            self.loadPage = loadPage
+        }
+
+        public mutating func next() async throws -> [RemoteMedia]? {
+            guard !isFinished else {
+                return nil
+            }
+
+            let loadPage = self.loadPage
+            let task = prefetch.task ?? Task { try await loadPage(nil) }
+            prefetch.task = nil
+
+            let page: Page
+            do {
+                page = try await withTaskCancellationHandler {
+                    try await task.value
+                } onCancel: {
+                    task.cancel()
+                }
+            } catch {
+                isFinished = true
+                throw error
+            }
+
+            if let pageHandle = page.nextPageHandle {
+                // Load the next page while this page is being processed.
+                prefetch.task = Task { try await loadPage(pageHandle) }
+            } else {
+                isFinished = true
+            }
+
+            return page.media.map { MediaServiceRemoteREST.remoteMedia(fromJSONDictionary: $0) }
+        }
+    }
+
+    /// The request of the next page, which is cancelled when the iterator is released, i.e. when the caller stops
+    /// iterating before the last page. Cancelling the task cancels the page's HTTP request too.
+    private final class Prefetch {
+        var task: Task<Page, Error>?
+
+        deinit {
+            task?.cancel()
+        }
+    }
+}
+
+private enum Endpoint {
+    static let media = WordPressComEndpoint<OnePathParameter>("sites/:site/media", version: ._1_1)
+}
@@ -2,8 +2,23 @@
 #import <WordPressKit/MediaServiceRemote.h>
 #import <WordPressKit/SiteServiceRemoteWordPressComREST.h>
 
+@class MediaUploadIndex;
+
 @interface MediaServiceRemoteREST : SiteServiceRemoteWordPressComREST <MediaServiceRemote>
 
+/**
+ The index that the files of the uploaded media are looked up in before they're uploaded, by the hash of their content.
+ When a media with the same content is in the index, it's returned instead of uploading the file again. The files are
+ always uploaded by default.
+ */
+@property (nonatomic, strong) MediaUploadIndex *uploadIndex;
+
+/**
+ The lane that the media files are uploaded in, when the API has a `HTTPRequestScheduler`. Defaults to
+ `HTTPRequestPriorityDefault`.
+ */
+@property (nonatomic, assign) HTTPRequestPriority uploadPriority;
+
 /**
  Populates a RemoteMedia instance using values from a json dict returned
  from the endpoint.
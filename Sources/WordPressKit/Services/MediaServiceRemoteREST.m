@@ -146,6 +146,7 @@ const NSInteger WPRestErrorCodeMediaNew = 10;
     [self.wordPressComRESTAPI multipartPOST:requestUrl
                                  parameters:parameters
                                   fileParts:fileParts
+                                   priority:self.uploadPriority
                             requestEnqueued:^(NSNumber *taskID) {
                                 if (requestEnqueued) {
                                     requestEnqueued(taskID);
@@ -188,10 +189,6 @@ const NSInteger WPRestErrorCodeMediaNew = 10;
     NSString *type = media.mimeType;
     NSString *filename = media.file;
 
-    NSString *apiPath = [NSString stringWithFormat:@"sites/%@/media/new", self.siteID];
-    NSString *requestUrl = [self pathForEndpoint:apiPath
-                                     withVersion:WordPressComRESTAPIVersion_1_1];
-
     NSDictionary *parameters = [self parametersForUploadMedia:media];
 
     if (media.localURL == nil || filename == nil || type == nil) {
@@ -203,35 +200,66 @@ const NSInteger WPRestErrorCodeMediaNew = 10;
         }
         return;
     }
-    FilePart *filePart = [[FilePart alloc] initWithParameterName:@"media[]" url:media.localURL fileName:filename mimeType:type];
-    __block NSProgress *localProgress = [self.wordPressComRESTAPI multipartPOST:requestUrl
-                                                                     parameters:parameters
-                                                                      fileParts:@[filePart]
-                                                                requestEnqueued:nil
-                                                                        success:^(id  _Nonnull responseObject, NSHTTPURLResponse * _Nullable httpResponse) {
-                                                                            NSDictionary *response = (NSDictionary *)responseObject;
-                                                                            NSArray *errorList = response[@"errors"];
-                                                                            NSArray *mediaList = response[@"media"];
-                                                                            if (mediaList.count > 0){
-                                                                                RemoteMedia *remoteMedia = [MediaServiceRemoteREST remoteMediaFromJSONDictionary:mediaList[0]];
-                                                                                if (success) {
-                                                                                    success(remoteMedia);
-                                                                                }
-                                                                            } else {
-                                                                                NSError *error = [self processMediaUploadErrors:errorList];
-                                                                                if (failure) {
-                                                                                    failure(error);
-                                                                                }
-                                                                            }
-
-                                                                        } failure:^(NSError *error, NSHTTPURLResponse *httpResponse) {
-                                                                            WPKitLogDebug(@"Error uploading file: %@", [error localizedDescription]);
-                                                                            if (failure) {
-                                                                                failure(error);
-                                                                            }
-                                                                        }];
-
-    *progress = localProgress;
+
+    if (self.uploadIndex == nil) {
+        NSProgress *localProgress = [self uploadFileOfMedia:media parameters:parameters contentHashHandler:nil success:success failure:failure];
+        if (progress) {
+            *progress = localProgress;
+        }
+        return;
+    }
+
+    NSProgress *localProgress = [self.uploadIndex uploadMedia:media
+                                                      service:self
+                                                       upload:^NSProgress *(void (^hashed)(NSString *), void (^uploaded)(RemoteMedia *), void (^failed)(NSError *)) {
+                                                           return [self uploadFileOfMedia:media parameters:parameters contentHashHandler:hashed success:uploaded failure:failed];
+                                                       }
+                                                      success:success
+                                                      failure:failure];
+    if (progress) {
+        *progress = localProgress;
+    }
+}
+
+- (NSProgress *)uploadFileOfMedia:(RemoteMedia *)media
+                       parameters:(NSDictionary *)parameters
+               contentHashHandler:(void (^)(NSString *contentHash))contentHashHandler
+                          success:(void (^)(RemoteMedia *remoteMedia))success
+                          failure:(void (^)(NSError *error))failure
+{
+    NSString *apiPath = [NSString stringWithFormat:@"sites/%@/media/new", self.siteID];
+    NSString *requestUrl = [self pathForEndpoint:apiPath
+                                     withVersion:WordPressComRESTAPIVersion_1_1];
+
+    FilePart *filePart = [[FilePart alloc] initWithParameterName:@"media[]" url:media.localURL fileName:media.file mimeType:media.mimeType];
+    filePart.contentHashHandler = contentHashHandler;
+    return [self.wordPressComRESTAPI multipartPOST:requestUrl
+                                        parameters:parameters
+                                         fileParts:@[filePart]
+                                          priority:self.uploadPriority
+                                   requestEnqueued:nil
+                                           success:^(id  _Nonnull responseObject, NSHTTPURLResponse * _Nullable httpResponse) {
+                                               NSDictionary *response = (NSDictionary *)responseObject;
+                                               NSArray *errorList = response[@"errors"];
+                                               NSArray *mediaList = response[@"media"];
+                                               if (mediaList.count > 0){
+                                                   RemoteMedia *remoteMedia = [MediaServiceRemoteREST remoteMediaFromJSONDictionary:mediaList[0]];
+                                                   if (success) {
+                                                       success(remoteMedia);
+                                                   }
+                                               } else {
+                                                   NSError *error = [self processMediaUploadErrors:errorList];
+                                                   if (failure) {
+                                                       failure(error);
+                                                   }
+                                               }
+
+                                           } failure:^(NSError *error, NSHTTPURLResponse *httpResponse) {
+                                               WPKitLogDebug(@"Error uploading file: %@", [error localizedDescription]);
+                                               if (failure) {
+                                                   failure(error);
+                                               }
+                                           }];
 }
 
 - (NSError *)processMediaUploadErrors:(NSArray *)errorList {
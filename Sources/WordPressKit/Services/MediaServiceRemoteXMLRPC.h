@@ -2,5 +2,15 @@
 #import <WordPressKit/MediaServiceRemote.h>
 #import <WordPressKit/ServiceRemoteWordPressXMLRPC.h>
 
+@class MediaUploadIndex;
+
 @interface MediaServiceRemoteXMLRPC : ServiceRemoteWordPressXMLRPC <MediaServiceRemote>
+
+/**
+ The index that the files of the uploaded media are looked up in before they're uploaded, by the hash of their content.
+ When a media with the same content is in the index, it's returned instead of uploading the file again. The files are
+ always uploaded by default.
+ */
+@property (nonatomic, strong) MediaUploadIndex *uploadIndex;
+
 @end
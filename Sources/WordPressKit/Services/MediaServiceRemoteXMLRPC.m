@@ -47,14 +47,17 @@
                             };
     NSArray *parameters = [self XMLRPCArgumentsWithExtra:filter];
 
+    // The media items are mapped as they are being downloaded, instead of after the whole page is downloaded.
+    NSMutableArray *pageMedia = [NSMutableArray arrayWithCapacity:pageSize];
     [self.api callMethod:@"wp.getMediaLibrary"
               parameters:parameters
-                 success:^(id responseObject, NSHTTPURLResponse *httpResponse) {
-                     NSAssert([responseObject isKindOfClass:[NSArray class]], @"Response should be an array.");
+                 element:^(id xmlrpcMedia) {
+                     [pageMedia addObject:[self remoteMediaFromXMLRPCDictionary:xmlrpcMedia]];
+                 }
+                 success:^(NSHTTPURLResponse *httpResponse) {
                      if (!success) {
                          return;
                      }
-                     NSArray *pageMedia = [self remoteMediaFromXMLRPCArray:responseObject];
                      NSArray *resultMedia = [media arrayByAddingObjectsFromArray:pageMedia];
                      // Did we got all the items we requested or it's finished?
                      if (pageMedia.count < pageSize) {
@@ -62,7 +65,7 @@
                          return;
                      }
                      if(pageLoad) {
-                        pageLoad(pageMedia);
+                        pageLoad([pageMedia copy]);
                      }
                      NSUInteger newOffset = offset + pageSize;
                      [self getMediaLibraryStartOffset:newOffset media:resultMedia pageLoad:pageLoad success: success failure: failure];                     
@@ -156,9 +159,35 @@
         }
         return;
     }
+
+    if (self.uploadIndex == nil) {
+        NSProgress *localProgress = [self uploadFileOfMedia:media success:success failure:failure];
+        if (progress) {
+            *progress = localProgress;
+        }
+        return;
+    }
+
+    NSProgress *localProgress = [self.uploadIndex uploadMedia:media
+                                                      service:self
+                                                       upload:^NSProgress *(void (^hashed)(NSString *), void (^uploaded)(RemoteMedia *), void (^failed)(NSError *)) {
+                                                           // The file isn't sent in a multipart form, so the index hashes it once it's uploaded.
+                                                           return [self uploadFileOfMedia:media success:uploaded failure:failed];
+                                                       }
+                                                      success:success
+                                                      failure:failure];
+    if (progress) {
+        *progress = localProgress;
+    }
+}
+
+- (NSProgress *)uploadFileOfMedia:(RemoteMedia *)media
+                          success:(void (^)(RemoteMedia *remoteMedia))success
+                          failure:(void (^)(NSError *error))failure
+{
     NSMutableDictionary *data = [NSMutableDictionary dictionaryWithDictionary:@{
-                           @"name": filename,
-                           @"type": type,
+                           @"name": media.file,
+                           @"type": media.mimeType,
                            @"bits": [NSInputStream inputStreamWithFileAtPath:media.localURL.path],
                            }];
     if ([media.postID compare:@(0)] == NSOrderedDescending) {
@@ -189,10 +218,7 @@
           }
       }];
 
-    
-    if (progress) {
-        *progress = localProgress;
-    }
+    return localProgress;
 }
 
 - (void)updateMedia:(RemoteMedia *)media
@@ -262,13 +288,6 @@
 
 #pragma mark - Private methods
 
-- (NSArray *)remoteMediaFromXMLRPCArray:(NSArray *)xmlrpcArray
-{
-    return [xmlrpcArray wp_map:^id(NSDictionary *xmlrpcMedia) {
-        return [self remoteMediaFromXMLRPCDictionary:xmlrpcMedia];
-    }];
-}
-
 - (RemoteMedia *)remoteMediaFromXMLRPCDictionary:(NSDictionary*)xmlRPC
 {
     RemoteMedia * remoteMedia = [[RemoteMedia alloc] init];
@@ -0,0 +1,240 @@
+import Foundation
+import CryptoKit
+
+/// An index of the media of a site by the hash of their file's content, so that a file that's already in the site's
+/// library isn't uploaded again.
+///
+/// Deduplication is opt-in: set an index on a media service, e.g. `MediaServiceRemoteREST.uploadIndex`. Before
+/// uploading a file, the service hashes it and returns the indexed media if there is one, instead of uploading the file.
+/// The media that the service uploads are added to the index. The media of previous sessions can be added with
+/// `add(_:forContentHash:)`, using the hashes of `contentHash(ofFileAt:)`.
+///
+/// While the index isn't empty, the file has to be hashed before its upload starts, because its hash is only known
+/// once it's entirely read, and by then an upload would have sent it. So a file that isn't in the index is read once
+/// more than without an index: once to hash it, and once to upload it. While the index is empty, nothing can match, so
+/// the file is uploaded straight away, and hashed by the multipart form that sends it, as it's read. The services that
+/// don't send the file in a multipart form, like `MediaServiceRemoteXMLRPC`, hash it once it's uploaded instead.
+///
+/// An index must only be used with the services of a single site. It's thread-safe, and it keeps copies of the media
+/// that are added to it, and returns copies of them.
+@objc public final class MediaUploadIndex: NSObject {
+
+    /// The size of the chunks that the files are read in while they're hashed.
+    static let chunkSize = 256 * 1024
+
+    /// Whether the indexed media are fetched from the server before they're returned, to make sure they haven't been
+    /// deleted from the library since they were indexed. The media that can't be fetched are removed from the index,
+    /// and their file is uploaded again. Defaults to `false`.
+    @objc public var verifiesMediaWithServer = false
+
+    private let lock = NSLock()
+    private var media = [String: RemoteMedia]()
+
+    /// The number of media in the index.
+    @objc public var count: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return media.count
+    }
+
+    /// Returns a copy of the media whose file has the given content hash, if it's in the index.
+    @objc(mediaForContentHash:)
+    public func media(forContentHash contentHash: String) -> RemoteMedia? {
+        lock.lock()
+        defer { lock.unlock() }
+        return media[contentHash]?.copy() as? RemoteMedia
+    }
+
+    /// Adds a copy of a media to the index, replacing the media that has the same content hash.
+    @objc(addMedia:forContentHash:)
+    public func add(_ remoteMedia: RemoteMedia, forContentHash contentHash: String) {
+        let copy = remoteMedia.copy() as? RemoteMedia
+        lock.lock()
+        defer { lock.unlock() }
+        media[contentHash] = copy
+    }
+
+    /// Removes the media that has the given content hash from the index.
+    @objc(removeMediaForContentHash:)
+    public func removeMedia(forContentHash contentHash: String) {
+        lock.lock()
+        defer { lock.unlock() }
+        media[contentHash] = nil
+    }
+
+    /// Returns the SHA-256 hash of the content of a file, as a lowercase hexadecimal string.
+    ///
+    /// The file is read in chunks of `chunkSize` bytes, so that it's never entirely in memory.
+    @objc(contentHashOfFileAtURL:error:)
+    public static func contentHash(ofFileAt url: URL) throws -> String {
+        guard let stream = InputStream(url: url) else {
+            throw CocoaError(.fileReadNoSuchFile, userInfo: [NSURLErrorKey: url])
+        }
+        stream.open()
+        defer { stream.close() }
+
+        var hasher = SHA256()
+        let buffer = UnsafeMutablePointer<UInt8>.allocate(capacity: chunkSize)
+        defer { buffer.deallocate() }
+        while true {
+            let read = stream.read(buffer, maxLength: chunkSize)
+            if read < 0 {
+                throw stream.streamError ?? CocoaError(.fileReadUnknown, userInfo: [NSURLErrorKey: url])
+            }
+            if read == 0 {
+                break
+            }
+            hasher.update(bufferPointer: UnsafeRawBufferPointer(start: buffer, count: read))
+        }
+        return hasher.finalize().map { String(format: "%02x", $0) }.joined()
+    }
+
+}
+
+// MARK: - Uploads
+
+extension MediaUploadIndex {
+
+    /// Uploads the file of a media, unless a media with the same content is in the index.
+    ///
+    /// The file is hashed on a background queue. If the index has a media with the same content hash, and it's still
+    /// on the server when `verifiesMediaWithServer` is set, it's returned to `success` instead of uploading the file.
+    /// Otherwise, `upload` is called, and the uploaded media is added to the index. A file that can't be hashed is
+    /// uploaded as usual, and so is a file whose upload sets a post or a caption that the indexed media doesn't have,
+    /// because they're only set when the file is uploaded. When the index is empty, `upload` is called straight away.
+    ///
+    /// `upload` is passed a handler for the file's content hash, which it can set as the `FilePart.contentHashHandler`
+    /// of the file, when the hash isn't known yet. The file is hashed once it's uploaded if the handler isn't called.
+    ///
+    /// The callbacks, including `upload` unless the index is empty, are called on the main queue.
+    ///
+    /// - Returns: A progress that completes when the media is found, or that includes the upload's progress.
+    @objc(uploadMedia:service:upload:success:failure:)
+    public func upload(
+        _ remoteMedia: RemoteMedia,
+        service: MediaServiceRemote,
+        upload: @escaping (
+            _ contentHashHandler: ((String) -> Void)?,
+            _ success: @escaping (RemoteMedia) -> Void,
+            _ failure: @escaping (Error) -> Void
+        ) -> Progress?,
+        success: ((RemoteMedia) -> Void)?,
+        failure: ((Error) -> Void)?
+    ) -> Progress {
+        let progress = Progress.discreteProgress(totalUnitCount: 1)
+
+        let uploadFile = { (contentHash: String?) in
+            guard !progress.isCancelled else {
+                failure?(URLError(.cancelled))
+                return
+            }
+
+            // The multipart form that uploads the file hashes it, if its hash isn't known yet.
+            let streamedContentHash = contentHash == nil ? StreamedContentHash() : nil
+            let contentHashHandler: ((String) -> Void)? = streamedContentHash.map { streamed in { streamed.value = $0 } }
+            let uploadProgress = upload(contentHashHandler, { uploaded in
+                self.index(uploaded, contentHash: contentHash ?? streamedContentHash?.value, fileURL: remoteMedia.localURL) {
+                    success?(uploaded)
+                }
+            }, { error in
+                failure?(error)
+            })
+            if let uploadProgress {
+                progress.addChild(uploadProgress, withPendingUnitCount: 1)
+            }
+        }
+
+        let found = { (existing: RemoteMedia) in
+            guard !progress.isCancelled else {
+                failure?(URLError(.cancelled))
+                return
+            }
+            progress.completedUnitCount = progress.totalUnitCount
+            success?(existing)
+        }
+
+        if count == 0 {
+            // No media can have the same content, so the file is uploaded without hashing it first. Its hash is only
+            // needed to add the uploaded media to the index.
+            uploadFile(nil)
+            return progress
+        }
+
+        DispatchQueue.global(qos: .userInitiated).async {
+            let contentHash = remoteMedia.localURL.flatMap { try? Self.contentHash(ofFileAt: $0) }
+            let existing = contentHash
+                .flatMap { self.media(forContentHash: $0) }
+                .flatMap { Self.hasAttributes(of: remoteMedia, existing: $0) ? $0 : nil }
+
+            DispatchQueue.main.async {
+                guard let contentHash, let existing else {
+                    uploadFile(contentHash)
+                    return
+                }
+
+                guard self.verifiesMediaWithServer, let mediaID = existing.mediaID else {
+                    found(existing)
+                    return
+                }
+
+                service.getMediaWithID(mediaID, success: { fetched in
+                    self.add(fetched, forContentHash: contentHash)
+                    found(fetched)
+                }, failure: { _ in
+                    self.removeMedia(forContentHash: contentHash)
+                    uploadFile(contentHash)
+                })
+            }
+        }
+
+        return progress
+    }
+
+    /// Adds an uploaded media to the index, and then calls `completion` on the main queue. The file is hashed on a
+    /// background queue if its hash isn't known.
+    private func index(_ uploaded: RemoteMedia, contentHash: String?, fileURL: URL?, completion: @escaping () -> Void) {
+        if let contentHash {
+            add(uploaded, forContentHash: contentHash)
+            DispatchQueue.main.async(execute: completion)
+            return
+        }
+
+        DispatchQueue.global(qos: .utility).async {
+            if let contentHash = fileURL.flatMap({ try? Self.contentHash(ofFileAt: $0) }) {
+                self.add(uploaded, forContentHash: contentHash)
+            }
+            DispatchQueue.main.async(execute: completion)
+        }
+    }
+
+    /// Whether the indexed media has the post and the caption that uploading the file of the given media would set.
+    private static func hasAttributes(of remoteMedia: RemoteMedia, existing: RemoteMedia) -> Bool {
+        if let postID = remoteMedia.postID, postID.intValue > 0, postID != existing.postID {
+            return false
+        }
+        if let caption = remoteMedia.caption, caption != existing.caption {
+            return false
+        }
+        return true
+    }
+
+}
+
+/// The content hash of a file that's computed by the multipart form that uploads it, on the thread that reads the form.
+private final class StreamedContentHash {
+    private let lock = NSLock()
+    private var _value: String?
+
+    var value: String? {
+        get {
+            lock.lock()
+            defer { lock.unlock() }
+            return _value
+        }
+        set {
+            lock.lock()
+            defer { lock.unlock() }
+            _value = newValue
+        }
+    }
+}
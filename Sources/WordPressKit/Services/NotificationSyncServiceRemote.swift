@@ -17,6 +17,12 @@ public class NotificationSyncServiceRemote: ServiceRemoteWordPressComREST {
         case notificationIDsNotProvided
     }
 
+    /// The pool that the values that are repeated across notifications are interned in while the responses are
+    /// mapped. Set it for the duration of a sync session to share the strings across responses. The values aren't
+    /// interned by default.
+    ///
+    public var stringPool: StringInterningPool?
+
     /// Retrieves latest Notifications (OR collection of Notifications, whenever noteIds is present)
     ///
     /// - Parameters:
@@ -169,7 +175,7 @@ private extension NotificationSyncServiceRemote {
         wordPressComRESTAPI.get(requestUrl, parameters: parameters, success: { response, _  in
             let document = response as? [String: AnyObject]
             let notes = document?["notes"] as? [[String: AnyObject]]
-            let parsed = notes?.compactMap { RemoteNotification(document: $0) }
+            let parsed = notes?.compactMap { RemoteNotification(document: $0, stringPool: self.stringPool) }
 
             if let parsed = parsed {
                 completion(nil, parsed)
@@ -0,0 +1,31 @@
+import Foundation
+
+extension PostServiceRemoteREST {
+
+    /// Fetches the posts of the given type.
+    ///
+    /// See `getPostsOfType(_:options:success:failure:)`.
+    public func getPosts(ofType postType: String, options: [String: AnyObject]? = nil) async throws -> [RemotePost] {
+        var parameters: [String: AnyObject] = [
+            "status": "any,trash" as NSString,
+            "context": "edit" as NSString,
+            "number": 40 as NSNumber,
+            "type": postType as NSString,
+        ]
+        parameters.merge(options ?? [:]) { _, option in option }
+
+        // The posts are decoded straight from the response data, which is measured as the decode phase of the request.
+        return try await wordPressComRestApi.perform(
+            .get,
+            path: Endpoint.posts.path(siteID),
+            parameters: parameters,
+            jsonDecoder: JSONDecoder(),
+            type: RemotePostsEnvelope.self
+        ).get().body.posts
+    }
+
+}
+
+private enum Endpoint {
+    static let posts = WordPressComEndpoint<OnePathParameter>("sites/:site/posts", version: ._1_2)
+}
@@ -2,8 +2,7 @@ import Foundation
 
 extension PostServiceRemoteREST: PostServiceRemoteExtended {
     public func post(withID postID: Int) async throws -> RemotePost {
-        let path = self.path(forEndpoint: "sites/\(siteID)/posts/\(postID)?context=edit", withVersion: ._1_1)
-        let result = await wordPressComRestApi.perform(.get, URLString: path)
+        let result = await wordPressComRestApi.perform(.get, path: Endpoint.post.path(siteID, postID))
         switch result {
         case .success(let response):
             return try await decodePost(from: response.body)
@@ -16,18 +15,16 @@ extension PostServiceRemoteREST: PostServiceRemoteExtended {
     }
 
     public func createPost(with parameters: RemotePostCreateParameters) async throws -> RemotePost {
-        let path = self.path(forEndpoint: "sites/\(siteID)/posts/new?context=edit", withVersion: ._1_2)
-        let parameters = try makeParameters(from: RemotePostCreateParametersWordPressComEncoder(parameters: parameters))
+        let body = RemotePostCreateParametersWordPressComEncoder(parameters: parameters)
 
-        let response = try await wordPressComRestApi.perform(.post, URLString: path, parameters: parameters).get()
+        let response = try await wordPressComRestApi.perform(.post, path: Endpoint.newPost.path(siteID), body: body, jsonEncoder: makeEncoder()).get()
         return try await decodePost(from: response.body)
     }
 
     public func patchPost(withID postID: Int, parameters: RemotePostUpdateParameters) async throws -> RemotePost {
-        let path = self.path(forEndpoint: "sites/\(siteID)/posts/\(postID)?context=edit", withVersion: ._1_2)
-        let parameters = try makeParameters(from: RemotePostUpdateParametersWordPressComEncoder(parameters: parameters))
+        let body = RemotePostUpdateParametersWordPressComEncoder(parameters: parameters)
 
-        let result = await wordPressComRestApi.perform(.post, URLString: path, parameters: parameters)
+        let result = await wordPressComRestApi.perform(.post, path: Endpoint.updatePost.path(siteID, postID), body: body, jsonEncoder: makeEncoder())
         switch result {
         case .success(let response):
             return try await decodePost(from: response.body)
@@ -44,8 +41,7 @@ extension PostServiceRemoteREST: PostServiceRemoteExtended {
     }
 
     public func deletePost(withID postID: Int) async throws {
-        let path = self.path(forEndpoint: "sites/\(siteID)/posts/\(postID)/delete", withVersion: ._1_1)
-        let result = await wordPressComRestApi.perform(.post, URLString: path)
+        let result = await wordPressComRestApi.perform(.post, path: Endpoint.deletePost.path(siteID, postID))
         switch result {
         case .success:
             return
@@ -61,9 +57,8 @@ extension PostServiceRemoteREST: PostServiceRemoteExtended {
     }
 
     public func createAutosave(forPostID postID: Int, parameters: RemotePostCreateParameters) async throws -> RemotePostAutosaveResponse {
-        let path = self.path(forEndpoint: "sites/\(siteID)/posts/\(postID)/autosave", withVersion: ._1_1)
-        let parameters = try makeParameters(from: RemotePostCreateParametersWordPressComEncoder(parameters: parameters))
-        let result = await wordPressComRestApi.perform(.post, URLString: path, parameters: parameters, type: RemotePostAutosaveResponse.self)
+        let body = RemotePostCreateParametersWordPressComEncoder(parameters: parameters)
+        let result = await wordPressComRestApi.perform(.post, path: Endpoint.autosave.path(siteID, postID), body: body, jsonEncoder: makeEncoder(), type: RemotePostAutosaveResponse.self)
         return try result.get().body
     }
 }
@@ -86,13 +81,16 @@ private func decodePost(from object: AnyObject) async throws -> RemotePost {
     return PostServiceRemoteREST.remotePost(fromJSONDictionary: dictionary)
 }
 
-private func makeParameters<T: Encodable>(from value: T) throws -> [String: AnyObject] {
+private func makeEncoder() -> JSONEncoder {
     let encoder = JSONEncoder()
     encoder.dateEncodingStrategy = .formatted(.wordPressCom)
-    let data = try encoder.encode(value)
-    let object = try JSONSerialization.jsonObject(with: data)
-    guard let dictionary = object as? [String: AnyObject] else {
-        throw URLError(.unknown) // This should never happen
-    }
-    return dictionary
+    return encoder
+}
+
+private enum Endpoint {
+    static let post = WordPressComEndpoint<TwoPathParameters>("sites/:site/posts/:post?context=edit", version: ._1_1)
+    static let newPost = WordPressComEndpoint<OnePathParameter>("sites/:site/posts/new?context=edit", version: ._1_2)
+    static let updatePost = WordPressComEndpoint<TwoPathParameters>("sites/:site/posts/:post?context=edit", version: ._1_2)
+    static let deletePost = WordPressComEndpoint<TwoPathParameters>("sites/:site/posts/:post/delete", version: ._1_1)
+    static let autosave = WordPressComEndpoint<TwoPathParameters>("sites/:site/posts/:post/autosave", version: ._1_1)
 }
@@ -87,7 +87,10 @@ static NSString * const RemoteOptionValueOrderByPostID = @"ID";
        parameters:parameters
           success:^(id responseObject, NSHTTPURLResponse *httpResponse) {
               if (success) {
-                  success([self remotePostsFromJSONArray:responseObject[@"posts"]]);
+                  NSArray *jsonPosts = responseObject[@"posts"];
+                  success([RequestPhaseTimer measureMappingForEndpoint:requestUrl count:jsonPosts.count block:^id{
+                      return [self remotePostsFromJSONArray:jsonPosts];
+                  }]);
               }
           } failure:^(NSError *error, NSHTTPURLResponse *httpResponse) {
               if (failure) {
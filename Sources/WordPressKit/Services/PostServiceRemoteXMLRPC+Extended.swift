@@ -67,12 +67,8 @@ private func decodePost(from object: AnyObject) async throws -> RemotePost {
     return PostServiceRemoteXMLRPC.remotePost(fromXMLRPCDictionary: dictionary)
 }
 
-private func makeParameters<T: Encodable>(from value: T) throws -> [String: AnyObject] {
-    let encoder = PropertyListEncoder()
-    encoder.outputFormat = .xml
-    let data = try encoder.encode(value)
-    let object = try PropertyListSerialization.propertyList(from: data, format: nil)
-    guard let dictionary = object as? [String: AnyObject] else {
+private func makeParameters<T: Encodable>(from value: T) throws -> NSDictionary {
+    guard let dictionary = try XMLRPCValueEncoder().encode(value) as? NSDictionary else {
         throw URLError(.unknown) // This should never happen
     }
     return dictionary
@@ -2,8 +2,28 @@
 #import <WordPressKit/PostServiceRemote.h>
 #import <WordPressKit/ServiceRemoteWordPressXMLRPC.h>
 
+@class WordPressOrgXMLRPCApiMethodCall;
+
 @interface PostServiceRemoteXMLRPC : ServiceRemoteWordPressXMLRPC <PostServiceRemote>
 
 + (RemotePost *)remotePostFromXMLRPCDictionary:(NSDictionary *)xmlrpcDictionary;
 
+#pragma mark - Multicall
+
+/**
+ *  @brief      Creates a method call that fetches the posts of the specified type.
+ *
+ *  @note       The call can be sent along with other calls in one round trip, using
+ *              `-[WordPressOrgXMLRPCApi callMethods:]`.
+ *
+ *  @param      postType    The type of the posts to fetch.
+ *  @param      options     The options of the request, like in `getPostsOfType:options:success:failure:`.  Can be nil.
+ *  @param      success     The block that will be executed on success.  Can be nil.
+ *  @param      failure     The block that will be executed on failure.  Can be nil.
+ */
+- (WordPressOrgXMLRPCApiMethodCall *)methodCallToGetPostsOfType:(NSString *)postType
+                                                        options:(NSDictionary *)options
+                                                        success:(void (^)(NSArray <RemotePost *> *remotePosts))success
+                                                        failure:(void (^)(NSError *error))failure;
+
 @end
@@ -54,6 +54,14 @@ static NSString * const RemoteOptionValueOrderByPostID = @"ID";
                options:(NSDictionary *)options
                success:(void (^)(NSArray <RemotePost *> *remotePosts))success
                failure:(void (^)(NSError *error))failure {
+    [self callMethod:[self methodCallToGetPostsOfType:postType options:options success:success failure:failure]];
+}
+
+- (WordPressOrgXMLRPCApiMethodCall *)methodCallToGetPostsOfType:(NSString *)postType
+                                                        options:(NSDictionary *)options
+                                                        success:(void (^)(NSArray <RemotePost *> *remotePosts))success
+                                                        failure:(void (^)(NSError *error))failure
+{
     NSArray *statuses = @[PostStatusDraft, PostStatusPending, PostStatusPrivate, PostStatusPublish, PostStatusScheduled, PostStatusTrash];
     NSString *postStatus = [statuses componentsJoinedByString:@","];
     NSDictionary *extraParameters = @{
@@ -67,18 +75,18 @@ static NSString * const RemoteOptionValueOrderByPostID = @"ID";
         extraParameters = [NSDictionary dictionaryWithDictionary:mutableParameters];
     }
     NSArray *parameters = [self XMLRPCArgumentsWithExtra:extraParameters];
-    [self.api callMethod:@"wp.getPosts"
-              parameters:parameters
-                 success:^(id responseObject, NSHTTPURLResponse *httpResponse) {
-                     NSAssert([responseObject isKindOfClass:[NSArray class]], @"Response should be an array.");
-                     if (success) {
-                         success([self remotePostsFromXMLRPCArray:responseObject]);
-                     }
-                 } failure:^(NSError *error, NSHTTPURLResponse *httpResponse) {
-                     if (failure) {
-                         failure(error);
-                     }
-                 }];
+    return [[WordPressOrgXMLRPCApiMethodCall alloc] initWithMethod:@"wp.getPosts"
+                                                        parameters:parameters
+                                                           success:^(id responseObject, NSHTTPURLResponse *httpResponse) {
+                                                               NSAssert([responseObject isKindOfClass:[NSArray class]], @"Response should be an array.");
+                                                               if (success) {
+                                                                   success([self remotePostsFromXMLRPCArray:responseObject]);
+                                                               }
+                                                           } failure:^(NSError *error, NSHTTPURLResponse *httpResponse) {
+                                                               if (failure) {
+                                                                   failure(error);
+                                                               }
+                                                           }];
 }
 
 - (void)createPost:(RemotePost *)post
@@ -0,0 +1,87 @@
+import Foundation
+import WordPressShared
+
+// Like the other async service functions, e.g. `PostServiceRemoteREST.getPosts(ofType:options:)`, these functions are
+// nonisolated: the responses are decoded and mapped on the cooperative thread pool, instead of the main thread, and the
+// functions return on the caller's executor.
+extension ReaderPostServiceRemote {
+
+    /// Fetches the posts published before the given date from the given endpoint.
+    ///
+    /// See `fetchPosts(fromEndpoint:algorithm:count:before:success:failure:)`.
+    public func fetchPosts(
+        fromEndpoint endpoint: URL,
+        algorithm: String?,
+        count: Int,
+        before date: Date
+    ) async throws -> (posts: [RemoteReaderPost], algorithm: String?) {
+        var parameters: [String: AnyObject] = [
+            "number": count as NSNumber,
+            "before": DateUtils.isoString(from: date) as NSString,
+            "order": "DESC" as NSString,
+            "meta": "site,feed" as NSString,
+        ]
+        parameters["algorithm"] = algorithm as NSString?
+
+        return try await fetchPosts(fromEndpoint: endpoint, parameters: parameters, rankingFromOffset: nil)
+    }
+
+    /// Fetches the posts at the given offset from the given endpoint.
+    ///
+    /// See `fetchPosts(fromEndpoint:algorithm:count:offset:success:failure:)`.
+    public func fetchPosts(
+        fromEndpoint endpoint: URL,
+        algorithm: String?,
+        count: Int,
+        offset: Int
+    ) async throws -> (posts: [RemoteReaderPost], algorithm: String?) {
+        var parameters: [String: AnyObject] = [
+            "number": count as NSNumber,
+            "offset": offset as NSNumber,
+            "order": "DESC" as NSString,
+            "meta": "site,feed" as NSString,
+        ]
+        parameters["algorithm"] = algorithm as NSString?
+
+        return try await fetchPosts(fromEndpoint: endpoint, parameters: parameters, rankingFromOffset: offset)
+    }
+
+    /// Fetches a post from a site or a feed.
+    ///
+    /// See `fetchPost(_:fromSite:isFeed:success:failure:)`.
+    public func fetchPost(_ postID: Int, fromSite siteID: Int, isFeed: Bool) async throws -> RemoteReaderPost {
+        let endpoint = isFeed ? Endpoint.feedPost : Endpoint.sitePost
+        return try await wordPressComRestApi.perform(
+            .get,
+            path: endpoint.path(siteID, postID),
+            jsonDecoder: JSONDecoder(stringPool: stringPool),
+            type: RemoteReaderPostPayload.self
+        ).get().body.post
+    }
+
+    /// - Parameter offset: The offset of the first post, which the posts' `sortRank` is derived from. Pass `nil` to
+    ///     leave the `sortRank` that's derived from the posts' dates.
+    private func fetchPosts(
+        fromEndpoint endpoint: URL,
+        parameters: [String: AnyObject],
+        rankingFromOffset offset: Int?
+    ) async throws -> (posts: [RemoteReaderPost], algorithm: String?) {
+        // The posts are decoded straight from the response data, which is measured as the decode phase of the request.
+        let body = try await wordPressComRestApi.perform(
+            .get,
+            URLString: endpoint.absoluteString,
+            parameters: parameters,
+            jsonDecoder: JSONDecoder(stringPool: stringPool),
+            type: RemoteReaderPostsEnvelope.self
+        ).get().body
+        RemoteReaderPost.rank(body.posts, fromOffset: offset.map { Double($0) })
+
+        return (body.posts, body.algorithm)
+    }
+
+}
+
+private enum Endpoint {
+    static let sitePost = WordPressComEndpoint<TwoPathParameters>("read/sites/:site/posts/:post/?meta=site", version: ._1_2)
+    static let feedPost = WordPressComEndpoint<TwoPathParameters>("read/feed/:feed/posts/:post/?meta=site", version: ._1_2)
+}
@@ -74,11 +74,14 @@ extension ReaderPostServiceRemote {
     private func fetch(_ endpoint: String,
                        success: @escaping ([RemoteReaderCard], String?) -> Void,
                        failure: @escaping (Error) -> Void) {
-        Task { @MainActor [wordPressComRestApi] in
-            await wordPressComRestApi.perform(.get, URLString: endpoint, type: ReaderCardEnvelope.self)
+        // The cards are decoded off the main thread, and only the callbacks are called on the main thread.
+        Task { [wordPressComRestApi] in
+            let result = await wordPressComRestApi.perform(.get, URLString: endpoint, type: ReaderCardEnvelope.self)
                 .map { ($0.body.cards, $0.body.nextPageHandle) }
                 .mapError { error -> Error in error.asNSError() }
-                .execute(onSuccess: success, onFailure: failure)
+            await MainActor.run {
+                result.execute(onSuccess: success, onFailure: failure)
+            }
         }
     }
 
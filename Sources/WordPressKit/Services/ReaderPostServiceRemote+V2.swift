@@ -20,8 +20,8 @@ extension ReaderPostServiceRemote {
                                 success: { response, _ in
                                     let responseDict = response as? [String: Any]
                                     let nextPageHandle = responseDict?["next_page_handle"] as? String
-                                    let postsDictionary = responseDict?["posts"] as? [[String: Any]]
-                                    let posts = postsDictionary?.compactMap { RemoteReaderPost(dictionary: $0) } ?? []
+                                    let postsDictionary = responseDict?["posts"] as? [[AnyHashable: Any]]
+                                    let posts = postsDictionary.map { RemoteReaderPost.posts(fromJSONArray: $0, rankingFromOffset: nil, stringPool: self.stringPool) } ?? []
                                     success(posts, nextPageHandle)
         }, failure: { error, _ in
             WPKitLogError("Error fetching reader posts: \(error)")
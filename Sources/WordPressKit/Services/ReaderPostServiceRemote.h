@@ -2,9 +2,21 @@
 #import <WordPressKit/ServiceRemoteWordPressComREST.h>
 
 @class RemoteReaderPost;
+@class StringInterningPool;
 
 @interface ReaderPostServiceRemote : ServiceRemoteWordPressComREST
 
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The pool that the values that are repeated across posts, like the sites' names and URLs, are interned in while the
+ responses are mapped. Set it for the duration of a sync session to share the strings across responses. The values
+ aren't interned by default.
+ */
+@property (nonatomic, strong, nullable) StringInterningPool *stringPool;
+
+NS_ASSUME_NONNULL_END
+
 /**
  Fetches the posts from the specified remote endpoint
 
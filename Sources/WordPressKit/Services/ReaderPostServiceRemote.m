@@ -109,7 +109,9 @@ NSString * const ParamKeyMetaValue = @"site,feed";
     NSString *path = [self apiPathForPostAtURL:postURL];
 
     if (!path) {
-        failure(nil);
+        if (failure) {
+            failure(nil);
+        }
         return;
     }
 
@@ -216,16 +218,11 @@ NSString * const ParamKeyMetaValue = @"site,feed";
                       // from the offset + order of the results, ONLY if a `before` param
                       // was not specified.  If a `before` param exists we favor sorting by date.
                       BOOL rankByOffset = [params objectForKey:ParamKeyOffset] != nil && [params objectForKey:ParamKeyBefore] == nil;
-                      __block CGFloat offset = [[params numberForKey:ParamKeyOffset] floatValue];
+                      NSNumber *offset = rankByOffset ? ([params numberForKey:ParamKeyOffset] ?: @0) : nil;
                       NSString *algorithm = [responseObject stringForKey:ParamsKeyAlgorithm];
                       NSArray *jsonPosts = [responseObject arrayForKey:PostRESTKeyPosts];
-                      NSArray *posts = [jsonPosts wp_map:^id(NSDictionary *jsonPost) {
-                          if (rankByOffset) {
-                              RemoteReaderPost *post = [self formatPostDictionary:jsonPost offset:offset];
-                              offset++;
-                              return post;
-                          }
-                          return [[RemoteReaderPost alloc] initWithDictionary:jsonPost];
+                      NSArray *posts = [RequestPhaseTimer measureMappingForEndpoint:path count:jsonPosts.count block:^id{
+                          return [RemoteReaderPost postsFromJSONArray:jsonPosts rankingFromOffset:offset stringPool:self.stringPool];
                       }];
 
                       // Now call success on the main thread.
@@ -241,16 +238,6 @@ NSString * const ParamKeyMetaValue = @"site,feed";
               }];
 }
 
-- (RemoteReaderPost *)formatPostDictionary:(NSDictionary *)dict offset:(CGFloat)offset
-{
-    RemoteReaderPost *post = [[RemoteReaderPost alloc] initWithDictionary:dict];
-    // It's assumed that sortRank values are in descending order. Since
-    // offsets are ascending, we store its negative to ensure we get a proper sort order.
-    CGFloat adjustedOffset = -offset;
-    post.sortRank = @(adjustedOffset);
-    return post;
-}
-
 - (nullable NSString *)apiPathForPostAtURL:(NSURL *)url
 {
     NSURLComponents *components = [NSURLComponents componentsWithURL:url resolvingAgainstBaseURL:NO];
@@ -1,6 +1,7 @@
 #import <Foundation/Foundation.h>
 
 @class WordPressOrgXMLRPCApi;
+@class WordPressOrgXMLRPCApiMethodCall;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -14,6 +15,9 @@ NS_ASSUME_NONNULL_BEGIN
 - (NSArray *)XMLRPCArgumentsWithExtra:(_Nullable id)extra;
 - (NSArray *)XMLRPCArgumentsWithExtraDefaults:(NSArray *)extraDefaults andExtra:(_Nullable id)extra;
 
+/// Sends a method call on its own. Use `-[WordPressOrgXMLRPCApi callMethods:]` to send several calls in one round trip.
+- (void)callMethod:(WordPressOrgXMLRPCApiMethodCall *)methodCall;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -1,4 +1,5 @@
 #import "ServiceRemoteWordPressXMLRPC.h"
+#import "WPKit-Swift.h"
 
 @interface ServiceRemoteWordPressXMLRPC()
 
@@ -66,4 +67,12 @@
     return [NSArray arrayWithArray:result];
 }
 
+- (void)callMethod:(WordPressOrgXMLRPCApiMethodCall *)methodCall
+{
+    [self.api callMethod:methodCall.method
+              parameters:methodCall.parameters
+                 success:methodCall.success
+                 failure:methodCall.failure];
+}
+
 @end
@@ -43,12 +43,26 @@ open class StatsServiceRemoteV2: ServiceRemoteWordPressComREST {
     ///   - limit: Limit of how many objects you want returned for your query. Default is `10`. `0` means no limit.
     public func getInsight<InsightType: StatsInsightData>(limit: Int = 10,
                                                           completion: @escaping ((InsightType?, Error?) -> Void)) {
+        let request = batchRequestForInsight(limit: limit, completion: completion)
+        wordPressComRESTAPI.get(
+            request.path,
+            parameters: request.parameters,
+            success: { request.success($0 as AnyObject, $1) },
+            failure: { request.failure($0 as NSError, $1) }
+        )
+    }
+
+    /// Creates a request that fetches the same Insight data as `getInsight(limit:completion:)` does.
+    ///
+    /// The request can be sent along with other requests in one round trip, using `WordPressComRestApi.GET(batch:)`.
+    public func batchRequestForInsight<InsightType: StatsInsightData>(limit: Int = 10,
+                                                                      completion: @escaping ((InsightType?, Error?) -> Void)) -> WordPressComRestApiBatchRequest {
         let properties = InsightType.queryProperties(with: limit) as [String: AnyObject]
         let pathComponent = InsightType.pathComponent
 
         let path = self.path(forEndpoint: "sites/\(siteID)/\(pathComponent)/", withVersion: ._1_1)
 
-        wordPressComRESTAPI.get(path, parameters: properties, success: { (response, _) in
+        return WordPressComRestApiBatchRequest(path: path, parameters: properties, success: { (response, _) in
             guard
                 let jsonResponse = response as? [String: AnyObject],
                 let insight = InsightType(jsonDictionary: jsonResponse)
@@ -3,7 +3,34 @@
 #import <WordPressKit/ServiceRemoteWordPressXMLRPC.h>
 
 @class RemoteCategory;
+@class WordPressOrgXMLRPCApiMethodCall;
 
 @interface TaxonomyServiceRemoteXMLRPC : ServiceRemoteWordPressXMLRPC<TaxonomyServiceRemote>
 
+#pragma mark - Multicall
+
+/**
+ *  @brief      Creates a method call that fetches a list of categories.
+ *
+ *  @note       The call can be sent along with other calls in one round trip, using
+ *              `-[WordPressOrgXMLRPCApi callMethods:]`.
+ *
+ *  @param      success     The block that will be executed on success.
+ *  @param      failure     The block that will be executed on failure.  Can be nil.
+ */
+- (WordPressOrgXMLRPCApiMethodCall *)methodCallToGetCategoriesWithSuccess:(void (^)(NSArray <RemotePostCategory *> *categories))success
+                                                                  failure:(void (^)(NSError *error))failure;
+
+/**
+ *  @brief      Creates a method call that fetches a list of tags.
+ *
+ *  @note       The call can be sent along with other calls in one round trip, using
+ *              `-[WordPressOrgXMLRPCApi callMethods:]`.
+ *
+ *  @param      success     The block that will be executed on success.
+ *  @param      failure     The block that will be executed on failure.  Can be nil.
+ */
+- (WordPressOrgXMLRPCApiMethodCall *)methodCallToGetTagsWithSuccess:(void (^)(NSArray <RemotePostTag *> *tags))success
+                                                            failure:(void (^)(NSError *error))failure;
+
 @end
@@ -51,11 +51,7 @@ static NSString * const TaxonomyXMLRPCOffsetParameter = @"offset";
 - (void)getCategoriesWithSuccess:(void (^)(NSArray <RemotePostCategory *> *))success
                          failure:(nullable void (^)(NSError *))failure
 {
-    [self getTaxonomiesWithType:TaxonomyXMLRPCCategoryIdentifier
-                     parameters:nil
-                        success:^(NSArray *responseArray) {
-                            success([self remoteCategoriesFromXMLRPCArray:responseArray]);
-                        } failure:failure];
+    [self callMethod:[self methodCallToGetCategoriesWithSuccess:success failure:failure]];
 }
 
 - (void)getCategoriesWithPaging:(RemoteTaxonomyPaging *)paging
@@ -139,11 +135,7 @@ static NSString * const TaxonomyXMLRPCOffsetParameter = @"offset";
 - (void)getTagsWithSuccess:(void (^)(NSArray<RemotePostTag *> *))success
                    failure:(nullable void (^)(NSError *))failure
 {
-    [self getTaxonomiesWithType:TaxonomyXMLRPCTagIdentifier
-                     parameters:nil
-                        success:^(NSArray *responseArray) {
-                            success([self remoteTagsFromXMLRPCArray:responseArray]);
-                        } failure:failure];
+    [self callMethod:[self methodCallToGetTagsWithSuccess:success failure:failure]];
 }
 
 - (void)getTagsWithPaging:(RemoteTaxonomyPaging *)paging
@@ -204,6 +196,17 @@ static NSString * const TaxonomyXMLRPCOffsetParameter = @"offset";
                    parameters:(nullable NSDictionary *)parameters
                       success:(void (^)(NSArray *responseArray))success
                       failure:(nullable void (^)(NSError *error))failure
+{
+    [self callMethod:[self methodCallToGetTaxonomiesWithType:typeIdentifier
+                                                  parameters:parameters
+                                                     success:success
+                                                     failure:failure]];
+}
+
+- (WordPressOrgXMLRPCApiMethodCall *)methodCallToGetTaxonomiesWithType:(NSString *)typeIdentifier
+                                                            parameters:(nullable NSDictionary *)parameters
+                                                               success:(void (^)(NSArray *responseArray))success
+                                                               failure:(nullable void (^)(NSError *error))failure
 {
     NSArray *xmlrpcParameters = nil;
     if (parameters.count) {
@@ -211,20 +214,20 @@ static NSString * const TaxonomyXMLRPCOffsetParameter = @"offset";
     }else {
         xmlrpcParameters = [self XMLRPCArgumentsWithExtra:typeIdentifier];
     }
-    [self.api callMethod:@"wp.getTerms"
-              parameters:xmlrpcParameters
-                 success:^(id responseObject, NSHTTPURLResponse *httpResponse) {
-                     if (![responseObject isKindOfClass:[NSArray class]]) {
-                         NSString *message = [NSString stringWithFormat:@"Invalid response requesting taxonomy of type: %@", typeIdentifier];
-                         [self handleResponseErrorWithMessage:message method:@"wp.getTerms" failure:failure];
-                         return;
-                     }
-                     success(responseObject);
-                 } failure:^(NSError *error, NSHTTPURLResponse *httpResponse) {
-                     if (failure) {
-                         failure(error);
-                     }
-                 }];
+    return [[WordPressOrgXMLRPCApiMethodCall alloc] initWithMethod:@"wp.getTerms"
+                                                        parameters:xmlrpcParameters
+                                                           success:^(id responseObject, NSHTTPURLResponse *httpResponse) {
+                                                               if (![responseObject isKindOfClass:[NSArray class]]) {
+                                                                   NSString *message = [NSString stringWithFormat:@"Invalid response requesting taxonomy of type: %@", typeIdentifier];
+                                                                   [self handleResponseErrorWithMessage:message method:@"wp.getTerms" failure:failure];
+                                                                   return;
+                                                               }
+                                                               success(responseObject);
+                                                           } failure:^(NSError *error, NSHTTPURLResponse *httpResponse) {
+                                                               if (failure) {
+                                                                   failure(error);
+                                                               }
+                                                           }];
 }
 
 - (void)deleteTaxonomyWithType:(NSString *)typeIdentifier
@@ -282,6 +285,28 @@ static NSString * const TaxonomyXMLRPCOffsetParameter = @"offset";
                  }];
 }
 
+#pragma mark - Multicall
+
+- (WordPressOrgXMLRPCApiMethodCall *)methodCallToGetCategoriesWithSuccess:(void (^)(NSArray <RemotePostCategory *> *categories))success
+                                                                  failure:(nullable void (^)(NSError *error))failure
+{
+    return [self methodCallToGetTaxonomiesWithType:TaxonomyXMLRPCCategoryIdentifier
+                                        parameters:nil
+                                           success:^(NSArray *responseArray) {
+                                               success([self remoteCategoriesFromXMLRPCArray:responseArray]);
+                                           } failure:failure];
+}
+
+- (WordPressOrgXMLRPCApiMethodCall *)methodCallToGetTagsWithSuccess:(void (^)(NSArray <RemotePostTag *> *tags))success
+                                                            failure:(nullable void (^)(NSError *error))failure
+{
+    return [self methodCallToGetTaxonomiesWithType:TaxonomyXMLRPCTagIdentifier
+                                        parameters:nil
+                                           success:^(NSArray *responseArray) {
+                                               success([self remoteTagsFromXMLRPCArray:responseArray]);
+                                           } failure:failure];
+}
+
 #pragma mark - helpers
 
 - (NSArray <RemotePostCategory *> *)remoteCategoriesFromXMLRPCArray:(NSArray *)xmlrpcArray
@@ -3,16 +3,10 @@ import Foundation
 public class ChecksumUtil {
 
     /// Generates a checksum based on the encoded keys.
+    ///
+    /// The checksum is a SHA-256 hash of the content of the value, which is computed in a single pass by
+    /// `ContentHashEncoder`, without encoding the value to JSON. It doesn't depend on the order of the keys.
     static func checksum<T>(from codable: T) -> String where T: Encodable {
-        let encoder = JSONEncoder()
-        encoder.outputFormatting = .sortedKeys
-        let result: String
-        do {
-            let data = try encoder.encode(codable)
-            result = String(data: data, encoding: .utf8) ?? ""
-        } catch {
-            result = ""
-        }
-        return result.md5()
+        (try? ContentHashEncoder().hexDigest(of: codable)) ?? ""
     }
 }
@@ -0,0 +1,435 @@
+import Foundation
+import CryptoKit
+
+/// An `Encoder` that computes a SHA-256 hash of the content of an `Encodable` value, without encoding it to JSON first.
+///
+/// The values are fed into a single hasher as they're encoded: a string is hashed from its UTF-8 bytes in place, and
+/// the elements of an unkeyed container are hashed in their order. Only the fields of a keyed container are buffered,
+/// so that they're hashed in the order of their keys once the container is complete, and the hash doesn't depend on
+/// the order in which they're encoded.
+///
+/// Like JSON, the hash doesn't tell apart the integer types: `1 as Int8` and `1 as UInt` have the same hash. The fields
+/// that are `nil` and omitted by `encodeIfPresent`, which is what the synthesized conformances do, aren't hashed.
+///
+/// Like other streaming encoders, a container is complete once a value that follows it in its parent is encoded, and
+/// must not be used anymore.
+struct ContentHashEncoder {
+
+    /// Returns the hash of the given value.
+    func digest<T: Encodable>(of value: T) throws -> SHA256.Digest {
+        let writer = HashWriter(buffered: false)
+        try writer.encode(value, level: 0, codingPath: [])
+        return writer.finalize()
+    }
+
+    /// Returns the hash of the given value, as a lowercase hexadecimal string.
+    func hexDigest<T: Encodable>(of value: T) throws -> String {
+        try digest(of: value).map { String(format: "%02x", $0) }.joined()
+    }
+
+}
+
+// MARK: - Hash stream
+
+/// The elements of an unkeyed container that's being encoded.
+private final class UnkeyedFrame {
+    var count = 0
+}
+
+/// The fields of a keyed container that's being encoded, which are hashed once the container is complete.
+private final class KeyedFrame {
+    private(set) var fields = [String: HashWriter]()
+
+    /// Returns a new writer for the value of the given key.
+    func field(forKey key: String) -> HashWriter {
+        // Encoding a key twice replaces its value, like `JSONEncoder` does.
+        let writer = HashWriter(buffered: true)
+        fields[key] = writer
+        return writer
+    }
+}
+
+/// Writes the values that are encoded, each one prefixed with a tag of its type, into a hasher or, for the fields of a
+/// keyed container, into a buffer.
+///
+/// The containers that are open are kept on a stack: a value that's encoded at a given level completes the containers
+/// that are above it, which are then written out.
+private final class HashWriter {
+
+    private enum Frame {
+        case keyed(KeyedFrame)
+        case unkeyed(UnkeyedFrame)
+    }
+
+    private enum Tag: UInt8 {
+        case null = 0x00
+        case falseValue = 0x01
+        case trueValue = 0x02
+        case signedInteger = 0x03
+        case unsignedInteger = 0x04
+        case double = 0x05
+        case string = 0x06
+        case data = 0x07
+        case keyed = 0x08
+        case unkeyed = 0x09
+        case end = 0x0a
+    }
+
+    private let buffered: Bool
+    private var hasher = SHA256()
+    private var bytes = [UInt8]()
+    private var frames = [Frame]()
+    private var isEmpty = true
+
+    init(buffered: Bool) {
+        self.buffered = buffered
+    }
+
+    /// Completes the open containers and returns the hash of what's written. Only for a writer that isn't buffered.
+    func finalize() -> SHA256.Digest {
+        complete()
+        return hasher.finalize()
+    }
+
+    /// Completes the open containers and returns what's written. Only for a buffered writer.
+    private func finish() -> [UInt8] {
+        complete()
+        return bytes
+    }
+
+    private func complete() {
+        close(downTo: 0)
+        if isEmpty {
+            // Like `JSONEncoder`, a value that doesn't encode anything is an empty keyed container.
+            write(.keyed)
+            write(UInt64(0))
+        }
+    }
+
+    // MARK: Containers
+
+    /// Completes the containers at and above the given level, before a new value is encoded there.
+    func beginValue(at level: Int) {
+        close(downTo: level)
+    }
+
+    /// Returns the keyed container of the value at the given level, which is either the one that's already open there
+    /// or a new one.
+    func keyedFrame(at level: Int) -> KeyedFrame {
+        if frames.count > level, case let .keyed(frame) = frames[level] {
+            return frame
+        }
+        close(downTo: level)
+        let frame = KeyedFrame()
+        frames.append(.keyed(frame))
+        isEmpty = false
+        return frame
+    }
+
+    /// Returns the unkeyed container of the value at the given level, which is either the one that's already open there
+    /// or a new one.
+    func unkeyedFrame(at level: Int) -> UnkeyedFrame {
+        if frames.count > level, case let .unkeyed(frame) = frames[level] {
+            close(downTo: level + 1)
+            return frame
+        }
+        close(downTo: level)
+        write(.unkeyed)
+        let frame = UnkeyedFrame()
+        frames.append(.unkeyed(frame))
+        return frame
+    }
+
+    /// Completes the containers at and above the given level, and writes them out.
+    private func close(downTo level: Int) {
+        while frames.count > level {
+            switch frames.removeLast() {
+            case .unkeyed:
+                write(.end)
+            case let .keyed(frame):
+                write(.keyed)
+                write(UInt64(frame.fields.count))
+                for key in frame.fields.keys.sorted() {
+                    // The keys are prefixed with their length, so that the boundary between a key and its value is
+                    // unambiguous.
+                    write(UInt64(key.utf8.count))
+                    write(key)
+                    frame.fields[key]!.finish().withUnsafeBytes { update($0) }
+                }
+            }
+        }
+    }
+
+    // MARK: Single values
+
+    /// Prepares the writer for a single value at the given level.
+    private func begin(at level: Int, _ tag: Tag) {
+        close(downTo: level)
+        write(tag)
+    }
+
+    func encodeNil(level: Int) {
+        begin(at: level, .null)
+    }
+
+    func encode(_ value: Bool, level: Int) {
+        begin(at: level, value ? .trueValue : .falseValue)
+    }
+
+    func encode<T: BinaryInteger>(integer value: T, level: Int) {
+        if let signed = Int64(exactly: value) {
+            begin(at: level, .signedInteger)
+            write(UInt64(bitPattern: signed))
+        } else {
+            begin(at: level, .unsignedInteger)
+            write(UInt64(truncatingIfNeeded: value))
+        }
+    }
+
+    func encode(_ value: Double, level: Int) {
+        begin(at: level, .double)
+        // 0 and -0 are the same number.
+        write((value == 0 ? 0 : value).bitPattern)
+    }
+
+    func encode(_ value: String, level: Int) {
+        begin(at: level, .string)
+        // Strings are prefixed with their length, so that the boundaries between the elements of an array are
+        // unambiguous.
+        write(UInt64(value.utf8.count))
+        write(value)
+    }
+
+    func encode<T: Encodable>(_ value: T, level: Int, codingPath: [CodingKey]) throws {
+        switch value {
+        case let data as Data:
+            // `Data` encodes its bytes one by one otherwise.
+            begin(at: level, .data)
+            write(UInt64(data.count))
+            data.withUnsafeBytes { update($0) }
+        case let string as String:
+            encode(string, level: level)
+        default:
+            beginValue(at: level)
+            try value.encode(to: HashingEncoder(writer: self, level: level, codingPath: codingPath))
+        }
+    }
+
+    // MARK: Hashing
+
+    private func update(_ buffer: UnsafeRawBufferPointer) {
+        if buffered {
+            bytes.append(contentsOf: buffer)
+        } else {
+            hasher.update(bufferPointer: buffer)
+        }
+    }
+
+    private func write(_ tag: Tag) {
+        isEmpty = false
+        withUnsafeBytes(of: tag.rawValue) { update($0) }
+    }
+
+    private func write(_ value: UInt64) {
+        withUnsafeBytes(of: value.littleEndian) { update($0) }
+    }
+
+    private func write(_ string: String) {
+        let hashed: Void? = string.utf8.withContiguousStorageIfAvailable {
+            update(UnsafeRawBufferPointer($0))
+        }
+        guard hashed == nil else {
+            return
+        }
+
+        // Bridged strings may not be contiguous, in which case their UTF-8 view is hashed in chunks instead.
+        withUnsafeTemporaryAllocation(of: UInt8.self, capacity: 4096) { buffer in
+            var count = 0
+            for byte in string.utf8 {
+                buffer[count] = byte
+                count += 1
+                if count == buffer.count {
+                    update(UnsafeRawBufferPointer(buffer))
+                    count = 0
+                }
+            }
+            update(UnsafeRawBufferPointer(UnsafeMutableBufferPointer(rebasing: buffer[..<count])))
+        }
+    }
+
+}
+
+// MARK: - Encoder
+
+private struct HashingEncoder: Encoder {
+    let writer: HashWriter
+    let level: Int
+    let codingPath: [CodingKey]
+    var userInfo: [CodingUserInfoKey: Any] { [:] }
+
+    func container<Key: CodingKey>(keyedBy type: Key.Type) -> KeyedEncodingContainer<Key> {
+        KeyedEncodingContainer(KeyedContainer(frame: writer.keyedFrame(at: level), codingPath: codingPath))
+    }
+
+    func unkeyedContainer() -> UnkeyedEncodingContainer {
+        UnkeyedContainer(writer: writer, frame: writer.unkeyedFrame(at: level), level: level, codingPath: codingPath)
+    }
+
+    func singleValueContainer() -> SingleValueEncodingContainer {
+        SingleValueContainer(writer: writer, level: level, codingPath: codingPath)
+    }
+}
+
+/// The fields are each written into a writer of their own, at its first level.
+private struct KeyedContainer<Key: CodingKey>: KeyedEncodingContainerProtocol {
+    let frame: KeyedFrame
+    let codingPath: [CodingKey]
+
+    private func field(_ key: Key) -> HashWriter {
+        frame.field(forKey: key.stringValue)
+    }
+
+    mutating func encodeNil(forKey key: Key) throws { field(key).encodeNil(level: 0) }
+    mutating func encode(_ value: Bool, forKey key: Key) throws { field(key).encode(value, level: 0) }
+    mutating func encode(_ value: String, forKey key: Key) throws { field(key).encode(value, level: 0) }
+    mutating func encode(_ value: Double, forKey key: Key) throws { field(key).encode(value, level: 0) }
+    mutating func encode(_ value: Float, forKey key: Key) throws { field(key).encode(Double(value), level: 0) }
+    mutating func encode(_ value: Int, forKey key: Key) throws { field(key).encode(integer: value, level: 0) }
+    mutating func encode(_ value: Int8, forKey key: Key) throws { field(key).encode(integer: value, level: 0) }
+    mutating func encode(_ value: Int16, forKey key: Key) throws { field(key).encode(integer: value, level: 0) }
+    mutating func encode(_ value: Int32, forKey key: Key) throws { field(key).encode(integer: value, level: 0) }
+    mutating func encode(_ value: Int64, forKey key: Key) throws { field(key).encode(integer: value, level: 0) }
+    mutating func encode(_ value: UInt, forKey key: Key) throws { field(key).encode(integer: value, level: 0) }
+    mutating func encode(_ value: UInt8, forKey key: Key) throws { field(key).encode(integer: value, level: 0) }
+    mutating func encode(_ value: UInt16, forKey key: Key) throws { field(key).encode(integer: value, level: 0) }
+    mutating func encode(_ value: UInt32, forKey key: Key) throws { field(key).encode(integer: value, level: 0) }
+    mutating func encode(_ value: UInt64, forKey key: Key) throws { field(key).encode(integer: value, level: 0) }
+
+    mutating func encode<T: Encodable>(_ value: T, forKey key: Key) throws {
+        try field(key).encode(value, level: 0, codingPath: codingPath + [key])
+    }
+
+    mutating func nestedContainer<NestedKey: CodingKey>(
+        keyedBy keyType: NestedKey.Type,
+        forKey key: Key
+    ) -> KeyedEncodingContainer<NestedKey> {
+        let nested = field(key)
+        return KeyedEncodingContainer(
+            KeyedContainer<NestedKey>(frame: nested.keyedFrame(at: 0), codingPath: codingPath + [key])
+        )
+    }
+
+    mutating func nestedUnkeyedContainer(forKey key: Key) -> UnkeyedEncodingContainer {
+        let nested = field(key)
+        return UnkeyedContainer(writer: nested, frame: nested.unkeyedFrame(at: 0), level: 0, codingPath: codingPath + [key])
+    }
+
+    mutating func superEncoder() -> Encoder {
+        HashingEncoder(writer: frame.field(forKey: "super"), level: 0, codingPath: codingPath)
+    }
+
+    mutating func superEncoder(forKey key: Key) -> Encoder {
+        HashingEncoder(writer: field(key), level: 0, codingPath: codingPath + [key])
+    }
+}
+
+/// The elements are written straight after the container's tag, at the level above the container's.
+private struct UnkeyedContainer: UnkeyedEncodingContainer {
+    let writer: HashWriter
+    let frame: UnkeyedFrame
+    let level: Int
+    let codingPath: [CodingKey]
+
+    var count: Int {
+        frame.count
+    }
+
+    /// Returns the level of a new element.
+    private func element() -> Int {
+        frame.count += 1
+        return level + 1
+    }
+
+    mutating func encodeNil() throws { writer.encodeNil(level: element()) }
+    mutating func encode(_ value: Bool) throws { writer.encode(value, level: element()) }
+    mutating func encode(_ value: String) throws { writer.encode(value, level: element()) }
+    mutating func encode(_ value: Double) throws { writer.encode(value, level: element()) }
+    mutating func encode(_ value: Float) throws { writer.encode(Double(value), level: element()) }
+    mutating func encode(_ value: Int) throws { writer.encode(integer: value, level: element()) }
+    mutating func encode(_ value: Int8) throws { writer.encode(integer: value, level: element()) }
+    mutating func encode(_ value: Int16) throws { writer.encode(integer: value, level: element()) }
+    mutating func encode(_ value: Int32) throws { writer.encode(integer: value, level: element()) }
+    mutating func encode(_ value: Int64) throws { writer.encode(integer: value, level: element()) }
+    mutating func encode(_ value: UInt) throws { writer.encode(integer: value, level: element()) }
+    mutating func encode(_ value: UInt8) throws { writer.encode(integer: value, level: element()) }
+    mutating func encode(_ value: UInt16) throws { writer.encode(integer: value, level: element()) }
+    mutating func encode(_ value: UInt32) throws { writer.encode(integer: value, level: element()) }
+    mutating func encode(_ value: UInt64) throws { writer.encode(integer: value, level: element()) }
+
+    mutating func encode<T: Encodable>(_ value: T) throws {
+        let index = IndexKey(intValue: count)
+        try writer.encode(value, level: element(), codingPath: codingPath + [index])
+    }
+
+    mutating func nestedContainer<NestedKey: CodingKey>(keyedBy keyType: NestedKey.Type) -> KeyedEncodingContainer<NestedKey> {
+        let index = IndexKey(intValue: count)
+        let level = element()
+        writer.beginValue(at: level)
+        return KeyedEncodingContainer(
+            KeyedContainer<NestedKey>(frame: writer.keyedFrame(at: level), codingPath: codingPath + [index])
+        )
+    }
+
+    mutating func nestedUnkeyedContainer() -> UnkeyedEncodingContainer {
+        let index = IndexKey(intValue: count)
+        let level = element()
+        writer.beginValue(at: level)
+        return UnkeyedContainer(writer: writer, frame: writer.unkeyedFrame(at: level), level: level, codingPath: codingPath + [index])
+    }
+
+    mutating func superEncoder() -> Encoder {
+        let index = IndexKey(intValue: count)
+        let level = element()
+        writer.beginValue(at: level)
+        return HashingEncoder(writer: writer, level: level, codingPath: codingPath + [index])
+    }
+}
+
+private struct SingleValueContainer: SingleValueEncodingContainer {
+    let writer: HashWriter
+    let level: Int
+    let codingPath: [CodingKey]
+
+    mutating func encodeNil() throws { writer.encodeNil(level: level) }
+    mutating func encode(_ value: Bool) throws { writer.encode(value, level: level) }
+    mutating func encode(_ value: String) throws { writer.encode(value, level: level) }
+    mutating func encode(_ value: Double) throws { writer.encode(value, level: level) }
+    mutating func encode(_ value: Float) throws { writer.encode(Double(value), level: level) }
+    mutating func encode(_ value: Int) throws { writer.encode(integer: value, level: level) }
+    mutating func encode(_ value: Int8) throws { writer.encode(integer: value, level: level) }
+    mutating func encode(_ value: Int16) throws { writer.encode(integer: value, level: level) }
+    mutating func encode(_ value: Int32) throws { writer.encode(integer: value, level: level) }
+    mutating func encode(_ value: Int64) throws { writer.encode(integer: value, level: level) }
+    mutating func encode(_ value: UInt) throws { writer.encode(integer: value, level: level) }
+    mutating func encode(_ value: UInt8) throws { writer.encode(integer: value, level: level) }
+    mutating func encode(_ value: UInt16) throws { writer.encode(integer: value, level: level) }
+    mutating func encode(_ value: UInt32) throws { writer.encode(integer: value, level: level) }
+    mutating func encode(_ value: UInt64) throws { writer.encode(integer: value, level: level) }
+
+    mutating func encode<T: Encodable>(_ value: T) throws {
+        try writer.encode(value, level: level, codingPath: codingPath)
+    }
+}
+
+private struct IndexKey: CodingKey {
+    let intValue: Int?
+    var stringValue: String { "Index \(intValue ?? 0)" }
+
+    init(intValue: Int) {
+        self.intValue = intValue
+    }
+
+    init?(stringValue: String) {
+        return nil
+    }
+}
@@ -0,0 +1,49 @@
+import Foundation
+
+/// A pool of strings that the models share, so that the values that are repeated across the models of a response, like
+/// the site names and URLs, or the avatar URLs, are stored once.
+///
+/// Interning is opt-in: set a pool on a service, e.g. `ReaderPostServiceRemote.stringPool`, for the duration of a
+/// response or of a sync session. The pool keeps the strings until it's released, so it shouldn't outlive the session.
+///
+/// The pool is thread-safe: a service can be shared by requests whose responses are mapped on different threads, like
+/// the async fetches, which map them on the cooperative thread pool.
+@objc public final class StringInterningPool: NSObject {
+
+    private let lock = NSLock()
+    private let strings = NSMutableSet()
+
+    /// The number of distinct strings in the pool.
+    @objc public var count: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return strings.count
+    }
+
+    /// Returns the string in the pool that's equal to the given string, adding it to the pool if there isn't one.
+    public func intern(_ string: String?) -> String? {
+        intern(string as NSString?) as String?
+    }
+
+    /// Returns the string in the pool that's equal to the given string, adding it to the pool if there isn't one.
+    ///
+    /// The strings are stored as `NSString`s, because they're mostly the strings of parsed responses, whose hashes are
+    /// cheaper than `String`'s.
+    @objc(internString:)
+    public func intern(_ string: NSString?) -> NSString? {
+        guard let string else {
+            return nil
+        }
+        // A mutable string could change once it's in the pool.
+        let immutable = string.copy() as? NSString ?? string
+
+        lock.lock()
+        defer { lock.unlock() }
+        if let existing = strings.member(immutable) as? NSString {
+            return existing
+        }
+        strings.add(immutable)
+        return immutable
+    }
+
+}
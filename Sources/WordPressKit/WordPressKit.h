@@ -7,6 +7,7 @@ FOUNDATION_EXPORT double WordPressKitVersionNumber;
 FOUNDATION_EXPORT const unsigned char WordPressKitVersionString[];
 
 #import <WordPressKit/FilePart.h>
+#import <WordPressKit/HTTPRequestPriority.h>
 #import <WordPressKit/WordPressComRESTAPIInterfacing.h>
 #import <WordPressKit/WordPressComRESTAPIVersion.h>
 #import <WordPressKit/WordPressComRESTAPIVersionedPathBuilder.h>
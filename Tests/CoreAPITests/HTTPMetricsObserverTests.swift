@@ -0,0 +1,151 @@
+import Foundation
+import XCTest
+import OHHTTPStubs
+#if SWIFT_PACKAGE
+@testable import CoreAPI
+import OHHTTPStubsSwift
+#else
+@testable import WordPressKit
+#endif
+
+class HTTPMetricsObserverTests: XCTestCase {
+
+    override func tearDown() {
+        super.tearDown()
+        HTTPStubs.removeAllStubs()
+    }
+
+    func testEndpointTemplate() throws {
+        let wpcom = try XCTUnwrap(URL(string: "https://public-api.wordpress.com"))
+        XCTAssertEqual(
+            HTTPRequestBuilder(url: wpcom).appendURLString("/rest/v1.1/sites/123/posts/45?context=edit").endpointTemplate,
+            "GET /rest/v1.1/sites/:site/posts/:id"
+        )
+        XCTAssertEqual(
+            HTTPRequestBuilder(url: wpcom).method(.post).append(percentEncodedPath: "/rest/v1.1/sites/example.com/media/new").endpointTemplate,
+            "POST /rest/v1.1/sites/:site/media/new"
+        )
+
+        // Identifiers that aren't numbers.
+        XCTAssertEqual(
+            HTTPRequestBuilder(url: wpcom).appendURLString("/rest/v1.2/read/feed/http%3A%2F%2Fexample.com%2Ffeed/posts").endpointTemplate,
+            "GET /rest/v1.2/read/feed/:id/posts"
+        )
+        XCTAssertEqual(
+            HTTPRequestBuilder(url: wpcom).appendURLString("/rest/v1.1/sites/123/posts/slug:hello-world").endpointTemplate,
+            "GET /rest/v1.1/sites/:site/posts/:id"
+        )
+        XCTAssertEqual(
+            HTTPRequestBuilder(url: wpcom).appendURLString("/rest/v1.1/users/2f9c4e1a0b7d4c3e9a8b6d5c4b3a2918/profile").endpointTemplate,
+            "GET /rest/v1.1/users/:id/profile"
+        )
+        XCTAssertEqual(
+            HTTPRequestBuilder(url: wpcom).appendURLString("/rest/v1.1/me/preferences").endpointTemplate,
+            "GET /rest/v1.1/me/preferences"
+        )
+
+        let selfHosted = try XCTUnwrap(URL(string: "https://example.com/blog/wp-json"))
+        XCTAssertEqual(
+            HTTPRequestBuilder(url: selfHosted).append(percentEncodedPath: "/wp/v2/posts/12").endpointTemplate,
+            "GET /wp-json/wp/v2/posts/:id"
+        )
+
+        let xmlrpc = try XCTUnwrap(URL(string: "https://example.com/xmlrpc.php"))
+        XCTAssertEqual(
+            HTTPRequestBuilder(url: xmlrpc).method(.post).body(xmlrpc: "wp.getPosts", parameters: [1]).endpointTemplate,
+            "XMLRPC wp.getPosts"
+        )
+    }
+
+    func testPercentiles() throws {
+        let observer = HTTPMetricsObserver(windowSize: 100)
+        for index in 1...150 {
+            observer.record(metrics(endpoint: "GET /a", duration: TimeInterval(index), reused: index.isMultiple(of: 2)))
+        }
+        observer.record(metrics(endpoint: "GET /b", duration: 1, reused: false))
+
+        let snapshot = observer.snapshot()
+        let summary = try XCTUnwrap(snapshot["GET /a"])
+        XCTAssertEqual(summary.count, 150)
+        // Only the most recent 100 requests (51...150) are in the window.
+        XCTAssertEqual(summary.duration.p50, 100)
+        XCTAssertEqual(summary.duration.p95, 145)
+        XCTAssertEqual(summary.duration.p99, 149)
+        XCTAssertEqual(summary.connectionReuseRate, 0.5)
+        XCTAssertEqual(summary.responseBytes, 150 * 10)
+
+        XCTAssertEqual(snapshot["GET /b"]?.count, 1)
+        XCTAssertEqual(snapshot["GET /b"]?.duration.p99, 1)
+    }
+
+    func testEndpointsPastMaximumAreSummarizedTogether() {
+        let observer = HTTPMetricsObserver(maximumEndpointCount: 2)
+        for endpoint in ["GET /a", "GET /b", "GET /c", "GET /a", "GET /d"] {
+            observer.record(metrics(endpoint: endpoint, duration: 1, reused: false))
+        }
+
+        let snapshot = observer.snapshot()
+        XCTAssertEqual(Set(snapshot.keys), ["GET /a", "GET /b", HTTPMetricsObserver.otherEndpoints])
+        XCTAssertEqual(snapshot["GET /a"]?.count, 2)
+        XCTAssertEqual(snapshot[HTTPMetricsObserver.otherEndpoints]?.count, 2)
+    }
+
+    func testCollectingWordPressComMetrics() {
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            HTTPStubsResponse(jsonObject: ["ID": 45], statusCode: 200, headers: nil)
+        }
+
+        let collected = expectation(description: "Metrics are collected")
+        let api = WordPressComRestApi()
+        api.metricsObserver = HTTPMetricsObserver { metrics in
+            XCTAssertEqual(metrics.endpoint, "GET /rest/v1.1/sites/:site/posts/:id")
+            XCTAssertEqual(metrics.statusCode, 200)
+            XCTAssertGreaterThan(metrics.duration, 0)
+            collected.fulfill()
+        }
+
+        let completed = expectation(description: "The request completes")
+        api.GET(
+            "/rest/v1.1/sites/123/posts/45",
+            parameters: nil,
+            success: { _, _ in completed.fulfill() },
+            failure: { error, _ in
+                XCTFail("Unexpected error: \(error)")
+                completed.fulfill()
+            }
+        )
+        wait(for: [collected, completed], timeout: 1)
+
+        XCTAssertEqual(api.metricsObserver?.snapshot()["GET /rest/v1.1/sites/:site/posts/:id"]?.count, 1)
+    }
+
+    func testMetricsAreNotCollectedWithoutObserver() async throws {
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            HTTPStubsResponse(jsonObject: [:], statusCode: 200, headers: nil)
+        }
+
+        let observer = HTTPMetricsObserver()
+        let api = WordPressComRestApi()
+        _ = try await api.perform(.get, URLString: "/rest/v1.1/me").get()
+
+        api.metricsObserver = observer
+        _ = try await api.perform(.get, URLString: "/rest/v1.1/me/settings").get()
+        try await Task.sleep(nanoseconds: 100_000_000)
+
+        XCTAssertEqual(Array(observer.snapshot().keys), ["GET /rest/v1.1/me/settings"])
+    }
+
+    private func metrics(endpoint: String, duration: TimeInterval, reused: Bool) -> HTTPRequestMetrics {
+        HTTPRequestMetrics(
+            endpoint: endpoint,
+            statusCode: 200,
+            duration: duration,
+            requestBytes: 10,
+            responseBytes: 10,
+            reusedConnection: reused,
+            networkProtocol: "h2",
+            redirectCount: 0
+        )
+    }
+
+}
@@ -0,0 +1,141 @@
+import Foundation
+import XCTest
+import OHHTTPStubs
+#if SWIFT_PACKAGE
+@testable import CoreAPI
+import OHHTTPStubsSwift
+#else
+@testable import WordPressKit
+#endif
+
+class HTTPRateLimiterTests: XCTestCase {
+
+    private let url = URL(string: "https://public-api.wordpress.com/rest/v1.1/me")!
+
+    override func tearDown() {
+        super.tearDown()
+        HTTPStubs.removeAllStubs()
+    }
+
+    func testBurstIsNotDelayed() async {
+        let limiter = HTTPRateLimiter(rate: 1, burst: 3)
+
+        let start = Date()
+        for _ in 1...3 {
+            let sent = await limiter.wait(for: url)
+            XCTAssertTrue(sent)
+        }
+
+        XCTAssertLessThan(Date().timeIntervalSince(start), 0.5)
+        XCTAssertEqual(limiter.statistics.waits, 0)
+    }
+
+    func testRequestsWaitForTokens() async {
+        let limiter = HTTPRateLimiter(rate: 5, burst: 1)
+
+        let start = Date()
+        for _ in 1...3 {
+            _ = await limiter.wait(for: url)
+        }
+
+        // The second and third requests wait 0.2 seconds each.
+        XCTAssertGreaterThanOrEqual(Date().timeIntervalSince(start), 0.35)
+        XCTAssertEqual(limiter.statistics.waits, 2)
+    }
+
+    func testBucketsAreKeyedByHost() async throws {
+        let limiter = HTTPRateLimiter(rate: 0.1, burst: 1)
+        let otherURL = try XCTUnwrap(URL(string: "https://example.com/wp-json/wp/v2/posts"))
+
+        _ = await limiter.wait(for: url)
+        _ = await limiter.wait(for: otherURL)
+
+        XCTAssertEqual(limiter.statistics.waits, 0)
+    }
+
+    func testCustomKey() async throws {
+        let limiter = HTTPRateLimiter(rate: 0.1, burst: 1) { $0.path }
+        let otherURL = try XCTUnwrap(URL(string: "https://public-api.wordpress.com/rest/v1.1/sites"))
+
+        _ = await limiter.wait(for: url)
+        _ = await limiter.wait(for: otherURL)
+
+        XCTAssertEqual(limiter.statistics.waits, 0)
+    }
+
+    func testThrottlingBlocksTheBucket() async {
+        let limiter = HTTPRateLimiter(rate: 100, burst: 10)
+        limiter.throttle(url, for: 0.5)
+
+        let start = Date()
+        _ = await limiter.wait(for: url)
+
+        XCTAssertGreaterThanOrEqual(Date().timeIntervalSince(start), 0.45)
+        XCTAssertEqual(limiter.statistics.throttles, 1)
+    }
+
+    func testCancellingWhileWaiting() async {
+        let limiter = HTTPRateLimiter(rate: 100, burst: 10)
+        limiter.throttle(url, for: 10)
+
+        let progress = Progress.discreteProgress(totalUnitCount: 100)
+        DispatchQueue.main.asyncAfter(deadline: .now() + 0.2) {
+            progress.cancel()
+        }
+
+        let sent = await limiter.wait(for: url, cancelledBy: progress)
+        XCTAssertFalse(sent)
+        XCTAssertNil(progress.cancellationHandler)
+    }
+
+    func testThrottledResponseTightensTheLimiter() async {
+        var requests = 0
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            requests += 1
+            return HTTPStubsResponse(data: Data("<html><body>Limit reached</body></html>".utf8), statusCode: 400, headers: nil)
+        }
+
+        let api = WordPressComRestApi()
+        api.rateLimiter = HTTPRateLimiter(rate: 10, burst: 10)
+
+        let result = await api.perform(.get, URLString: "/rest/v1/foo")
+        if case let .failure(.endpointError(error)) = result {
+            XCTAssertEqual(error.code, .tooManyRequests)
+        } else {
+            XCTFail("Unexpected result: \(result)")
+        }
+
+        XCTAssertEqual(requests, 1)
+        XCTAssertEqual(api.rateLimiter?.statistics.throttles, 1)
+    }
+
+    func testThrottledTooManyRequestsResponseTightensTheLimiterOnce() async {
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            HTTPStubsResponse(data: Data("<html><body>Limit reached</body></html>".utf8), statusCode: 429, headers: nil)
+        }
+
+        let api = WordPressComRestApi()
+        api.rateLimiter = HTTPRateLimiter(rate: 10, burst: 10)
+
+        _ = await api.perform(.get, URLString: "/rest/v1/foo")
+        XCTAssertEqual(api.rateLimiter?.statistics.throttles, 1)
+    }
+
+    func testTooManyRequestsResponseTightensTheLimiter() async {
+        stub(condition: isHost("example.com")) { _ in
+            HTTPStubsResponse(data: Data(), statusCode: 429, headers: ["Retry-After": "0.3"])
+        }
+
+        let limiter = HTTPRateLimiter(rate: 10, burst: 10)
+        let builder = HTTPRequestBuilder(url: URL(string: "https://example.com/wp-json/wp/v2/posts")!)
+
+        _ = await URLSession.shared.perform(request: builder, errorType: WordPressOrgRestApiError.self, rateLimiter: limiter)
+        XCTAssertEqual(limiter.statistics.throttles, 1)
+
+        let start = Date()
+        _ = await URLSession.shared.perform(request: builder, errorType: WordPressOrgRestApiError.self, rateLimiter: limiter)
+        XCTAssertGreaterThanOrEqual(Date().timeIntervalSince(start), 0.2)
+        XCTAssertEqual(limiter.statistics.waits, 1)
+    }
+
+}
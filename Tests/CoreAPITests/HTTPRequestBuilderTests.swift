@@ -362,6 +362,31 @@ class HTTPRequestBuilderTests: XCTestCase {
         )
     }
 
+    func testMultipartFormWithFileIsStreamed() throws {
+        let file = FileManager.default.temporaryDirectory.appendingPathComponent("\(UUID().uuidString).jpg")
+        try Data(repeating: 0xFF, count: 100_000).write(to: file)
+        defer { try? FileManager.default.removeItem(at: file) }
+
+        let builder = HTTPRequestBuilder(url: URL(string: "https://wordpress.org")!)
+            .method(.post)
+            .body(form: [try MultipartFormField(fileAtPath: file.path, name: "media", filename: "image.jpg", mimeType: "image/jpeg")])
+        var request = try builder.build(encodeBody: false)
+
+        // The form's stream is only made by a provider, which stops it when the request completes.
+        XCTAssertThrowsError(try builder.encodeMultipartForm(request: &request, forceWriteToFile: false))
+        let bodyStreams = try XCTUnwrap(builder.multipartFormBodyStreams())
+        defer { bodyStreams.stop() }
+        XCTAssertNil(try builder.encodeMultipartForm(request: &request, forceWriteToFile: false, bodyStreams: bodyStreams))
+        XCTAssertNil(request.httpBody)
+        XCTAssertNotNil(request.httpBodyStream)
+
+        // A request that's built with its body doesn't stream the form.
+        XCTAssertNotNil(try builder.build(encodeBody: true).httpBody)
+
+        let materialized = try XCTUnwrap(builder.encodeMultipartForm(request: &request, forceWriteToFile: true)).readToEnd()
+        XCTAssertEqual(request.value(forHTTPHeaderField: "Content-Length"), "\(materialized.count)")
+    }
+
     func testXMLRPCRequest() throws {
         let request = try HTTPRequestBuilder(url: URL(string: "https://wordpress.org")!)
             .method(.post)
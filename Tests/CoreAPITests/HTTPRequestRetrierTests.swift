@@ -0,0 +1,248 @@
+import Foundation
+import XCTest
+import OHHTTPStubs
+#if SWIFT_PACKAGE
+@testable import CoreAPI
+import OHHTTPStubsSwift
+#else
+@testable import WordPressKit
+#endif
+
+class HTTPRequestRetrierTests: XCTestCase {
+
+    private let fastPolicy = HTTPRetryPolicy(maxRetries: 2, baseDelay: 0.01, maxDelay: 0.05)
+
+    override func tearDown() {
+        super.tearDown()
+        HTTPStubs.removeAllStubs()
+    }
+
+    func testRetriesTransientFailures() async throws {
+        var requests = 0
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            requests += 1
+            if requests == 1 {
+                return HTTPStubsResponse(data: Data(), statusCode: 503, headers: nil)
+            }
+            return HTTPStubsResponse(jsonObject: ["foo": "bar"], statusCode: 200, headers: nil)
+        }
+
+        let api = WordPressComRestApi()
+        api.retryPolicy = fastPolicy
+
+        let response = try await api.perform(.get, URLString: "/rest/v1/foo").get()
+        XCTAssertEqual((response.body as? [String: String])?["foo"], "bar")
+        XCTAssertEqual(requests, 2)
+        XCTAssertEqual(api.retryStatistics.retries, 1)
+        XCTAssertGreaterThan(api.retryStatistics.totalDelay, 0)
+    }
+
+    func testRetriesAreDisabledByDefault() async throws {
+        var requests = 0
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            requests += 1
+            return HTTPStubsResponse(data: Data(), statusCode: 503, headers: nil)
+        }
+
+        let api = WordPressComRestApi()
+        let result = await api.perform(.get, URLString: "/rest/v1/foo")
+
+        XCTAssertThrowsError(try result.get())
+        XCTAssertEqual(requests, 1)
+        XCTAssertEqual(api.retryStatistics.retries, 0)
+    }
+
+    func testGivingUpAfterMaxRetries() async throws {
+        var requests = 0
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            requests += 1
+            return HTTPStubsResponse(data: Data(), statusCode: 502, headers: nil)
+        }
+
+        let api = WordPressComRestApi()
+        api.retryPolicy = fastPolicy
+
+        let result = await api.perform(.get, URLString: "/rest/v1/foo")
+        XCTAssertThrowsError(try result.get())
+        XCTAssertEqual(requests, 3)
+    }
+
+    func testNonRetryableStatusCode() async throws {
+        var requests = 0
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            requests += 1
+            return HTTPStubsResponse(jsonObject: ["error": "invalid_input", "message": "Invalid"], statusCode: 400, headers: nil)
+        }
+
+        let api = WordPressComRestApi()
+        api.retryPolicy = fastPolicy
+
+        _ = await api.perform(.get, URLString: "/rest/v1/foo")
+        XCTAssertEqual(requests, 1)
+    }
+
+    func testPOSTIsOnlyRetriedWhenMarkedSafe() async throws {
+        var requests = 0
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            requests += 1
+            return HTTPStubsResponse(data: Data(), statusCode: 503, headers: nil)
+        }
+
+        let api = WordPressComRestApi()
+        api.retryPolicy = fastPolicy
+
+        _ = await api.perform(.post, URLString: "/rest/v1/foo")
+        XCTAssertEqual(requests, 1)
+
+        requests = 0
+        _ = await api.perform(.post, URLString: "/rest/v1/foo", retryPolicy: fastPolicy.retryingNonIdempotentRequests())
+        XCTAssertEqual(requests, 3)
+    }
+
+    func testPerRequestPolicyOverridesInstancePolicy() async throws {
+        var requests = 0
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            requests += 1
+            return HTTPStubsResponse(data: Data(), statusCode: 503, headers: nil)
+        }
+
+        let api = WordPressComRestApi()
+        api.retryPolicy = fastPolicy
+
+        _ = await api.perform(.get, URLString: "/rest/v1/foo", retryPolicy: HTTPRetryPolicy.none)
+        XCTAssertEqual(requests, 1)
+    }
+
+    func testRetryAfterIsHonored() async throws {
+        var requests = 0
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            requests += 1
+            if requests == 1 {
+                return HTTPStubsResponse(data: Data(), statusCode: 429, headers: ["Retry-After": "1"])
+            }
+            return HTTPStubsResponse(jsonObject: [:], statusCode: 200, headers: nil)
+        }
+
+        let api = WordPressComRestApi()
+        api.retryPolicy = fastPolicy
+
+        let start = Date()
+        _ = try await api.perform(.get, URLString: "/rest/v1/foo").get()
+        XCTAssertGreaterThanOrEqual(Date().timeIntervalSince(start), 1)
+        XCTAssertEqual(requests, 2)
+        XCTAssertEqual(api.retryStatistics.totalDelay, 1)
+    }
+
+    func testRetryAfterLongerThanMaximumIsNotRetried() async throws {
+        var requests = 0
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            requests += 1
+            return HTTPStubsResponse(data: Data(), statusCode: 503, headers: ["Retry-After": "3600"])
+        }
+
+        let api = WordPressComRestApi()
+        api.retryPolicy = fastPolicy
+
+        _ = await api.perform(.get, URLString: "/rest/v1/foo")
+        XCTAssertEqual(requests, 1)
+    }
+
+    func testThrottledRequestIsNotRetriedEarly() async throws {
+        var requests = 0
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            requests += 1
+            return HTTPStubsResponse(data: Data("<html><body>Limit reached</body></html>".utf8), statusCode: 400, headers: nil)
+        }
+
+        let api = WordPressComRestApi()
+        api.retryPolicy = fastPolicy
+
+        let result = await api.perform(.get, URLString: "/rest/v1/foo")
+        if case let .failure(.endpointError(error)) = result {
+            XCTAssertEqual(error.code, .tooManyRequests)
+        } else {
+            XCTFail("Unexpected result: \(result)")
+        }
+        XCTAssertEqual(requests, 1)
+    }
+
+    func testSuccessfulResponsesAreNotCheckedForThrottling() async throws {
+        var throttlingChecks = 0
+        let retrier = HTTPRequestRetrier(policy: fastPolicy) { _, _ in
+            throttlingChecks += 1
+            return 60
+        }
+
+        let url = try XCTUnwrap(URL(string: "https://public-api.wordpress.com/rest/v1/foo"))
+        let response = try XCTUnwrap(HTTPURLResponse(url: url, statusCode: 200, httpVersion: nil, headerFields: nil))
+        var attempts = 0
+        let result: WordPressAPIResult<HTTPAPIResponse<Data>, WordPressComRestApiEndpointError> = await retrier.perform(method: .get, fulfilling: nil) { _ in
+            attempts += 1
+            return .success(HTTPAPIResponse(response: response, body: Data("Limit reached".utf8)))
+        }
+
+        XCTAssertNoThrow(try result.get())
+        XCTAssertEqual(attempts, 1)
+        XCTAssertEqual(throttlingChecks, 0)
+    }
+
+    func testRetryBudget() async throws {
+        var requests = 0
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            requests += 1
+            return HTTPStubsResponse(data: Data(), statusCode: 503, headers: nil)
+        }
+
+        var policy = fastPolicy
+        policy.retryBudget = 3
+        let api = WordPressComRestApi()
+        api.retryPolicy = policy
+
+        _ = await api.perform(.get, URLString: "/rest/v1/foo")
+        _ = await api.perform(.get, URLString: "/rest/v1/foo")
+
+        // Two retries for the first request, one for the second.
+        XCTAssertEqual(requests, 5)
+        XCTAssertEqual(api.retryStatistics.retries, 3)
+        XCTAssertEqual(api.retryStatistics.exhaustedBudget, 1)
+    }
+
+    func testCancellingDuringBackoff() async throws {
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            HTTPStubsResponse(data: Data(), statusCode: 503, headers: nil)
+        }
+
+        let api = WordPressComRestApi()
+        api.retryPolicy = HTTPRetryPolicy(maxRetries: 2, baseDelay: 10, maxDelay: 10)
+
+        let progress = Progress.discreteProgress(totalUnitCount: 100)
+        DispatchQueue.main.asyncAfter(deadline: .now() + 0.5) {
+            progress.cancel()
+        }
+
+        let start = Date()
+        let result = await api.perform(.get, URLString: "/rest/v1/foo", fulfilling: progress)
+        XCTAssertLessThan(Date().timeIntervalSince(start), 5)
+        if case let .failure(.connection(error)) = result {
+            XCTAssertEqual(error.code, .cancelled)
+        } else {
+            XCTFail("Unexpected result: \(result)")
+        }
+    }
+
+    func testParsingRetryAfter() throws {
+        let url = try XCTUnwrap(URL(string: "https://example.com"))
+        let now = Date(timeIntervalSince1970: 1_445_412_480) // Wed, 21 Oct 2015 07:28:00 GMT
+
+        func retryAfter(_ value: String) -> TimeInterval? {
+            let response = HTTPURLResponse(url: url, statusCode: 503, httpVersion: nil, headerFields: ["Retry-After": value])!
+            return HTTPRequestRetrier.retryAfter(in: response, now: now)
+        }
+
+        XCTAssertEqual(retryAfter("120"), 120)
+        XCTAssertEqual(retryAfter("Wed, 21 Oct 2015 07:29:00 GMT"), 60)
+        XCTAssertEqual(retryAfter("Wed, 21 Oct 2015 07:27:00 GMT"), 0)
+        XCTAssertNil(retryAfter("soon"))
+    }
+
+}
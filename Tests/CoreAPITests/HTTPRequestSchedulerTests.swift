@@ -0,0 +1,288 @@
+import Foundation
+import XCTest
+import OHHTTPStubs
+#if SWIFT_PACKAGE
+import APIInterface
+@testable import CoreAPI
+import OHHTTPStubsSwift
+#else
+@testable import WordPressKit
+#endif
+
+class HTTPRequestSchedulerTests: XCTestCase {
+
+    override func tearDown() {
+        super.tearDown()
+        HTTPStubs.removeAllStubs()
+    }
+
+    func testConcurrencyIsLimitedPerHost() async {
+        let scheduler = HTTPRequestScheduler(maxConcurrentRequestsPerHost: 2)
+        let recorder = Recorder()
+
+        await withTaskGroup(of: Void.self) { group in
+            for host in ["a.example.com", "b.example.com"] {
+                for _ in 1...4 {
+                    group.addTask {
+                        _ = await scheduler.perform(self.request(host: host), priority: .default, fulfilling: nil, cancelled: { () }) { _ in
+                            recorder.begin(host)
+                            try? await Task.sleep(nanoseconds: 50_000_000)
+                            recorder.end(host)
+                        }
+                    }
+                }
+            }
+        }
+
+        XCTAssertEqual(recorder.maxConcurrency["a.example.com"], 2)
+        XCTAssertEqual(recorder.maxConcurrency["b.example.com"], 2)
+        XCTAssertEqual(scheduler.statistics.performed, 8)
+        XCTAssertEqual(scheduler.statistics.queued, 4)
+        XCTAssertGreaterThan(scheduler.statistics.totalQueueTime, 0)
+        XCTAssertGreaterThan(scheduler.statistics.totalNetworkTime, 0)
+    }
+
+    func testQueuedRequestsAreSentInPriorityOrder() async {
+        let scheduler = HTTPRequestScheduler(maxConcurrentRequestsPerHost: 1)
+        let recorder = Recorder()
+        let gate = Gate()
+
+        let blocker = Task {
+            await scheduler.perform(request(path: "/blocker"), priority: .default, fulfilling: nil, cancelled: { () }) { _ in
+                await gate.wait()
+            }
+        }
+
+        var tasks = [blocker]
+        for (index, priority) in [HTTPRequestPriority.background, .default, .interactive, .default].enumerated() {
+            let path = "/\(index)-\(priority.rawValue)"
+            tasks.append(Task {
+                await scheduler.perform(request(path: path), priority: priority, fulfilling: nil, cancelled: { () }) { _ in
+                    recorder.record(path)
+                }
+            })
+            await waitUntil { scheduler.statistics.queued == index + 1 }
+        }
+
+        gate.open()
+        for task in tasks {
+            await task.value
+        }
+
+        XCTAssertEqual(recorder.order, ["/2-1", "/1-0", "/3-0", "/0--1"])
+    }
+
+    func testPromotingQueuedRequest() async {
+        let scheduler = HTTPRequestScheduler(maxConcurrentRequestsPerHost: 1)
+        let recorder = Recorder()
+        let gate = Gate()
+
+        let blocker = Task {
+            await scheduler.perform(request(path: "/blocker"), priority: .default, fulfilling: nil, cancelled: { () }) { _ in
+                await gate.wait()
+            }
+        }
+
+        var tasks = [blocker]
+        for (index, path) in ["/notifications", "/reader"].enumerated() {
+            tasks.append(Task {
+                await scheduler.perform(request(path: path), priority: .background, fulfilling: nil, cancelled: { () }) { _ in
+                    recorder.record(path)
+                }
+            })
+            await waitUntil { scheduler.statistics.queued == index + 1 }
+        }
+
+        scheduler.promote(request(path: "/reader"), to: .interactive)
+        XCTAssertEqual(scheduler.statistics.promoted, 1)
+
+        gate.open()
+        for task in tasks {
+            await task.value
+        }
+
+        XCTAssertEqual(recorder.order, ["/reader", "/notifications"])
+    }
+
+    func testCancellingQueuedRequest() async {
+        let scheduler = HTTPRequestScheduler(maxConcurrentRequestsPerHost: 1)
+        let gate = Gate()
+
+        let blocker = Task {
+            await scheduler.perform(request(path: "/blocker"), priority: .default, fulfilling: nil, cancelled: { () }) { _ in
+                await gate.wait()
+            }
+        }
+        await waitUntil { scheduler.statistics.performed == 1 }
+
+        let progress = Progress.discreteProgress(totalUnitCount: 100)
+        let queued = Task {
+            await scheduler.perform(request(path: "/queued"), priority: .default, fulfilling: progress, cancelled: { false }) { _ in true }
+        }
+        await waitUntil { scheduler.statistics.queued == 1 }
+
+        progress.cancel()
+        let sent = await queued.value
+        XCTAssertFalse(sent)
+        XCTAssertNil(progress.cancellationHandler)
+
+        gate.open()
+        await blocker.value
+        XCTAssertEqual(scheduler.statistics.performed, 1)
+    }
+
+    func testConcurrentEnqueueAndFinishDontLoseRequests() async {
+        let scheduler = HTTPRequestScheduler(maxConcurrentRequestsPerHost: 1)
+        let recorder = Recorder()
+        let completed = expectation(description: "All requests are sent")
+
+        // The requests finish as soon as they're sent, so that slots are freed while other requests are being queued.
+        let requests = Task {
+            await withTaskGroup(of: Void.self) { group in
+                for _ in 1...1_000 {
+                    group.addTask {
+                        _ = await scheduler.perform(self.request(), priority: .default, fulfilling: nil, cancelled: { () }) { _ in
+                            recorder.begin("example.com")
+                            recorder.end("example.com")
+                        }
+                    }
+                }
+            }
+            completed.fulfill()
+        }
+
+        await fulfillment(of: [completed], timeout: 10)
+        requests.cancel()
+
+        XCTAssertEqual(scheduler.statistics.performed, 1_000)
+        XCTAssertEqual(recorder.maxConcurrency["example.com"], 1)
+    }
+
+    func testTaggingWordPressComRequests() async throws {
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            HTTPStubsResponse(jsonObject: [:], statusCode: 200, headers: nil).responseTime(0.1)
+        }
+
+        let api = WordPressComRestApi()
+        api.scheduler = HTTPRequestScheduler(maxConcurrentRequestsPerHost: 1)
+
+        async let background = api.perform(.get, URLString: "/rest/v1/background", priority: .background)
+        async let interactive = api.perform(.get, URLString: "/rest/v1/interactive", priority: .interactive)
+        _ = try await (background.get(), interactive.get())
+
+        XCTAssertEqual(api.scheduler?.statistics.performed, 2)
+        XCTAssertEqual(api.scheduler?.statistics.queued, 1)
+    }
+
+    func testDuplicateRequestPromotesQueuedRequestWithoutCoalescing() async throws {
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            HTTPStubsResponse(jsonObject: [:], statusCode: 200, headers: nil).responseTime(0.2)
+        }
+
+        let scheduler = HTTPRequestScheduler(maxConcurrentRequestsPerHost: 1)
+        let api = WordPressComRestApi()
+        api.scheduler = scheduler
+        XCTAssertFalse(api.coalescesInFlightGETRequests)
+
+        let blocker = Task { await api.perform(.get, URLString: "/rest/v1/blocker") }
+        await waitUntil { scheduler.statistics.performed == 1 }
+        let background = Task { await api.perform(.get, URLString: "/rest/v1/reader", priority: .background) }
+        await waitUntil { scheduler.statistics.queued == 1 }
+        let interactive = Task { await api.perform(.get, URLString: "/rest/v1/reader", priority: .interactive) }
+        await waitUntil { scheduler.statistics.queued == 2 }
+
+        XCTAssertEqual(scheduler.statistics.promoted, 1)
+        _ = try await (blocker.value.get(), background.value.get(), interactive.value.get())
+        XCTAssertEqual(scheduler.statistics.performed, 3)
+    }
+
+    func testTaggingWordPressOrgRequests() async throws {
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            HTTPStubsResponse(jsonObject: [:], statusCode: 200, headers: nil).responseTime(0.1)
+        }
+
+        let api = WordPressOrgRestApi(dotComSiteID: 1001, bearerToken: "fakeToken")
+        api.scheduler = HTTPRequestScheduler(maxConcurrentRequestsPerHost: 1)
+
+        async let background = api.get(path: "/wp/v2/background", priority: .background)
+        async let interactive = api.get(path: "/wp/v2/interactive", priority: .interactive)
+        _ = try await (background.get(), interactive.get())
+
+        XCTAssertEqual(api.scheduler?.statistics.performed, 2)
+        XCTAssertEqual(api.scheduler?.statistics.queued, 1)
+    }
+
+    // MARK: - Helpers
+
+    private func request(host: String = "example.com", path: String = "/") -> URLRequest {
+        URLRequest(url: URL(string: "https://\(host)\(path)")!)
+    }
+
+    private func waitUntil(_ condition: () -> Bool) async {
+        while !condition() {
+            try? await Task.sleep(nanoseconds: 10_000_000)
+        }
+    }
+
+}
+
+private final class Recorder {
+    private let lock = NSLock()
+    private var inFlight = [String: Int]()
+    private var _maxConcurrency = [String: Int]()
+    private var _order = [String]()
+
+    var maxConcurrency: [String: Int] {
+        lock.lock()
+        defer { lock.unlock() }
+        return _maxConcurrency
+    }
+
+    var order: [String] {
+        lock.lock()
+        defer { lock.unlock() }
+        return _order
+    }
+
+    func begin(_ host: String) {
+        lock.lock()
+        inFlight[host, default: 0] += 1
+        _maxConcurrency[host] = max(_maxConcurrency[host] ?? 0, inFlight[host]!)
+        lock.unlock()
+    }
+
+    func end(_ host: String) {
+        lock.lock()
+        inFlight[host, default: 0] -= 1
+        lock.unlock()
+    }
+
+    func record(_ path: String) {
+        lock.lock()
+        _order.append(path)
+        lock.unlock()
+    }
+}
+
+private final class Gate {
+    private let lock = NSLock()
+    private var isOpen = false
+
+    func open() {
+        lock.lock()
+        isOpen = true
+        lock.unlock()
+    }
+
+    func wait() async {
+        while !opened {
+            try? await Task.sleep(nanoseconds: 10_000_000)
+        }
+    }
+
+    private var opened: Bool {
+        lock.lock()
+        defer { lock.unlock() }
+        return isOpen
+    }
+}
@@ -0,0 +1,198 @@
+import Foundation
+import XCTest
+import OHHTTPStubs
+#if SWIFT_PACKAGE
+@testable import CoreAPI
+import OHHTTPStubsSwift
+#else
+@testable import WordPressKit
+#endif
+
+class HTTPResponseCacheTests: XCTestCase {
+
+    override func tearDown() {
+        super.tearDown()
+        HTTPStubs.removeAllStubs()
+    }
+
+    func testNotModifiedResponseReturnsCachedBody() async throws {
+        var requests = [URLRequest]()
+        stub(condition: isHost("public-api.wordpress.com")) { request in
+            requests.append(request)
+            if request.value(forHTTPHeaderField: "If-None-Match") == "\"v1\"" {
+                return HTTPStubsResponse(data: Data(), statusCode: 304, headers: nil)
+            }
+            return HTTPStubsResponse(jsonObject: ["foo": "bar"], statusCode: 200, headers: ["ETag": "\"v1\""])
+        }
+
+        let api = WordPressComRestApi()
+        api.responseCache = HTTPResponseCache { _ in true }
+
+        let first = try await api.perform(.get, URLString: "/rest/v1/foo").get()
+        let second = try await api.perform(.get, URLString: "/rest/v1/foo").get()
+
+        XCTAssertEqual(requests.count, 2)
+        XCTAssertNil(requests[0].value(forHTTPHeaderField: "If-None-Match"))
+        XCTAssertEqual(requests[1].value(forHTTPHeaderField: "If-None-Match"), "\"v1\"")
+        XCTAssertEqual(second.response.statusCode, 200)
+        XCTAssertEqual((second.body as? [String: String])?["foo"], "bar")
+        // The decoded response is reused.
+        XCTAssertTrue(first.body === second.body)
+    }
+
+    func testRequestsThatAreNotOptedInAreNotCached() async throws {
+        var requests = [URLRequest]()
+        stub(condition: isHost("public-api.wordpress.com")) { request in
+            requests.append(request)
+            return HTTPStubsResponse(jsonObject: ["foo": "bar"], statusCode: 200, headers: ["ETag": "\"v1\""])
+        }
+
+        let api = WordPressComRestApi()
+        api.responseCache = HTTPResponseCache { $0.url?.path == "/rest/v1/cached" }
+
+        _ = try await api.perform(.get, URLString: "/rest/v1/foo").get()
+        _ = try await api.perform(.get, URLString: "/rest/v1/foo").get()
+
+        XCTAssertEqual(requests.count, 2)
+        XCTAssertNil(requests[1].value(forHTTPHeaderField: "If-None-Match"))
+    }
+
+    func testLeastRecentlyUsedResponseIsEvicted() async throws {
+        var requests = [URLRequest]()
+        stub(condition: isHost("public-api.wordpress.com")) { request in
+            requests.append(request)
+            if request.value(forHTTPHeaderField: "If-None-Match") != nil {
+                return HTTPStubsResponse(data: Data(), statusCode: 304, headers: nil)
+            }
+            return HTTPStubsResponse(data: Data(#"{"foo":"bar"}"#.utf8), statusCode: 200, headers: ["ETag": "\"v1\""])
+        }
+
+        let api = WordPressComRestApi()
+        api.appendsPreferredLanguageLocale = false
+        // Room for two of the 13 bytes responses.
+        api.responseCache = HTTPResponseCache(memoryCapacity: 30) { _ in true }
+
+        _ = try await api.perform(.get, URLString: "/rest/v1/a").get()
+        _ = try await api.perform(.get, URLString: "/rest/v1/b").get()
+        _ = try await api.perform(.get, URLString: "/rest/v1/a").get()
+        // "b" is the least recently used response, so it's evicted.
+        _ = try await api.perform(.get, URLString: "/rest/v1/c").get()
+
+        _ = try await api.perform(.get, URLString: "/rest/v1/a").get()
+        _ = try await api.perform(.get, URLString: "/rest/v1/b").get()
+
+        XCTAssertEqual(requests.count, 6)
+        XCTAssertEqual(requests[4].value(forHTTPHeaderField: "If-None-Match"), "\"v1\"")
+        XCTAssertNil(requests[5].value(forHTTPHeaderField: "If-None-Match"))
+    }
+
+    func testDecodedResponsesCountAgainstMemoryCapacity() async throws {
+        var requests = [URLRequest]()
+        stub(condition: isHost("public-api.wordpress.com")) { request in
+            requests.append(request)
+            if request.value(forHTTPHeaderField: "If-None-Match") != nil {
+                return HTTPStubsResponse(data: Data(), statusCode: 304, headers: nil)
+            }
+            return HTTPStubsResponse(data: Data(#"{"foo":"bar"}"#.utf8), statusCode: 200, headers: ["ETag": "\"v1\""])
+        }
+
+        let api = WordPressComRestApi()
+        api.appendsPreferredLanguageLocale = false
+        // Room for seven of the 13 bytes responses, but only for two of them along with their decoded values.
+        api.responseCache = HTTPResponseCache(memoryCapacity: 100) { _ in true }
+
+        _ = try await api.perform(.get, URLString: "/rest/v1/a").get()
+        _ = try await api.perform(.get, URLString: "/rest/v1/b").get()
+        // "a" is evicted to make room for "c" and its decoded value.
+        _ = try await api.perform(.get, URLString: "/rest/v1/c").get()
+
+        _ = try await api.perform(.get, URLString: "/rest/v1/c").get()
+        _ = try await api.perform(.get, URLString: "/rest/v1/a").get()
+
+        XCTAssertEqual(requests.count, 5)
+        XCTAssertEqual(requests[3].value(forHTTPHeaderField: "If-None-Match"), "\"v1\"")
+        XCTAssertNil(requests[4].value(forHTTPHeaderField: "If-None-Match"))
+    }
+
+    func testDiskCache() async throws {
+        let directory = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: directory) }
+
+        var requests = [URLRequest]()
+        stub(condition: isHost("public-api.wordpress.com")) { request in
+            requests.append(request)
+            if request.value(forHTTPHeaderField: "If-Modified-Since") != nil {
+                return HTTPStubsResponse(data: Data(), statusCode: 304, headers: nil)
+            }
+            return HTTPStubsResponse(jsonObject: ["foo": "bar"], statusCode: 200, headers: ["Last-Modified": "Wed, 21 Oct 2015 07:28:00 GMT"])
+        }
+
+        let api = WordPressComRestApi()
+        api.responseCache = HTTPResponseCache(memoryCapacity: 0, directory: directory) { _ in true }
+        _ = try await api.perform(.get, URLString: "/rest/v1/foo").get()
+
+        // Use a new cache instance, which only has the response on disk.
+        api.responseCache = HTTPResponseCache(memoryCapacity: 0, directory: directory) { _ in true }
+        let response = try await api.perform(.get, URLString: "/rest/v1/foo").get()
+
+        XCTAssertEqual(requests.last?.value(forHTTPHeaderField: "If-Modified-Since"), "Wed, 21 Oct 2015 07:28:00 GMT")
+        XCTAssertEqual((response.body as? [String: String])?["foo"], "bar")
+    }
+
+    func testCredentialHeadersAreNotCached() async throws {
+        let directory = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: directory) }
+
+        stub(condition: isHost("public-api.wordpress.com")) { request in
+            if request.value(forHTTPHeaderField: "If-None-Match") != nil {
+                return HTTPStubsResponse(data: Data(), statusCode: 304, headers: nil)
+            }
+            return HTTPStubsResponse(jsonObject: ["foo": "bar"], statusCode: 200, headers: ["ETag": "\"v1\"", "Set-Cookie": "session=secret"])
+        }
+
+        let api = WordPressComRestApi()
+        api.responseCache = HTTPResponseCache(memoryCapacity: 0, directory: directory) { _ in true }
+        _ = try await api.perform(.get, URLString: "/rest/v1/foo").get()
+
+        api.responseCache = HTTPResponseCache(memoryCapacity: 0, directory: directory) { _ in true }
+        let response = try await api.perform(.get, URLString: "/rest/v1/foo").get()
+
+        XCTAssertEqual(response.response.value(forHTTPHeaderField: "ETag"), "\"v1\"")
+        XCTAssertNil(response.response.value(forHTTPHeaderField: "Set-Cookie"))
+        let files = try FileManager.default.contentsOfDirectory(at: directory, includingPropertiesForKeys: nil)
+        XCTAssertEqual(files.count, 1)
+        XCTAssertNil(try Data(contentsOf: files[0]).range(of: Data("secret".utf8)))
+    }
+
+    func testLeastRecentlyUsedFileIsRemovedFromDisk() async throws {
+        let directory = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: directory) }
+
+        var requests = [URLRequest]()
+        stub(condition: isHost("public-api.wordpress.com")) { request in
+            requests.append(request)
+            if request.value(forHTTPHeaderField: "If-None-Match") != nil {
+                return HTTPStubsResponse(data: Data(), statusCode: 304, headers: nil)
+            }
+            return HTTPStubsResponse(jsonObject: ["foo": String(repeating: "a", count: 1_000)], statusCode: 200, headers: ["ETag": "\"v1\""])
+        }
+
+        let api = WordPressComRestApi()
+        api.appendsPreferredLanguageLocale = false
+        // Room for one of the files, whose bodies are about 1000 bytes.
+        let makeCache = { HTTPResponseCache(memoryCapacity: 0, directory: directory, diskCapacity: 1_800) { _ in true } }
+        api.responseCache = makeCache()
+        _ = try await api.perform(.get, URLString: "/rest/v1/a").get()
+        _ = try await api.perform(.get, URLString: "/rest/v1/b").get()
+
+        // Use a new cache instance, which only has the responses on disk. "a" is removed when "b" is saved.
+        api.responseCache = makeCache()
+        _ = try await api.perform(.get, URLString: "/rest/v1/b").get()
+        _ = try await api.perform(.get, URLString: "/rest/v1/a").get()
+
+        XCTAssertEqual(requests.count, 4)
+        XCTAssertEqual(requests[2].value(forHTTPHeaderField: "If-None-Match"), "\"v1\"")
+        XCTAssertNil(requests[3].value(forHTTPHeaderField: "If-None-Match"))
+    }
+
+}
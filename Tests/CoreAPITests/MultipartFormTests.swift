@@ -97,6 +97,133 @@ class MutliparFormDataTests: XCTestCase {
         XCTAssertEqual(afEncoded, formData)
     }
 
+    func testInputStreamMatchesMaterializedForm() throws {
+        let tempDir = FileManager.default.temporaryDirectory
+        let filePath = tempDir.appendingPathComponent("stream.png")
+        try Data(repeating: Character("a").asciiValue!, count: 100_000).write(to: filePath)
+        defer {
+            try? FileManager.default.removeItem(at: filePath)
+        }
+
+        let fields = [
+            MultipartFormField(text: "123456", name: "site"),
+            try MultipartFormField(fileAtPath: filePath.path, name: "media", filename: "file.png", mimeType: "image/png"),
+            MultipartFormField(text: "the", name: "end"),
+        ]
+        let stream = fields.multipartFormInputStream(boundary: "testboundary")
+        let streamed = stream.readToEnd()
+        let materialized = try fields.multipartFormDataStream(boundary: "testboundary").readToEnd()
+
+        XCTAssertEqual(streamed, materialized)
+        XCTAssertEqual(stream.contentLength, UInt64(streamed.count))
+
+        // Field content is opened lazily, so the same form can be streamed again.
+        XCTAssertEqual(fields.multipartFormInputStream(boundary: "testboundary").readToEnd(), streamed)
+    }
+
+    func testInputStreamHashesFileContent() throws {
+        let filePath = FileManager.default.temporaryDirectory.appendingPathComponent("hashed.png")
+        let content = Data((0..<200_000).map { UInt8(truncatingIfNeeded: $0 * 31) })
+        try content.write(to: filePath)
+        defer {
+            try? FileManager.default.removeItem(at: filePath)
+        }
+
+        var contentHashes = [String]()
+        let fields = [
+            MultipartFormField(text: "123456", name: "site"),
+            try MultipartFormField(fileAtPath: filePath.path, name: "media", filename: "file.png", mimeType: "image/png") {
+                contentHashes.append($0)
+            },
+        ]
+        _ = fields.multipartFormInputStream(boundary: "testboundary").readToEnd()
+
+        // The hash is only of the file's content, not of the form.
+        XCTAssertEqual(contentHashes, [SHA256.hash(data: content).map { String(format: "%02x", $0) }.joined()])
+    }
+
+    func testBoundInputStreamMatchesMaterializedForm() throws {
+        let filePath = FileManager.default.temporaryDirectory.appendingPathComponent("bound-stream.png")
+        try Data(repeating: Character("a").asciiValue!, count: 300_000).write(to: filePath)
+        defer {
+            try? FileManager.default.removeItem(at: filePath)
+        }
+
+        let fields = [
+            MultipartFormField(text: "123456", name: "site"),
+            try MultipartFormField(fileAtPath: filePath.path, name: "media", filename: "file.png", mimeType: "image/png"),
+        ]
+        let stream = fields.multipartFormInputStream(boundary: "testboundary").boundInputStream()
+
+        // The bound stream is filled from another thread, so it's read until it ends rather than while it has bytes.
+        stream.open()
+        defer { stream.close() }
+        var streamed = Data()
+        var buffer = [UInt8](repeating: 0, count: 4096)
+        while true {
+            let bytes = stream.read(&buffer, maxLength: buffer.count)
+            XCTAssertGreaterThanOrEqual(bytes, 0)
+            if bytes <= 0 {
+                break
+            }
+            streamed.append(buffer, count: bytes)
+        }
+
+        XCTAssertEqual(streamed, try fields.multipartFormDataStream(boundary: "testboundary").readToEnd())
+    }
+
+    func testStoppedBodyStreamProviderEndsItsStreams() throws {
+        let filePath = FileManager.default.temporaryDirectory.appendingPathComponent("stopped-bound-stream.png")
+        try Data(repeating: Character("a").asciiValue!, count: 1_000_000).write(to: filePath)
+        defer {
+            try? FileManager.default.removeItem(at: filePath)
+        }
+
+        let fields = [try MultipartFormField(fileAtPath: filePath.path, name: "media", filename: "file.png", mimeType: "image/png")]
+        let provider = HTTPBodyStreamProvider { fields.multipartFormInputStream(boundary: "testboundary") }
+        let stream = try XCTUnwrap(provider.makeStream())
+
+        stream.open()
+        defer { stream.close() }
+        var buffer = [UInt8](repeating: 0, count: 4096)
+        var total = stream.read(&buffer, maxLength: buffer.count)
+        XCTAssertGreaterThan(total, 0)
+
+        // The writer stops while the pair's buffer is full, so the stream ends before the whole form is read.
+        provider.stop()
+        while true {
+            let bytes = stream.read(&buffer, maxLength: buffer.count)
+            XCTAssertGreaterThanOrEqual(bytes, 0)
+            if bytes <= 0 {
+                break
+            }
+            total += bytes
+        }
+
+        XCTAssertLessThan(UInt64(total), fields.multipartFormInputStream(boundary: "testboundary").contentLength)
+        XCTAssertNil(provider.makeStream())
+    }
+
+    func testBodyStreamProviderReportsUnreadableForm() throws {
+        let filePath = FileManager.default.temporaryDirectory.appendingPathComponent("unreadable-bound-stream.png")
+        try Data(repeating: Character("a").asciiValue!, count: 1_000).write(to: filePath)
+        let fields = [try MultipartFormField(fileAtPath: filePath.path, name: "media", filename: "file.png", mimeType: "image/png")]
+        try FileManager.default.removeItem(at: filePath)
+
+        let provider = HTTPBodyStreamProvider { fields.multipartFormInputStream(boundary: "testboundary") }
+        let failed = expectation(description: "The form can't be read")
+        provider.setOnFailure { _ in failed.fulfill() }
+        let stream = try XCTUnwrap(provider.makeStream())
+        stream.open()
+        defer {
+            stream.close()
+            provider.stop()
+        }
+
+        wait(for: [failed], timeout: 2)
+        XCTAssertNotNil(provider.error)
+    }
+
     func testUploadSmallFile() throws {
         let tempDir = FileManager.default.temporaryDirectory
         let fileContent = Data(repeating: Character("a").asciiValue!, count: 20_000_000)
@@ -0,0 +1,108 @@
+import Foundation
+import XCTest
+import OHHTTPStubs
+#if SWIFT_PACKAGE
+@testable import CoreAPI
+import OHHTTPStubsSwift
+#else
+@testable import WordPressKit
+#endif
+
+class RequestPhaseTimerTests: XCTestCase {
+
+    override func tearDown() {
+        super.tearDown()
+        HTTPStubs.removeAllStubs()
+        RequestPhaseTimer.handler = nil
+    }
+
+    func testDisabledTimer() {
+        var evaluated = false
+        let result = RequestPhaseTimer.measure(.decode, endpoint: { evaluated = true; return "GET /" }(), size: { (_: Int) in 0 }) {
+            42
+        }
+
+        XCTAssertEqual(result, 42)
+        XCTAssertFalse(evaluated)
+        XCTAssertNil(RequestPhaseTimer.start())
+    }
+
+    func testMeasuringMapping() throws {
+        let records = Records()
+        RequestPhaseTimer.handler = records.append
+
+        let mapped = RequestPhaseTimer.measureMapping(forEndpoint: "https://public-api.wordpress.com/rest/v1.2/read/sites/123/posts?number=2", count: 2) {
+            ["first", "second"]
+        }
+
+        XCTAssertEqual(mapped as? [String], ["first", "second"])
+        let record = try XCTUnwrap(records.all.first)
+        XCTAssertEqual(record.phase, .mapping)
+        XCTAssertEqual(record.endpoint, "/rest/v1.2/read/sites/:site/posts")
+        XCTAssertEqual(record.size, 2)
+        XCTAssertNotNil(record.cpuTime)
+    }
+
+    func testHandlerChangedWhilePhaseRuns() throws {
+        let first = Records()
+        let second = Records()
+        RequestPhaseTimer.handler = first.append
+
+        _ = RequestPhaseTimer.measure(.decode, endpoint: "GET /", size: { (_: Int) in 0 }) {
+            RequestPhaseTimer.handler = second.append
+            return 0
+        }
+
+        XCTAssertEqual(first.all.map(\.phase), [.decode])
+        XCTAssertTrue(second.all.isEmpty)
+    }
+
+    func testTimingWordPressComRequest() throws {
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            HTTPStubsResponse(jsonObject: ["ID": 45, "title": "Hello"], statusCode: 200, headers: nil)
+        }
+
+        let records = Records()
+        RequestPhaseTimer.handler = records.append
+
+        let completed = expectation(description: "The request completes")
+        WordPressComRestApi().POST(
+            "/rest/v1.1/sites/123/posts/45",
+            parameters: ["title": "Hello" as AnyObject],
+            success: { _, _ in completed.fulfill() },
+            failure: { error, _ in
+                XCTFail("Unexpected error: \(error)")
+                completed.fulfill()
+            }
+        )
+        wait(for: [completed], timeout: 1)
+
+        let phases = records.all.filter { $0.endpoint == "POST /rest/v1.1/sites/:site/posts/:id" }.map(\.phase)
+        XCTAssertEqual(phases, [.build, .encode, .network, .decode])
+
+        let network = try XCTUnwrap(records.all.first { $0.phase == .network })
+        XCTAssertGreaterThan(network.size, 0)
+        XCTAssertNil(network.cpuTime)
+
+        let build = try XCTUnwrap(records.all.first { $0.phase == .build })
+        XCTAssertGreaterThan(build.size, 0)
+    }
+
+}
+
+private final class Records {
+    private let lock = NSLock()
+    private var records = [RequestPhaseTimer.Record]()
+
+    var all: [RequestPhaseTimer.Record] {
+        lock.lock()
+        defer { lock.unlock() }
+        return records
+    }
+
+    func append(_ record: RequestPhaseTimer.Record) {
+        lock.lock()
+        records.append(record)
+        lock.unlock()
+    }
+}
@@ -0,0 +1,128 @@
+import Foundation
+import XCTest
+import OHHTTPStubs
+import WordPressShared
+#if SWIFT_PACKAGE
+import APIInterface
+@testable import CoreAPI
+import OHHTTPStubsSwift
+#else
+@testable import WordPressKit
+#endif
+
+class WordPressComEndpointTests: XCTestCase {
+
+    override func tearDown() {
+        super.tearDown()
+        HTTPStubs.removeAllStubs()
+    }
+
+    func testPath() {
+        let endpoint = WordPressComEndpoint<TwoPathParameters>("sites/:site/posts/:post", version: ._1_1)
+
+        XCTAssertEqual(endpoint.parameterNames, ["site", "post"])
+        XCTAssertEqual(endpoint.path(1, 2).percentEncodedPath, "rest/v1.1/sites/1/posts/2")
+        XCTAssertEqual(endpoint.path(NSNumber(value: 1), Int64(2)).percentEncodedPath, "rest/v1.1/sites/1/posts/2")
+        XCTAssertEqual(endpoint.path(1, 2).query, [])
+    }
+
+    func testPathVersions() {
+        XCTAssertEqual(WordPressComEndpoint<NoPathParameters>("me", version: ._1_2).path().percentEncodedPath, "rest/v1.2/me")
+        XCTAssertEqual(WordPressComEndpoint<NoPathParameters>("me", version: ._2_0).path().percentEncodedPath, "wpcom/v2/me")
+    }
+
+    func testPercentEncodingStringParameter() {
+        let endpoint = WordPressComEndpoint<TwoPathParameters>("sites/:site/taxonomies/:taxonomy", version: ._1_1)
+
+        XCTAssertEqual(endpoint.path("example.com", "a/b c").percentEncodedPath, "rest/v1.1/sites/example.com/taxonomies/a%2Fb%20c")
+    }
+
+    func testQuery() {
+        let endpoint = WordPressComEndpoint<TwoPathParameters>("sites/:site/posts/:post?context=edit", version: ._1_1)
+
+        XCTAssertEqual(endpoint.parameterNames, ["site", "post"])
+        XCTAssertEqual(endpoint.path(1, 2).percentEncodedPath, "rest/v1.1/sites/1/posts/2")
+        XCTAssertEqual(endpoint.path(1, 2).query, [URLQueryItem(name: "context", value: "edit")])
+    }
+
+    func testTrailingSlash() {
+        let endpoint = WordPressComEndpoint<TwoPathParameters>("read/sites/:site/posts/:post/?meta=site", version: ._1_2)
+
+        XCTAssertEqual(endpoint.parameterNames, ["site", "post"])
+        XCTAssertEqual(endpoint.path(1, 2).percentEncodedPath, "rest/v1.2/read/sites/1/posts/2/")
+        XCTAssertEqual(endpoint.path(1, 2).query, [URLQueryItem(name: "meta", value: "site")])
+    }
+
+    func testRequestURL() async throws {
+        var request: URLRequest?
+        stub(condition: isHost("public-api.wordpress.com")) {
+            request = $0
+            return HTTPStubsResponse(jsonObject: [String: String](), statusCode: 200, headers: nil)
+        }
+
+        let endpoint = WordPressComEndpoint<TwoPathParameters>("sites/:site/posts/:post?context=edit", version: ._1_1)
+        let api = WordPressComRestApi()
+        _ = try await api.perform(.get, path: endpoint.path(1, 2), parameters: ["fields": "ID" as AnyObject]).get()
+
+        let locale = WordPressComLanguageDatabase().deviceLanguage.slug
+        let url = try XCTUnwrap(request?.url)
+        let components = try XCTUnwrap(URLComponents(url: url, resolvingAgainstBaseURL: false))
+        XCTAssertEqual(components.path, "/rest/v1.1/sites/1/posts/2")
+        XCTAssertEqual(
+            Set(components.queryItems ?? []),
+            [URLQueryItem(name: "context", value: "edit"), URLQueryItem(name: "fields", value: "ID"), URLQueryItem(name: "locale", value: locale)]
+        )
+    }
+
+    func testRequestURLMatchesURLString() throws {
+        let api = WordPressComRestApi()
+        let endpoint = WordPressComEndpoint<TwoPathParameters>("sites/:site/posts/:post?context=edit", version: ._1_2)
+        let urlString = WordPressComRESTAPIVersionedPathBuilder.path(forEndpoint: "sites/1/posts/2?context=edit", withVersion: ._1_2)
+
+        XCTAssertEqual(
+            try api.requestBuilder(path: endpoint.path(1, 2)).build().url,
+            try api.requestBuilder(URLString: urlString).build().url
+        )
+    }
+
+    func testRequestURLWithoutLocale() async throws {
+        var request: URLRequest?
+        stub(condition: isHost("public-api.wordpress.com")) {
+            request = $0
+            return HTTPStubsResponse(jsonObject: [String: String](), statusCode: 200, headers: nil)
+        }
+
+        let api = WordPressComRestApi()
+        api.appendsPreferredLanguageLocale = false
+        _ = try await api.perform(.get, path: WordPressComEndpoint<NoPathParameters>("me", version: ._1_1).path()).get()
+
+        XCTAssertEqual(request?.url?.absoluteString, "https://public-api.wordpress.com/rest/v1.1/me")
+    }
+
+    func testEncodableBody() async throws {
+        struct Body: Encodable {
+            var title: String
+            var date: Date
+        }
+
+        var request: URLRequest?
+        stub(condition: isHost("public-api.wordpress.com")) {
+            request = $0
+            return HTTPStubsResponse(jsonObject: [String: String](), statusCode: 200, headers: nil)
+        }
+
+        let encoder = JSONEncoder()
+        encoder.dateEncodingStrategy = .secondsSince1970
+        let api = WordPressComRestApi()
+        api.appendsPreferredLanguageLocale = false
+        let body = Body(title: "Hello", date: Date(timeIntervalSince1970: 1))
+        _ = try await api.perform(.post, path: WordPressComEndpoint<OnePathParameter>("sites/:site/posts/new", version: ._1_2).path(1), body: body, jsonEncoder: encoder).get()
+
+        XCTAssertEqual(request?.url?.absoluteString, "https://public-api.wordpress.com/rest/v1.2/sites/1/posts/new")
+        XCTAssertEqual(request?.value(forHTTPHeaderField: "Content-Type"), "application/json")
+        let json = try XCTUnwrap(request?.httpBodyText.flatMap { try JSONSerialization.jsonObject(with: Data($0.utf8)) as? [String: Any] })
+        XCTAssertEqual(json["title"] as? String, "Hello")
+        XCTAssertEqual(json["date"] as? Int, 1)
+    }
+
+}
@@ -0,0 +1,188 @@
+import XCTest
+import OHHTTPStubs
+#if SWIFT_PACKAGE
+@testable import CoreAPI
+import OHHTTPStubsSwift
+#else
+@testable import WordPressKit
+#endif
+
+extension WordPressComRestApiTests {
+
+    func testBatchURL() {
+        XCTAssertEqual(WordPressComRestApi.batchURL(path: "rest/v1.1/sites/1", parameters: nil)?.version, "rest/v1.1")
+        XCTAssertEqual(WordPressComRestApi.batchURL(path: "rest/v1.1/sites/1", parameters: nil)?.url, "/sites/1")
+        XCTAssertEqual(WordPressComRestApi.batchURL(path: "/rest/v1/me", parameters: nil)?.version, "rest/v1")
+        XCTAssertEqual(
+            WordPressComRestApi.batchURL(path: "rest/v1.2/sites/1/stats", parameters: ["max": 10 as AnyObject])?.url,
+            "/sites/1/stats?max=10"
+        )
+        XCTAssertNil(WordPressComRestApi.batchURL(path: "wpcom/v2/sites/1/blogging-prompts", parameters: nil))
+    }
+
+    func testBatchURLIncludesTheLocale() {
+        let locale = URLQueryItem(name: "locale", value: "fr")
+        XCTAssertEqual(WordPressComRestApi.batchURL(path: "rest/v1.1/sites/1", parameters: nil, locale: locale)?.url, "/sites/1?locale=fr")
+        XCTAssertEqual(
+            WordPressComRestApi.batchURL(path: "rest/v1.1/sites/1", parameters: ["locale": "de" as AnyObject], locale: locale)?.url,
+            "/sites/1?locale=de"
+        )
+    }
+
+    func testBatchRequestsAreLocalized() async throws {
+        var requests = [URLRequest]()
+        stub(condition: isHost("public-api.wordpress.com")) { request in
+            requests.append(request)
+            return HTTPStubsResponse(jsonObject: [String: Any](), statusCode: 200, headers: nil)
+        }
+
+        let api = WordPressComRestApi(oAuthToken: "fakeToken")
+        _ = await api.batchGET([
+            (path: "rest/v1.1/sites/1", parameters: nil),
+            (path: "rest/v1.1/sites/1/settings", parameters: nil),
+        ])
+
+        let components = try XCTUnwrap(requests.first?.url.flatMap { URLComponents(url: $0, resolvingAgainstBaseURL: false) })
+        let urls = components.queryItems?.filter { $0.name == "urls[]" }.compactMap { $0.value } ?? []
+        XCTAssertEqual(urls.count, 2)
+        XCTAssertTrue(urls.allSatisfy { $0.contains("\(WordPressComRestApi.LocaleKeyDefault)=") }, "Unexpected URLs: \(urls)")
+    }
+
+    func testBatchResponsesHaveTheirOwnStatusCode() async throws {
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            HTTPStubsResponse(
+                jsonObject: [
+                    "/sites/1": ["ID": 1],
+                    "/sites/1/settings": ["error": "unknown_blog", "message": "Unknown blog", "status_code": 404],
+                ],
+                statusCode: 200,
+                headers: nil
+            )
+        }
+
+        let api = WordPressComRestApi(oAuthToken: "fakeToken")
+        api.appendsPreferredLanguageLocale = false
+        let results = await api.batchGET([
+            (path: "rest/v1.1/sites/1", parameters: nil),
+            (path: "rest/v1.1/sites/1/settings", parameters: nil),
+        ])
+
+        let response = try results[0].get().response
+        XCTAssertEqual(response.statusCode, 200)
+        XCTAssertEqual(response.url?.path, "/rest/v1.1/sites/1")
+
+        guard case let .failure(error) = results[1] else {
+            return XCTFail("Unexpected result: \(results[1])")
+        }
+        XCTAssertEqual(error.response?.statusCode, 404)
+        XCTAssertEqual(error.response?.url?.path, "/rest/v1.1/sites/1/settings")
+    }
+
+    func testCancellingTheBatchProgressCancelsTheRequests() {
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            HTTPStubsResponse(jsonObject: ["/sites/1": ["ID": 1], "/sites/2": ["ID": 2]], statusCode: 200, headers: nil)
+                .responseTime(0.5)
+        }
+
+        let cancelled = expectation(description: "The requests are cancelled")
+        cancelled.expectedFulfillmentCount = 2
+        let request = { (path: String) in
+            WordPressComRestApiBatchRequest(
+                path: path,
+                parameters: nil,
+                success: { _, _ in XCTFail("The request should be cancelled") },
+                failure: { error, _ in
+                    XCTAssertEqual(error.domain, NSURLErrorDomain)
+                    XCTAssertEqual(error.code, NSURLErrorCancelled)
+                    cancelled.fulfill()
+                }
+            )
+        }
+
+        let api = WordPressComRestApi(oAuthToken: "fakeToken")
+        let progress = api.GET(batch: [request("rest/v1.1/sites/1"), request("rest/v1.1/sites/2")])
+        DispatchQueue.main.asyncAfter(deadline: .now() + 0.1) {
+            progress?.cancel()
+        }
+
+        wait(for: [cancelled], timeout: 2)
+    }
+
+    func testBatchRequestsAreSentInOneRequest() async throws {
+        var requests = [URLRequest]()
+        stub(condition: isHost("public-api.wordpress.com")) { request in
+            requests.append(request)
+            return HTTPStubsResponse(
+                jsonObject: [
+                    "/sites/1": ["ID": 1],
+                    "/sites/1/settings": ["error": "unauthorized", "message": "User cannot access this private blog.", "status_code": 403],
+                ],
+                statusCode: 200,
+                headers: nil
+            )
+        }
+
+        let api = WordPressComRestApi(oAuthToken: "fakeToken")
+        api.appendsPreferredLanguageLocale = false
+        let results = await api.batchGET([
+            (path: "rest/v1.1/sites/1", parameters: nil),
+            (path: "rest/v1.1/sites/1/settings", parameters: nil),
+        ])
+
+        XCTAssertEqual(requests.count, 1)
+        let components = try XCTUnwrap(requests.first?.url.flatMap { URLComponents(url: $0, resolvingAgainstBaseURL: false) })
+        XCTAssertEqual(components.path, "/rest/v1.1/batch")
+        XCTAssertEqual(components.queryItems?.filter { $0.name == "urls[]" }.map { $0.value }, ["/sites/1", "/sites/1/settings"])
+
+        XCTAssertEqual((try results[0].get().body as? [String: Int])?["ID"], 1)
+        if case let .failure(.endpointError(error)) = results[1] {
+            XCTAssertEqual(error.code, .authorizationRequired)
+        } else {
+            XCTFail("Unexpected result: \(results[1])")
+        }
+    }
+
+    func testBatchResponseWithEmptyErrorsIsSuccessful() async throws {
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            HTTPStubsResponse(
+                jsonObject: [
+                    "/sites/1/posts": ["found": 0, "posts": [], "errors": []],
+                    "/sites/1/settings": ["errors": [["error": "unauthorized", "message": "User cannot access this private blog."]]],
+                ],
+                statusCode: 200,
+                headers: nil
+            )
+        }
+
+        let api = WordPressComRestApi(oAuthToken: "fakeToken")
+        api.appendsPreferredLanguageLocale = false
+        let results = await api.batchGET([
+            (path: "rest/v1.1/sites/1/posts", parameters: nil),
+            (path: "rest/v1.1/sites/1/settings", parameters: nil),
+        ])
+
+        XCTAssertEqual((try results[0].get().body as? [String: AnyObject])?["found"] as? Int, 0)
+        if case .success = results[1] {
+            XCTFail("Unexpected result: \(results[1])")
+        }
+    }
+
+    func testUnsupportedBatchRequestsAreSentIndividually() async {
+        var requests = [URLRequest]()
+        stub(condition: isHost("public-api.wordpress.com")) { request in
+            requests.append(request)
+            return HTTPStubsResponse(jsonObject: ["foo": "bar"], statusCode: 200, headers: nil)
+        }
+
+        let api = WordPressComRestApi(oAuthToken: "fakeToken")
+        let results = await api.batchGET([
+            (path: "rest/v1.1/sites/1", parameters: nil),
+            (path: "wpcom/v2/sites/1/blogging-prompts", parameters: nil),
+        ])
+
+        XCTAssertEqual(requests.count, 2)
+        XCTAssertFalse(requests.contains { $0.url?.path.hasSuffix("/batch") == true })
+        XCTAssertEqual(results.count, 2)
+    }
+
+}
@@ -533,4 +533,91 @@ class WordPressComRestApiTests: XCTestCase {
         XCTAssertEqual(request.value(forHTTPHeaderField: "Content-Type"), "application/json")
         XCTAssertEqual(request.httpBodyText, #"{"arg1":"value1"}"#)
     }
+
+    func testCoalescesInFlightGETRequests() async {
+        let requests = RequestCounter()
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            requests.increment()
+            return HTTPStubsResponse(jsonObject: ["foo": "bar"], statusCode: 200, headers: nil)
+                .responseTime(0.1)
+        }
+
+        let api = WordPressComRestApi()
+        api.coalescesInFlightGETRequests = true
+
+        async let first = api.perform(.get, URLString: "/rest/v1/foo")
+        async let second = api.perform(.get, URLString: "/rest/v1/foo")
+        let results = await [first, second]
+
+        XCTAssertEqual(requests.count, 1)
+        XCTAssertEqual(api.inFlightRequestStatistics.performed, 1)
+        XCTAssertEqual(api.inFlightRequestStatistics.coalesced, 1)
+        for result in results {
+            XCTAssertEqual((try? result.get().body as? [String: String])?["foo"], "bar")
+        }
+    }
+
+    func testCoalescedRequestsDecodeWithTheirOwnDecoders() async throws {
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            HTTPStubsResponse(jsonObject: ["foo": "bar"], statusCode: 200, headers: nil)
+                .responseTime(0.1)
+        }
+
+        let api = WordPressComRestApi()
+        api.coalescesInFlightGETRequests = true
+
+        async let first = api.perform(.get, URLString: "/rest/v1/foo", jsonDecoder: JSONDecoder(), type: [String: String].self)
+        async let second = api.perform(.get, URLString: "/rest/v1/foo", jsonDecoder: JSONDecoder(), type: [String: String].self)
+        let results = await [first, second]
+
+        XCTAssertEqual(api.inFlightRequestStatistics.performed, 1)
+        XCTAssertEqual(api.inFlightRequestStatistics.coalesced, 1)
+        for result in results {
+            XCTAssertEqual(try result.get().body["foo"], "bar")
+        }
+    }
+
+    func testCancelingCoalescedRequestDoesNotCancelOthers() async {
+        stub(condition: isHost("public-api.wordpress.com")) { _ in
+            HTTPStubsResponse(jsonObject: ["foo": "bar"], statusCode: 200, headers: nil)
+                .responseTime(0.1)
+        }
+
+        let api = WordPressComRestApi()
+        api.coalescesInFlightGETRequests = true
+
+        let progress = Progress.discreteProgress(totalUnitCount: 100)
+        async let cancelled = api.perform(.get, URLString: "/rest/v1/foo", fulfilling: progress)
+        async let completed = api.perform(.get, URLString: "/rest/v1/foo")
+        try? await Task.sleep(nanoseconds: 10_000_000)
+        progress.cancel()
+
+        let cancelledResult = await cancelled
+        if case let .failure(.connection(error)) = cancelledResult {
+            XCTAssertEqual(error.code, .cancelled)
+        } else {
+            XCTFail("Unexpected result: \(cancelledResult)")
+        }
+
+        let completedResult = await completed
+        XCTAssertNoThrow(try completedResult.get())
+    }
+}
+
+/// Counts the requests that the stubs receive, on the URL loading system's threads.
+private final class RequestCounter {
+    private let lock = NSLock()
+    private var _count = 0
+
+    var count: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return _count
+    }
+
+    func increment() {
+        lock.lock()
+        _count += 1
+        lock.unlock()
+    }
 }
@@ -0,0 +1,283 @@
+import XCTest
+import OHHTTPStubs
+import wpxmlrpc
+#if SWIFT_PACKAGE
+@testable import CoreAPI
+import OHHTTPStubsSwift
+#else
+@testable import WordPressKit
+#endif
+
+class WordPressOrgXMLRPCApiMulticallTests: XCTestCase {
+
+    let xmlrpcEndpoint = URL(string: "http://wordpress.org/xmlrpc.php")!
+    let xmlContentTypeHeaders: [String: Any] = ["Content-Type": "application/xml"]
+
+    override func tearDown() {
+        super.tearDown()
+        HTTPStubs.removeAllStubs()
+    }
+
+    func testMulticallResults() async throws {
+        var methods = [String]()
+        stub(condition: isHost("wordpress.org")) { request in
+            methods.append(Self.methodName(of: request) ?? "")
+            return HTTPStubsResponse(data: Self.multicallResponse, statusCode: 200, headers: self.xmlContentTypeHeaders)
+        }
+
+        let api = WordPressOrgXMLRPCApi(endpoint: xmlrpcEndpoint)
+        let results = await api.multicall([
+            (method: "wp.getOptions", parameters: nil),
+            (method: "wp.getPostFormats", parameters: nil),
+        ])
+
+        XCTAssertEqual(methods, ["system.multicall"])
+        XCTAssertEqual(results.count, 2)
+
+        let options = try results[0].get()
+        XCTAssertEqual((options.body as? [String: AnyObject])?["blog_title"] as? String, "My Blog")
+
+        guard case let .failure(.endpointError(fault)) = results[1] else {
+            return XCTFail("The second call should fail: \(results[1])")
+        }
+        XCTAssertEqual(fault.code, 403)
+        XCTAssertEqual(fault.message, "Sorry, you are not allowed to do that.")
+    }
+
+    func testFallbackToSequentialCalls() async throws {
+        var methods = [String]()
+        stub(condition: isHost("wordpress.org")) { request in
+            let method = Self.methodName(of: request) ?? ""
+            methods.append(method)
+            if method == "system.multicall" {
+                return HTTPStubsResponse(data: Self.methodNotFoundResponse, statusCode: 200, headers: self.xmlContentTypeHeaders)
+            }
+            return HTTPStubsResponse(data: Self.stringResponse(method), statusCode: 200, headers: self.xmlContentTypeHeaders)
+        }
+
+        let api = WordPressOrgXMLRPCApi(endpoint: xmlrpcEndpoint)
+        let calls: [(method: String, parameters: [AnyObject]?)] = [
+            (method: "wp.getOptions", parameters: nil),
+            (method: "wp.getPostFormats", parameters: nil),
+        ]
+
+        let results = await api.multicall(calls)
+        XCTAssertEqual(methods, ["system.multicall", "wp.getOptions", "wp.getPostFormats"])
+        XCTAssertEqual(try results.map { try $0.get().body as? String }, ["wp.getOptions", "wp.getPostFormats"])
+        XCTAssertFalse(api.supportsMulticall)
+
+        // Multicall is not attempted again.
+        methods = []
+        _ = await api.multicall(calls)
+        XCTAssertEqual(methods, ["wp.getOptions", "wp.getPostFormats"])
+    }
+
+    func testCancellingSequentialCalls() async throws {
+        let lock = NSLock()
+        var methods = [String]()
+        stub(condition: isHost("wordpress.org")) { request in
+            let method = Self.methodName(of: request) ?? ""
+            lock.lock()
+            methods.append(method)
+            lock.unlock()
+            if method == "system.multicall" {
+                return HTTPStubsResponse(data: Self.methodNotFoundResponse, statusCode: 200, headers: self.xmlContentTypeHeaders)
+            }
+            return HTTPStubsResponse(data: Self.stringResponse(method), statusCode: 200, headers: self.xmlContentTypeHeaders)
+                .responseTime(1)
+        }
+        let sentMethods = {
+            lock.lock()
+            defer { lock.unlock() }
+            return methods
+        }
+
+        let api = WordPressOrgXMLRPCApi(endpoint: xmlrpcEndpoint)
+        let progress = Progress.discreteProgress(totalUnitCount: 100)
+        let results = Task {
+            await api.multicall([
+                (method: "wp.getOptions", parameters: nil),
+                (method: "wp.getPostFormats", parameters: nil),
+            ], fulfilling: progress)
+        }
+
+        // Cancel the calls while the first of the sequential calls is in flight.
+        while !sentMethods().contains("wp.getOptions") {
+            try await Task.sleep(nanoseconds: 10_000_000)
+        }
+        progress.cancel()
+
+        let values = await results.value
+        XCTAssertEqual(sentMethods(), ["system.multicall", "wp.getOptions"])
+        XCTAssertEqual(values.count, 2)
+        for result in values {
+            guard case let .failure(.connection(error)) = result, error.code == .cancelled else {
+                return XCTFail("The call should be cancelled: \(result)")
+            }
+        }
+    }
+
+    func testOtherFaultsFailEveryCall() async throws {
+        var methods = [String]()
+        stub(condition: isHost("wordpress.org")) { request in
+            let method = Self.methodName(of: request) ?? ""
+            methods.append(method)
+            if method == "system.multicall" {
+                return HTTPStubsResponse(data: Self.authenticationFaultResponse, statusCode: 200, headers: self.xmlContentTypeHeaders)
+            }
+            return HTTPStubsResponse(data: Self.stringResponse(method), statusCode: 200, headers: self.xmlContentTypeHeaders)
+        }
+
+        let api = WordPressOrgXMLRPCApi(endpoint: xmlrpcEndpoint)
+        let calls: [(method: String, parameters: [AnyObject]?)] = [
+            (method: "wp.getOptions", parameters: nil),
+            (method: "wp.getPostFormats", parameters: nil),
+        ]
+
+        // The calls aren't repeated, because they'd fail the same way.
+        let results = await api.multicall(calls)
+        XCTAssertEqual(methods, ["system.multicall"])
+        XCTAssertEqual(results.count, 2)
+        for result in results {
+            guard case let .failure(.endpointError(fault)) = result else {
+                return XCTFail("The call should fail with the fault: \(result)")
+            }
+            XCTAssertEqual(fault.code, 403)
+        }
+        XCTAssertTrue(api.supportsMulticall)
+
+        // Multicall is attempted again.
+        methods = []
+        _ = await api.multicall(calls)
+        XCTAssertEqual(methods.first, "system.multicall")
+    }
+
+    func testServerErrorsFailEveryCall() async throws {
+        var methods = [String]()
+        stub(condition: isHost("wordpress.org")) { request in
+            methods.append(Self.methodName(of: request) ?? "")
+            return HTTPStubsResponse(data: Data(), statusCode: 503, headers: self.xmlContentTypeHeaders)
+        }
+
+        let api = WordPressOrgXMLRPCApi(endpoint: xmlrpcEndpoint)
+        let results = await api.multicall([
+            (method: "wp.getOptions", parameters: nil),
+            (method: "wp.getPostFormats", parameters: nil),
+        ])
+
+        XCTAssertEqual(methods, ["system.multicall"])
+        XCTAssertEqual(results.count, 2)
+        for result in results {
+            guard case .failure(.unacceptableStatusCode) = result else {
+                return XCTFail("The call should fail with the status code: \(result)")
+            }
+        }
+        XCTAssertTrue(api.supportsMulticall)
+    }
+
+    func testConcurrentMulticallsFallBack() async throws {
+        stub(condition: isHost("wordpress.org")) { request in
+            let method = Self.methodName(of: request) ?? ""
+            if method == "system.multicall" {
+                return HTTPStubsResponse(data: Self.methodNotFoundResponse, statusCode: 200, headers: self.xmlContentTypeHeaders)
+            }
+            return HTTPStubsResponse(data: Self.stringResponse(method), statusCode: 200, headers: self.xmlContentTypeHeaders)
+        }
+
+        let api = WordPressOrgXMLRPCApi(endpoint: xmlrpcEndpoint)
+        let calls: [(method: String, parameters: [AnyObject]?)] = [
+            (method: "wp.getOptions", parameters: nil),
+            (method: "wp.getPostFormats", parameters: nil),
+        ]
+
+        let bodies = await withTaskGroup(of: [String?].self) { group in
+            for _ in 1...10 {
+                group.addTask {
+                    await api.multicall(calls).map { try? $0.get().body as? String }
+                }
+            }
+            return await group.reduce(into: [[String?]]()) { $0.append($1) }
+        }
+
+        XCTAssertEqual(bodies.count, 10)
+        XCTAssertTrue(bodies.allSatisfy { $0 == ["wp.getOptions", "wp.getPostFormats"] })
+        XCTAssertFalse(api.supportsMulticall)
+    }
+
+    func testObjectiveCCallbacks() {
+        stub(condition: isHost("wordpress.org")) { _ in
+            HTTPStubsResponse(data: Self.multicallResponse, statusCode: 200, headers: self.xmlContentTypeHeaders)
+        }
+
+        let success = expectation(description: "The first call succeeds")
+        let failure = expectation(description: "The second call fails")
+        let api = WordPressOrgXMLRPCApi(endpoint: xmlrpcEndpoint)
+        api.callMethods([
+            WordPressOrgXMLRPCApiMethodCall(
+                method: "wp.getOptions",
+                parameters: nil,
+                success: { _, _ in success.fulfill() },
+                failure: { _, _ in XCTFail("Unexpected failure") }
+            ),
+            WordPressOrgXMLRPCApiMethodCall(
+                method: "wp.getPostFormats",
+                parameters: nil,
+                success: { _, _ in XCTFail("Unexpected success") },
+                failure: { error, _ in
+                    XCTAssertEqual(error.domain, WPXMLRPCFaultErrorDomain)
+                    XCTAssertEqual(error.code, 403)
+                    failure.fulfill()
+                }
+            ),
+        ])
+
+        wait(for: [success, failure], timeout: 1)
+    }
+
+    private static func methodName(of request: URLRequest) -> String? {
+        guard let body = request.httpBodyText,
+              let start = body.range(of: "<methodName>"),
+              let end = body.range(of: "</methodName>", range: start.upperBound..<body.endIndex)
+        else {
+            return nil
+        }
+        return String(body[start.upperBound..<end.lowerBound])
+    }
+
+    private static let multicallResponse = Data("""
+        <?xml version="1.0" encoding="UTF-8"?>
+        <methodResponse><params><param><value><array><data>
+          <value><array><data>
+            <value><struct><member><name>blog_title</name><value><string>My Blog</string></value></member></struct></value>
+          </data></array></value>
+          <value><struct>
+            <member><name>faultCode</name><value><int>403</int></value></member>
+            <member><name>faultString</name><value><string>Sorry, you are not allowed to do that.</string></value></member>
+          </struct></value>
+        </data></array></value></param></params></methodResponse>
+        """.utf8)
+
+    private static let methodNotFoundResponse = Data("""
+        <?xml version="1.0" encoding="UTF-8"?>
+        <methodResponse><fault><value><struct>
+          <member><name>faultCode</name><value><int>-32601</int></value></member>
+          <member><name>faultString</name><value><string>server error. requested method system.multicall does not exist.</string></value></member>
+        </struct></value></fault></methodResponse>
+        """.utf8)
+
+    private static let authenticationFaultResponse = Data("""
+        <?xml version="1.0" encoding="UTF-8"?>
+        <methodResponse><fault><value><struct>
+          <member><name>faultCode</name><value><int>403</int></value></member>
+          <member><name>faultString</name><value><string>Incorrect username or password.</string></value></member>
+        </struct></value></fault></methodResponse>
+        """.utf8)
+
+    private static func stringResponse(_ value: String) -> Data {
+        Data("""
+            <?xml version="1.0" encoding="UTF-8"?>
+            <methodResponse><params><param><value><string>\(value)</string></value></param></params></methodResponse>
+            """.utf8)
+    }
+
+}
@@ -393,4 +393,93 @@ class WordPressOrgXMLRPCApiTests: XCTestCase {
         XCTAssertEqual(progress?.fractionCompleted, 1)
     }
 
+    func testCallWithElementsStreaming() async throws {
+        let stubPath = try XCTUnwrap(OHPathForFileInBundle("xmlrpc-response-list-methods.xml", Bundle.coreAPITestsBundle))
+        stub(condition: isXmlRpcAPIRequest()) { _ in
+            return fixture(filePath: stubPath, headers: self.xmlContentTypeHeaders)
+        }
+
+        let expected = try XCTUnwrap(WPXMLRPCDecoder(data: Data(contentsOf: URL(fileURLWithPath: stubPath)))?.object() as? [String])
+
+        let api = WordPressOrgXMLRPCApi(endpoint: URL(string: xmlrpcEndpoint)!)
+        var elements = [String]()
+        let result = await api.call(method: "system.listMethods", parameters: nil) { element in
+            elements.append(element as! String)
+        }
+
+        XCTAssertEqual(try result.get().body, expected.count)
+        XCTAssertEqual(elements, expected)
+    }
+
+    func testCallMethodWithElementsOffTheMainThread() throws {
+        let stubPath = try XCTUnwrap(OHPathForFileInBundle("xmlrpc-response-list-methods.xml", Bundle.coreAPITestsBundle))
+        stub(condition: isXmlRpcAPIRequest()) { _ in
+            return fixture(filePath: stubPath, headers: self.xmlContentTypeHeaders)
+        }
+
+        let success = expectation(description: "The success callback is called")
+        let api = WordPressOrgXMLRPCApi(endpoint: URL(string: xmlrpcEndpoint)!)
+        let lock = NSLock()
+        var elementsOnMainThread = 0
+        var elements = 0
+        api.callMethod(
+            "system.listMethods",
+            parameters: nil,
+            element: { _ in
+                let isMainThread = Thread.isMainThread
+                lock.lock()
+                elements += 1
+                elementsOnMainThread += isMainThread ? 1 : 0
+                lock.unlock()
+            },
+            success: { _ in
+                XCTAssertTrue(Thread.isMainThread)
+                success.fulfill()
+            },
+            failure: { error, _ in
+                XCTFail("Unexpected error: \(error)")
+            }
+        )
+        wait(for: [success], timeout: 1)
+
+        lock.lock()
+        defer { lock.unlock() }
+        XCTAssertGreaterThan(elements, 0)
+        XCTAssertEqual(elementsOnMainThread, 0)
+    }
+
+    func testCallWithElementsFault() async throws {
+        let stubPath = try XCTUnwrap(OHPathForFileInBundle("xmlrpc-bad-username-password-error.xml", Bundle.coreAPITestsBundle))
+        stub(condition: isXmlRpcAPIRequest()) { _ in
+            return fixture(filePath: stubPath, headers: self.xmlContentTypeHeaders)
+        }
+
+        let api = WordPressOrgXMLRPCApi(endpoint: URL(string: xmlrpcEndpoint)!)
+        let result = await api.call(method: "wp.getPosts", parameters: nil) { _ in
+            XCTFail("Unexpected element")
+        }
+
+        guard case let .failure(.endpointError(fault)) = result else {
+            return XCTFail("Unexpected result: \(result)")
+        }
+        XCTAssertEqual(fault.code, 403)
+        XCTAssertEqual(fault.message, "Incorrect username or password.")
+    }
+
+    func testCallWithElementsUnacceptableStatusCode() async throws {
+        stub(condition: isXmlRpcAPIRequest()) { _ in
+            HTTPStubsResponse(data: Data("Not found".utf8), statusCode: 404, headers: ["Content-Type": "text/html"])
+        }
+
+        let api = WordPressOrgXMLRPCApi(endpoint: URL(string: xmlrpcEndpoint)!)
+        let result = await api.call(method: "wp.getPosts", parameters: nil) { _ in
+            XCTFail("Unexpected element")
+        }
+
+        guard case let .failure(.unacceptableStatusCode(response, _)) = result else {
+            return XCTFail("Unexpected result: \(result)")
+        }
+        XCTAssertEqual(response.statusCode, 404)
+    }
+
 }
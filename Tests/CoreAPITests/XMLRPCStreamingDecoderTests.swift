@@ -0,0 +1,106 @@
+import XCTest
+import OHHTTPStubs
+import wpxmlrpc
+#if SWIFT_PACKAGE
+@testable import CoreAPI
+#else
+@testable import WordPressKit
+#endif
+
+class XMLRPCStreamingDecoderTests: XCTestCase {
+
+    func testDecodingStructMatchesWPXMLRPCDecoder() throws {
+        let data = try fixture("xmlrpc-response-getpost.xml")
+        let expected = try XCTUnwrap(WPXMLRPCDecoder(data: data)?.object() as? NSDictionary)
+
+        for chunkSize in [1, 7, 1024, data.count] {
+            let response = try decode(data, chunkSize: chunkSize, element: nil)
+            guard case let .value(value) = response else {
+                return XCTFail("Unexpected response: \(response)")
+            }
+            XCTAssertEqual(value as? NSDictionary, expected, "Chunk size: \(chunkSize)")
+        }
+    }
+
+    func testStreamingArrayElements() throws {
+        let data = try fixture("xmlrpc-response-list-methods.xml")
+        let expected = try XCTUnwrap(WPXMLRPCDecoder(data: data)?.object() as? [String])
+
+        for chunkSize in [1, 13, data.count] {
+            var elements = [String]()
+            let response = try decode(data, chunkSize: chunkSize) { elements.append($0 as! String) }
+            guard case let .elements(count) = response else {
+                return XCTFail("Unexpected response: \(response)")
+            }
+            XCTAssertEqual(count, expected.count)
+            XCTAssertEqual(elements, expected, "Chunk size: \(chunkSize)")
+        }
+    }
+
+    func testFault() throws {
+        let data = try fixture("xmlrpc-bad-username-password-error.xml")
+        let response = try decode(data, chunkSize: 5) { _ in XCTFail("Unexpected element") }
+        guard case let .fault(code, message) = response else {
+            return XCTFail("Unexpected response: \(response)")
+        }
+        XCTAssertEqual(code, 403)
+        XCTAssertEqual(message, "Incorrect username or password.")
+    }
+
+    func testScalarTypes() throws {
+        let xml = """
+            <?xml version="1.0"?>
+            <!-- A comment -->
+            <methodResponse><params><param><value><struct>
+              <member><name>untyped</name><value>A &amp; B &#x263A;</value></member>
+              <member><name>cdata</name><value><string><![CDATA[<p>&amp;</p>]]></string></value></member>
+              <member><name>empty</name><value><string/></value></member>
+              <member><name>int</name><value><i4>-12</i4></value></member>
+              <member><name>double</name><value><double>1.5</double></value></member>
+              <member><name>bool</name><value><boolean>1</boolean></value></member>
+              <member><name>base64</name><value><base64>aGVsbG8=</base64></value></member>
+              <member><name>date</name><value><dateTime.iso8601>20130225T14:14:31</dateTime.iso8601></value></member>
+              <member><name>nil</name><value><nil/></value></member>
+              <member><name>nested</name><value><array><data><value><int>1</int></value></data></array></value></member>
+            </struct></value></param></params></methodResponse>
+            """
+        let response = try decode(Data(xml.utf8), chunkSize: 3) { _ in XCTFail("Only top-level arrays are streamed") }
+        guard case let .value(value) = response, let object = value as? [String: Any] else {
+            return XCTFail("Unexpected response: \(response)")
+        }
+
+        XCTAssertEqual(object["untyped"] as? String, "A & B \u{263A}")
+        XCTAssertEqual(object["cdata"] as? String, "<p>&amp;</p>")
+        XCTAssertEqual(object["empty"] as? String, "")
+        XCTAssertEqual(object["int"] as? Int, -12)
+        XCTAssertEqual(object["double"] as? Double, 1.5)
+        XCTAssertEqual(object["bool"] as? Bool, true)
+        XCTAssertEqual(object["base64"] as? Data, Data("hello".utf8))
+        XCTAssertEqual(object["date"] as? Date, Date(timeIntervalSince1970: 1_361_801_671))
+        XCTAssertTrue(object["nil"] is NSNull)
+        XCTAssertEqual(object["nested"] as? [Int], [1])
+    }
+
+    func testInvalidXML() throws {
+        XCTAssertThrowsError(try decode(Data("<html><body>Not found</body></html>".utf8), chunkSize: 4, element: nil))
+        XCTAssertThrowsError(try decode(Data("<methodResponse><params>".utf8), chunkSize: 4, element: nil))
+        XCTAssertThrowsError(try decode(Data("<methodResponse><params></param></methodResponse>".utf8), chunkSize: 4, element: nil))
+    }
+
+    private func decode(_ data: Data, chunkSize: Int, element: ((AnyObject) -> Void)?) throws -> XMLRPCStreamingDecoder.Response {
+        let decoder = XMLRPCStreamingDecoder(element: element)
+        var offset = 0
+        while offset < data.count {
+            let end = min(offset + chunkSize, data.count)
+            try decoder.append(data.subdata(in: offset..<end))
+            offset = end
+        }
+        return try decoder.finish()
+    }
+
+    private func fixture(_ name: String) throws -> Data {
+        let path = try XCTUnwrap(OHPathForFileInBundle(name, Bundle.coreAPITestsBundle))
+        return try Data(contentsOf: URL(fileURLWithPath: path))
+    }
+
+}
@@ -0,0 +1,88 @@
+import Foundation
+import XCTest
+#if SWIFT_PACKAGE
+@testable import CoreAPI
+#else
+@testable import WordPressKit
+#endif
+
+class XMLRPCValueEncoderTests: XCTestCase {
+
+    private struct Post: Encodable {
+        enum Status: String, Encodable {
+            case draft
+        }
+
+        var title: String
+        var status: Status
+        var author: Int
+        var sticky: Bool
+        var rating: Double
+        var date: Date
+        var excerpt: String?
+        var terms: [String: [Int]]
+        var fields: [Field]
+    }
+
+    private struct Field: Encodable {
+        var key: String
+        var value: String?
+    }
+
+    private let post = Post(
+        title: "Hello",
+        status: .draft,
+        author: 7,
+        sticky: true,
+        rating: 4.5,
+        date: Date(timeIntervalSince1970: 1_000),
+        excerpt: nil,
+        terms: ["category": [1, 2]],
+        fields: [Field(key: "foo", value: "bar"), Field(key: "baz", value: nil)]
+    )
+
+    func testEncodingStruct() throws {
+        let value = try XCTUnwrap(XMLRPCValueEncoder().encode(post) as? NSDictionary)
+
+        XCTAssertEqual(value, [
+            "title": "Hello",
+            "status": "draft",
+            "author": 7,
+            "sticky": true,
+            "rating": 4.5,
+            "date": Date(timeIntervalSince1970: 1_000),
+            "terms": ["category": [1, 2]],
+            "fields": [["key": "foo", "value": "bar"], ["key": "baz"]],
+        ] as NSDictionary)
+    }
+
+    func testEncodingMatchesPropertyListEncoder() throws {
+        let encoder = PropertyListEncoder()
+        encoder.outputFormat = .xml
+        let propertyList = try PropertyListSerialization.propertyList(from: encoder.encode(post), format: nil)
+
+        XCTAssertEqual(try XMLRPCValueEncoder().encode(post) as? NSDictionary, propertyList as? NSDictionary)
+    }
+
+    func testEncodingURLMatchesPropertyListEncoder() throws {
+        struct Link: Encodable {
+            var absolute: URL
+            var relative: URL
+        }
+        let link = Link(
+            absolute: URL(string: "https://example.com/hello-world/")!,
+            relative: URL(string: "hello-world/", relativeTo: URL(string: "https://example.com/"))!
+        )
+
+        let encoder = PropertyListEncoder()
+        encoder.outputFormat = .xml
+        let propertyList = try PropertyListSerialization.propertyList(from: encoder.encode(link), format: nil)
+
+        XCTAssertEqual(try XMLRPCValueEncoder().encode(link) as? NSDictionary, propertyList as? NSDictionary)
+    }
+
+    func testEncodingNilThrows() {
+        XCTAssertThrowsError(try XMLRPCValueEncoder().encode([1, nil, 3]))
+    }
+
+}
@@ -0,0 +1,137 @@
+import Foundation
+import UIKit
+import XCTest
+
+/// Base class of the benchmarks, which measure the throughput of the library's hot paths.
+///
+/// The benchmarks are excluded from the `UnitTests` test plan. Run them using the `Benchmarks` test plan, i.e.
+/// `bundle exec fastlane benchmark`.
+///
+/// Each benchmark is measured by XCTest, using the clock, CPU and memory metrics, so that they can be compared against
+/// the baselines in Xcode. The results, including the peak growth of the memory footprint, are also written to a JSON
+/// file, so that they can be compared between releases.
+/// The file is at the path in the `BENCHMARK_RESULTS_PATH` environment variable, or `WordPressKitBenchmarks.json`
+/// in the temporary directory.
+class BenchmarkTestCase: XCTestCase {
+
+    /// Measure the given block.
+    ///
+    /// - Parameters:
+    ///   - name: The name of the benchmark in the results file. The test's name is used by default.
+    ///   - iterations: The number of times the block is measured.
+    ///   - bytes: The number of bytes that are processed by one run of the block, which is used to calculate throughput.
+    ///   - items: The number of items (i.e. models) that are processed by one run of the block.
+    func benchmark(
+        _ name: String? = nil,
+        iterations: Int = 10,
+        bytes: Int? = nil,
+        items: Int? = nil,
+        block: () throws -> Void
+    ) {
+        let options = XCTMeasureOptions()
+        options.iterationCount = iterations
+
+        var samples = [TimeInterval]()
+        var peakMemoryGrowth: Int64 = 0
+        measure(metrics: [XCTClockMetric(), XCTCPUMetric(), XCTMemoryMetric()], options: options) {
+            let memory = MemorySampler()
+            memory.start()
+            let start = DispatchTime.now().uptimeNanoseconds
+            XCTAssertNoThrow(try block())
+            samples.append(Double(DispatchTime.now().uptimeNanoseconds - start) / 1_000_000_000)
+            peakMemoryGrowth = max(peakMemoryGrowth, memory.stop() - memory.initialFootprint)
+        }
+
+        var result = BenchmarkReport.Result(name: name ?? self.name, samples: samples, bytes: bytes, items: items)
+        result.peakMemoryGrowth = peakMemoryGrowth
+        BenchmarkReport.shared.add(result)
+    }
+
+    /// Returns the content of a file in the "Mock Data" directory.
+    func fixture(_ name: String) throws -> Data {
+        let url = try XCTUnwrap(Bundle(for: BenchmarkTestCase.self).url(forResource: name, withExtension: nil))
+        return try Data(contentsOf: url)
+    }
+
+    func jsonFixture(_ name: String) throws -> [String: AnyObject] {
+        try XCTUnwrap(JSONSerialization.jsonObject(with: fixture(name)) as? [String: AnyObject])
+    }
+
+}
+
+/// The machine-readable results of the benchmarks.
+final class BenchmarkReport {
+
+    struct Result: Encodable {
+        var name: String
+        var iterations: Int
+        var median: TimeInterval
+        var min: TimeInterval
+        var max: TimeInterval
+        var bytesPerSecond: Double?
+        var itemsPerSecond: Double?
+        // The results of load tests. See `LoadTestDriver`.
+        var p95: TimeInterval?
+        var p99: TimeInterval?
+        var failures: Int?
+        var peakMemoryFootprint: Int64?
+        /// The highest growth of the memory footprint while the block of a benchmark runs, which tracks the peak
+        /// allocations of the benchmarked code.
+        var peakMemoryGrowth: Int64?
+
+        init(name: String, samples: [TimeInterval], bytes: Int?, items: Int?) {
+            let sorted = samples.sorted()
+            let median = sorted.isEmpty ? 0 : sorted[sorted.count / 2]
+            self.name = name
+            self.iterations = sorted.count
+            self.median = median
+            self.min = sorted.first ?? 0
+            self.max = sorted.last ?? 0
+            self.bytesPerSecond = bytes.flatMap { median > 0 ? Double($0) / median : nil }
+            self.itemsPerSecond = items.flatMap { median > 0 ? Double($0) / median : nil }
+        }
+    }
+
+    private struct Report: Encodable {
+        var date: Date
+        var system: String
+        var commit: String?
+        var results: [Result]
+    }
+
+    static let shared = BenchmarkReport()
+
+    let url: URL
+    private var results = [Result]()
+
+    private init() {
+        let environment = ProcessInfo.processInfo.environment
+        if let path = environment["BENCHMARK_RESULTS_PATH"], !path.isEmpty {
+            url = URL(fileURLWithPath: path)
+        } else {
+            url = FileManager.default.temporaryDirectory.appendingPathComponent("WordPressKitBenchmarks.json")
+        }
+    }
+
+    /// Add the result, and rewrite the results file.
+    func add(_ result: Result) {
+        results.append(result)
+
+        let report = Report(
+            date: Date(),
+            system: "\(UIDevice.current.model) \(UIDevice.current.systemName) \(UIDevice.current.systemVersion)",
+            commit: ProcessInfo.processInfo.environment["BUILDKITE_COMMIT"].flatMap { $0.isEmpty ? nil : $0 },
+            results: results
+        )
+
+        let encoder = JSONEncoder()
+        encoder.dateEncodingStrategy = .iso8601
+        encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
+        do {
+            try encoder.encode(report).write(to: url, options: .atomic)
+        } catch {
+            XCTFail("Failed to write the benchmark results to \(url.path): \(error)")
+        }
+    }
+
+}
@@ -0,0 +1,286 @@
+import Foundation
+import XCTest
+import wpxmlrpc
+@testable import WordPressKit
+
+class CoreAPIBenchmarks: BenchmarkTestCase {
+
+    // MARK: - HTTPRequestBuilder
+
+    func testBuildingRequestWithLargeQuery() throws {
+        let url = try XCTUnwrap(URL(string: "https://public-api.wordpress.com"))
+        let parameters: [String: Any] = [
+            "fields": (1...200).map { "field_\($0)" }.joined(separator: ","),
+            "include": Array(1...1_000),
+            "meta": ["site": ["icon", "name", "URL"], "post": ["likes", "comments"]],
+            "search": String(repeating: "café & crème ", count: 100),
+        ]
+
+        benchmark(iterations: 20, items: 100) {
+            for _ in 1...100 {
+                _ = try HTTPRequestBuilder(url: url)
+                    .append(percentEncodedPath: "/rest/v1.1/sites/123/posts")
+                    .query(parameters)
+                    .build()
+            }
+        }
+    }
+
+    func testBuildingRequestWithFormBody() throws {
+        let url = try XCTUnwrap(URL(string: "https://public-api.wordpress.com"))
+        let form: [String: Any] = Dictionary(uniqueKeysWithValues: (1...1_000).map { ("key_\($0)", "value \($0) ✓") })
+
+        benchmark(iterations: 20, items: 100) {
+            for _ in 1...100 {
+                _ = try HTTPRequestBuilder(url: url)
+                    .method(.post)
+                    .append(percentEncodedPath: "/rest/v1.1/sites/123/settings")
+                    .body(form: form)
+                    .build(encodeBody: true)
+            }
+        }
+    }
+
+    // MARK: - Dates
+
+    func testParsingDatesWithDateFormatter() {
+        let strings = dateStrings()
+
+        benchmark(items: strings.count) {
+            for string in strings {
+                _ = DateFormatter.wordPressCom.date(from: string)
+            }
+        }
+    }
+
+    func testParsingDates() {
+        let strings = dateStrings()
+
+        benchmark(items: strings.count) {
+            for string in strings {
+                _ = Date.with(wordPressComJSONString: string)
+            }
+        }
+    }
+
+    func testParsingDatesConcurrently() {
+        let strings = dateStrings()
+
+        benchmark(items: strings.count) {
+            DispatchQueue.concurrentPerform(iterations: 8) { slice in
+                for string in strings[(slice * strings.count / 8)..<((slice + 1) * strings.count / 8)] {
+                    _ = Date.with(wordPressComJSONString: string)
+                }
+            }
+        }
+    }
+
+    // MARK: - Post request bodies
+
+    func testEncodingPostBodyThroughDictionary() throws {
+        let post = longPost()
+        let encoder = JSONEncoder()
+        encoder.dateEncodingStrategy = .formatted(.wordPressCom)
+
+        benchmark(iterations: 20, bytes: post.content!.utf8.count * 100, items: 100) {
+            for _ in 1...100 {
+                let data = try encoder.encode(RemotePostCreateParametersWordPressComEncoder(parameters: post))
+                let dictionary = try JSONSerialization.jsonObject(with: data)
+                _ = try JSONSerialization.data(withJSONObject: dictionary)
+            }
+        }
+    }
+
+    func testEncodingPostBody() throws {
+        let post = longPost()
+        let encoder = JSONEncoder()
+        encoder.dateEncodingStrategy = .formatted(.wordPressCom)
+
+        benchmark(iterations: 20, bytes: post.content!.utf8.count * 100, items: 100) {
+            for _ in 1...100 {
+                _ = try encoder.encode(RemotePostCreateParametersWordPressComEncoder(parameters: post))
+            }
+        }
+    }
+
+    func testEncodingXMLRPCPostThroughPropertyList() throws {
+        let post = longPost()
+        let encoder = PropertyListEncoder()
+        encoder.outputFormat = .xml
+
+        benchmark(iterations: 20, bytes: post.content!.utf8.count * 100, items: 100) {
+            for _ in 1...100 {
+                let data = try encoder.encode(RemotePostCreateParametersXMLRPCEncoder(parameters: post))
+                _ = try PropertyListSerialization.propertyList(from: data, format: nil)
+            }
+        }
+    }
+
+    func testEncodingXMLRPCPost() throws {
+        let post = longPost()
+
+        benchmark(iterations: 20, bytes: post.content!.utf8.count * 100, items: 100) {
+            for _ in 1...100 {
+                _ = try XMLRPCValueEncoder().encode(RemotePostCreateParametersXMLRPCEncoder(parameters: post))
+            }
+        }
+    }
+
+    // MARK: - WordPressComRestApi request builder
+
+    func testBuildingRequestFromURLString() throws {
+        let api = WordPressComRestApi()
+
+        benchmark(iterations: 20, items: 1_000) {
+            for id in 1...1_000 {
+                let path = WordPressComRESTAPIVersionedPathBuilder.path(forEndpoint: "sites/123/posts/\(id)?context=edit", withVersion: ._1_1)
+                _ = try api.requestBuilder(URLString: path).method(.get).build()
+            }
+        }
+    }
+
+    func testBuildingRequestFromEndpoint() throws {
+        let api = WordPressComRestApi()
+        let endpoint = WordPressComEndpoint<TwoPathParameters>("sites/:site/posts/:post?context=edit", version: ._1_1)
+
+        benchmark(iterations: 20, items: 1_000) {
+            for id in 1...1_000 {
+                _ = try api.requestBuilder(path: endpoint.path(123, id)).method(.get).build()
+            }
+        }
+    }
+
+    // MARK: - Multipart form
+
+    func testEncodingMultipartForm1MB() throws {
+        try benchmarkMultipartForm(size: 1_000_000, iterations: 10)
+    }
+
+    func testEncodingMultipartForm100MB() throws {
+        try benchmarkMultipartForm(size: 100_000_000, iterations: 5)
+    }
+
+    func testEncodingMultipartForm500MB() throws {
+        try benchmarkMultipartForm(size: 500_000_000, iterations: 3)
+    }
+
+    func testStreamingMultipartForm100MB() throws {
+        let file = try temporaryFile(size: 100_000_000)
+        defer { try? FileManager.default.removeItem(at: file) }
+
+        let fields = [
+            MultipartFormField(text: "123456", name: "site"),
+            try MultipartFormField(fileAtPath: file.path, name: "media", filename: "file.jpg", mimeType: "image/jpeg"),
+        ]
+
+        benchmark(iterations: 5, bytes: 100_000_000) {
+            let stream = fields.multipartFormInputStream(boundary: "benchmark")
+            stream.open()
+            defer { stream.close() }
+
+            var buffer = [UInt8](repeating: 0, count: 64 * 1024)
+            while stream.read(&buffer, maxLength: buffer.count) > 0 {}
+        }
+    }
+
+    // MARK: - XML-RPC
+
+    func testEncodingXMLRPCRequest() throws {
+        let url = try XCTUnwrap(URL(string: "https://example.com/xmlrpc.php"))
+        let content = String(repeating: "<p>Hello, <strong>world</strong> &amp; everyone.</p>\n", count: 20_000)
+        let post: [String: Any] = [
+            "post_title": "Benchmark",
+            "post_content": content,
+            "terms_names": ["post_tag": (1...100).map { "tag \($0)" }],
+            "custom_fields": (1...100).map { ["key": "key_\($0)", "value": "value_\($0)"] },
+        ]
+
+        let builder = HTTPRequestBuilder(url: url)
+            .method(.post)
+            .body(xmlrpc: "wp.editPost", parameters: [1, "username", "password", 100, post])
+
+        benchmark(iterations: 10, bytes: content.utf8.count) {
+            var request = try builder.build()
+            _ = try builder.encodeXMLRPC(request: &request, forceWriteToFile: false)
+        }
+    }
+
+    func testDecodingXMLRPCResponse() throws {
+        let data = try fixture("xmlrpc-site-comments-success.xml")
+
+        benchmark(iterations: 20, bytes: data.count * 100) {
+            for _ in 1...100 {
+                _ = try XCTUnwrap(WPXMLRPCDecoder(data: data)?.object())
+            }
+        }
+    }
+
+    func testStreamingXMLRPCResponse() throws {
+        let data = try fixture("xmlrpc-site-comments-success.xml")
+
+        benchmark(iterations: 20, bytes: data.count * 100) {
+            for _ in 1...100 {
+                let decoder = XMLRPCStreamingDecoder(element: { _ in })
+                var offset = 0
+                while offset < data.count {
+                    let end = min(offset + 16 * 1024, data.count)
+                    try decoder.append(data[offset..<end])
+                    offset = end
+                }
+                _ = try decoder.finish()
+            }
+        }
+    }
+
+    // MARK: - Helpers
+
+    private func benchmarkMultipartForm(size: Int, iterations: Int) throws {
+        let file = try temporaryFile(size: size)
+        defer { try? FileManager.default.removeItem(at: file) }
+
+        let fields = [
+            MultipartFormField(text: "123456", name: "site"),
+            try MultipartFormField(fileAtPath: file.path, name: "media", filename: "file.jpg", mimeType: "image/jpeg"),
+        ]
+
+        benchmark(iterations: iterations, bytes: size) {
+            let encoded = try fields.multipartFormDataStream(boundary: "benchmark", forceWriteToFile: true)
+            encoded.map(left: { _ in }, right: { try? FileManager.default.removeItem(at: $0) })
+        }
+    }
+
+    private func temporaryFile(size: Int) throws -> URL {
+        let url = FileManager.default.temporaryDirectory.appendingPathComponent("benchmark-\(UUID().uuidString).jpg")
+        FileManager.default.createFile(atPath: url.path, contents: nil)
+        let handle = try FileHandle(forWritingTo: url)
+        defer { handle.closeFile() }
+
+        let chunk = Data(repeating: Character("a").asciiValue!, count: min(size, 10_000_000))
+        var written = 0
+        while written < size {
+            let data = chunk.prefix(size - written)
+            handle.write(data)
+            written += data.count
+        }
+        return url
+    }
+
+    /// 10,000 dates in the format of the WordPress.com REST API, which both the parser and the formatter can parse.
+    private func dateStrings() -> [String] {
+        (0..<10_000).map { index in
+            DateFormatter.wordPressCom.string(from: Date(timeIntervalSince1970: 1_600_000_000 + TimeInterval(index) * 3_607))
+        }
+    }
+
+    /// A post with 100 KB of block editor content.
+    private func longPost() -> RemotePostCreateParameters {
+        var post = RemotePostCreateParameters(type: "post", status: "draft")
+        post.title = "A long post"
+        post.date = Date()
+        post.content = String(repeating: "<!-- wp:paragraph -->\n<p>Lorem ipsum dolor sit amet, “café” & crème.</p>\n<!-- /wp:paragraph -->\n", count: 1_250)
+        post.tags = (1...20).map { "tag \($0)" }
+        post.categoryIDs = Array(1...10)
+        return post
+    }
+
+}
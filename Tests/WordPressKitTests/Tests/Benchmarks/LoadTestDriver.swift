@@ -0,0 +1,134 @@
+import Foundation
+
+/// Sends requests from a number of concurrent callers, and measures the throughput, latency and memory footprint.
+enum LoadTestDriver {
+
+    struct Result {
+        var concurrency: Int
+        var requests: Int
+        var failures: Int
+        var duration: TimeInterval
+        /// The latencies of all requests, including the failed ones, in ascending order.
+        var latencies: [TimeInterval]
+        /// The highest memory footprint of the process while the requests are sent.
+        var peakMemoryFootprint: Int64
+
+        var requestsPerSecond: Double {
+            duration > 0 ? Double(requests) / duration : 0
+        }
+
+        /// Returns the latency at the given percentile (0...1), using the nearest-rank method.
+        func latency(atPercentile fraction: Double) -> TimeInterval {
+            guard !latencies.isEmpty else { return 0 }
+            let rank = Int((fraction * Double(latencies.count)).rounded(.up))
+            return latencies[min(max(rank, 1), latencies.count) - 1]
+        }
+    }
+
+    /// Run the load test.
+    ///
+    /// - Parameters:
+    ///   - concurrency: The number of callers that send requests at the same time.
+    ///   - requestsPerCaller: The number of requests that each caller sends, one after another.
+    ///   - request: Sends one request. It throws if the request fails.
+    static func run(
+        concurrency: Int,
+        requestsPerCaller: Int,
+        request: @escaping @Sendable () async throws -> Void
+    ) async -> Result {
+        let memory = MemorySampler()
+        memory.start()
+
+        let start = DispatchTime.now().uptimeNanoseconds
+        let samples = await withTaskGroup(of: [(TimeInterval, Bool)].self) { group in
+            for _ in 0..<concurrency {
+                group.addTask {
+                    var samples = [(TimeInterval, Bool)]()
+                    for _ in 0..<requestsPerCaller {
+                        let requestStart = DispatchTime.now().uptimeNanoseconds
+                        let succeeded = (try? await request()) != nil
+                        samples.append((Double(DispatchTime.now().uptimeNanoseconds - requestStart) / 1_000_000_000, succeeded))
+                    }
+                    return samples
+                }
+            }
+
+            return await group.reduce(into: []) { $0.append(contentsOf: $1) }
+        }
+        let duration = Double(DispatchTime.now().uptimeNanoseconds - start) / 1_000_000_000
+
+        return Result(
+            concurrency: concurrency,
+            requests: samples.count,
+            failures: samples.filter { !$0.1 }.count,
+            duration: duration,
+            latencies: samples.map(\.0).sorted(),
+            peakMemoryFootprint: memory.stop()
+        )
+    }
+
+}
+
+extension BenchmarkReport.Result {
+
+    init(name: String, load result: LoadTestDriver.Result) {
+        self.init(name: name, samples: result.latencies, bytes: nil, items: nil)
+        self.itemsPerSecond = result.requestsPerSecond
+        self.p95 = result.latency(atPercentile: 0.95)
+        self.p99 = result.latency(atPercentile: 0.99)
+        self.failures = result.failures
+        self.peakMemoryFootprint = result.peakMemoryFootprint
+    }
+
+}
+
+/// Samples the memory footprint of the process every 10 milliseconds, and keeps the highest value.
+final class MemorySampler {
+    private let lock = NSLock()
+    private var peak: Int64 = 0
+    private var timer: DispatchSourceTimer?
+
+    /// The memory footprint when the sampling started.
+    private(set) var initialFootprint: Int64 = 0
+
+    func start() {
+        initialFootprint = Self.footprint() ?? 0
+
+        let timer = DispatchSource.makeTimerSource(queue: .global(qos: .utility))
+        timer.schedule(deadline: .now(), repeating: .milliseconds(10))
+        timer.setEventHandler { [weak self] in self?.sample() }
+        timer.resume()
+        self.timer = timer
+    }
+
+    /// Stop sampling, and return the highest memory footprint.
+    func stop() -> Int64 {
+        timer?.cancel()
+        timer = nil
+        sample()
+
+        lock.lock()
+        defer { lock.unlock() }
+        return peak
+    }
+
+    private func sample() {
+        guard let footprint = Self.footprint() else { return }
+
+        lock.lock()
+        peak = max(peak, footprint)
+        lock.unlock()
+    }
+
+    private static func footprint() -> Int64? {
+        var info = task_vm_info_data_t()
+        var count = mach_msg_type_number_t(MemoryLayout<task_vm_info_data_t>.size / MemoryLayout<natural_t>.size)
+        let result = withUnsafeMutablePointer(to: &info) {
+            $0.withMemoryRebound(to: integer_t.self, capacity: Int(count)) {
+                task_info(mach_task_self_, task_flavor_t(TASK_VM_INFO), $0, &count)
+            }
+        }
+        guard result == KERN_SUCCESS else { return nil }
+        return Int64(info.phys_footprint)
+    }
+}
@@ -0,0 +1,90 @@
+import Foundation
+import XCTest
+@testable import WordPressKit
+
+/// Load tests of the API clients against a `LocalHTTPServer`, at 1 to 256 concurrent callers.
+///
+/// The results are written to the benchmark results file. See `BenchmarkTestCase`.
+class LoadTests: BenchmarkTestCase {
+
+    private let concurrencyLevels = [1, 4, 16, 64, 256]
+    private let requestsPerCaller = 10
+
+    private var server: LocalHTTPServer!
+    private var baseURL: URL!
+
+    override func setUpWithError() throws {
+        try super.setUpWithError()
+        // A typical round trip to WP.com.
+        server = LocalHTTPServer.wordPress(conditions: .init(latency: 0.05, jitter: 0.05))
+        baseURL = try server.start()
+    }
+
+    override func tearDown() {
+        server.stop()
+        server = nil
+        super.tearDown()
+    }
+
+    func testWordPressComRestApi() async throws {
+        for concurrency in concurrencyLevels {
+            let api = WordPressComRestApi(oAuthToken: "token", userAgent: nil, baseURL: baseURL)
+            let result = await LoadTestDriver.run(concurrency: concurrency, requestsPerCaller: requestsPerCaller) {
+                _ = try await api.perform(.get, URLString: "/rest/v1.1/sites/123/posts").get()
+            }
+            record(result, name: "WordPressComRestApi GET posts")
+        }
+    }
+
+    func testWordPressComRestApiUnderThrottling() async throws {
+        server.conditions.requestsPerSecond = 100
+        server.conditions.errorRate = 0.01
+
+        for concurrency in concurrencyLevels {
+            let api = WordPressComRestApi(oAuthToken: "token", userAgent: nil, baseURL: baseURL)
+            api.retryPolicy = .default
+            let result = await LoadTestDriver.run(concurrency: concurrency, requestsPerCaller: requestsPerCaller) {
+                _ = try await api.perform(.get, URLString: "/rest/v1.2/read/following").get()
+            }
+            // Some requests are expected to fail, after their retries are exhausted.
+            record(result, name: "WordPressComRestApi GET reader with throttling", allowsFailures: true)
+        }
+    }
+
+    func testWordPressComRestApiUpload() async throws {
+        let file = FileManager.default.temporaryDirectory.appendingPathComponent("load-test-\(UUID().uuidString).jpg")
+        try Data(repeating: 0xFF, count: 500_000).write(to: file)
+        defer { try? FileManager.default.removeItem(at: file) }
+
+        server.conditions.bandwidth = 10_000_000
+
+        for concurrency in concurrencyLevels.filter({ $0 <= 16 }) {
+            let api = WordPressComRestApi(oAuthToken: "token", userAgent: nil, baseURL: baseURL)
+            let result = await LoadTestDriver.run(concurrency: concurrency, requestsPerCaller: requestsPerCaller) {
+                _ = try await api.upload(
+                    URLString: "/rest/v1.1/sites/123/media/new",
+                    fileParts: [FilePart(parameterName: "media[]", url: file, fileName: "image.jpg", mimeType: "image/jpeg")]
+                ).get()
+            }
+            record(result, name: "WordPressComRestApi upload 500 KB")
+        }
+    }
+
+    func testWordPressOrgXMLRPCApi() async throws {
+        for concurrency in concurrencyLevels {
+            let api = WordPressOrgXMLRPCApi(endpoint: baseURL.appendingPathComponent("xmlrpc.php"))
+            let result = await LoadTestDriver.run(concurrency: concurrency, requestsPerCaller: requestsPerCaller) {
+                _ = try await api.call(method: "wp.getComments", parameters: [1, "username", "password"] as [AnyObject]).get()
+            }
+            record(result, name: "WordPressOrgXMLRPCApi wp.getComments")
+        }
+    }
+
+    private func record(_ result: LoadTestDriver.Result, name: String, allowsFailures: Bool = false) {
+        if !allowsFailures {
+            XCTAssertEqual(result.failures, 0, "\(name) at \(result.concurrency) concurrent callers")
+        }
+        BenchmarkReport.shared.add(.init(name: "\(name) (\(result.concurrency) callers)", load: result))
+    }
+
+}
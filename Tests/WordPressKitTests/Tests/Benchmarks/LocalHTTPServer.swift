@@ -0,0 +1,473 @@
+import Foundation
+import Network
+
+/// A HTTP/1.1 server that runs in the test process, so that requests go through the whole `URLSession` pipeline
+/// (connection pooling, keep-alive, chunked uploads), which is bypassed by `OHHTTPStubs`.
+///
+/// Responses are provided by the routes that are added to the server. `LocalHTTPServer.wordPress()` returns a server that
+/// replays the "Mock Data" fixtures for a few WP.com REST, XML-RPC and media upload endpoints.
+///
+/// The `conditions` are applied to every request, to simulate slow networks and overloaded servers.
+final class LocalHTTPServer {
+
+    struct Request {
+        var method: String
+        var path: String
+        var query: String?
+        /// The header names are lowercased.
+        var headers: [String: String]
+        var body: Data
+
+        /// The method name of an XML-RPC request.
+        var xmlrpcMethod: String? {
+            let body = String(decoding: body.prefix(1024), as: UTF8.self)
+            guard let start = body.range(of: "<methodName>"),
+                  let end = body.range(of: "</methodName>", range: start.upperBound..<body.endIndex)
+            else {
+                return nil
+            }
+            return String(body[start.upperBound..<end.lowerBound]).trimmingCharacters(in: .whitespacesAndNewlines)
+        }
+    }
+
+    struct Response {
+        var statusCode: Int
+        var headers: [String: String]
+        var body: Data
+
+        init(statusCode: Int = 200, headers: [String: String] = [:], body: Data = Data()) {
+            self.statusCode = statusCode
+            self.headers = headers
+            self.body = body
+        }
+
+        static func json(_ object: Any, statusCode: Int = 200) -> Response {
+            let body = (try? JSONSerialization.data(withJSONObject: object)) ?? Data()
+            return Response(statusCode: statusCode, headers: ["Content-Type": "application/json"], body: body)
+        }
+
+        /// Returns the content of a file in the "Mock Data" directory.
+        static func fixture(_ name: String, statusCode: Int = 200) -> Response {
+            guard let url = Bundle(for: LocalHTTPServer.self).url(forResource: name, withExtension: nil),
+                  let body = try? Data(contentsOf: url)
+            else {
+                return .json(["error": "fixture_not_found", "message": name], statusCode: 500)
+            }
+
+            let contentType = url.pathExtension == "xml" ? "text/xml" : "application/json"
+            return Response(statusCode: statusCode, headers: ["Content-Type": contentType], body: body)
+        }
+    }
+
+    /// The network conditions that are simulated by the server.
+    struct Conditions {
+        /// The delay before a response is sent.
+        var latency: TimeInterval = 0
+        /// A random delay, up to this value, that's added to the `latency`.
+        var jitter: TimeInterval = 0
+        /// The maximum number of response bytes that are sent per second on each connection. Unlimited if it's nil.
+        var bandwidth: Int?
+        /// The fraction of requests that fail with the `errorStatusCode`.
+        var errorRate: Double = 0
+        var errorStatusCode: Int = 500
+        /// The fraction of requests whose connection is closed without a response.
+        var connectionDropRate: Double = 0
+        /// The maximum number of requests that are accepted per second. Requests over the limit receive a 429 response
+        /// with a `Retry-After` header.
+        var requestsPerSecond: Int?
+    }
+
+    private struct Route {
+        var method: String
+        var segments: [Substring]
+        var xmlrpcMethod: String?
+        var handler: (Request) -> Response
+
+        func matches(_ request: Request) -> Bool {
+            guard request.method == method else { return false }
+
+            let path = request.path.split(separator: "/")
+            guard path.count == segments.count,
+                  zip(path, segments).allSatisfy({ $1.hasPrefix(":") || $0 == $1 })
+            else {
+                return false
+            }
+
+            return xmlrpcMethod == nil || xmlrpcMethod == request.xmlrpcMethod
+        }
+    }
+
+    /// The bytes that are received on a connection, which requests are parsed from as they arrive.
+    ///
+    /// The received bytes are appended to one buffer, and parsing resumes from where it stopped, so that a large request
+    /// body isn't copied or scanned again every time more of it is received.
+    final class RequestBuffer {
+        private struct Head {
+            var request: Request
+            var isChunked: Bool
+            var contentLength: Int
+        }
+
+        private static let crlf = Data("\r\n".utf8)
+        private static let headerTerminator = Data("\r\n\r\n".utf8)
+
+        private var data = Data()
+        // The offset that the search for the end of the head resumes from.
+        private var headSearchOffset = 0
+        private var head: Head?
+        // The offset of the body, or of the next chunk of a chunked body.
+        private var bodyOffset = 0
+        private var chunkedBody = Data()
+
+        /// The bytes that aren't parsed into a request yet.
+        var remaining: Data {
+            data
+        }
+
+        func append(_ bytes: Data) {
+            data.append(bytes)
+        }
+
+        /// Parse the next request. Returns nil if the buffer doesn't contain a whole request yet.
+        func nextRequest() -> Request? {
+            if head == nil {
+                guard let headerEnd = data.range(of: Self.headerTerminator, in: headSearchOffset..<data.endIndex) else {
+                    // The terminator may be split between this read and the next one.
+                    headSearchOffset = max(0, data.endIndex - (Self.headerTerminator.count - 1))
+                    return nil
+                }
+                guard let request = Self.parseHead(data[data.startIndex..<headerEnd.lowerBound]) else {
+                    return nil
+                }
+                head = Head(
+                    request: request,
+                    isChunked: request.headers["transfer-encoding"]?.lowercased() == "chunked",
+                    contentLength: request.headers["content-length"].flatMap(Int.init) ?? 0
+                )
+                bodyOffset = headerEnd.upperBound
+            }
+
+            guard var head else { return nil }
+
+            let end: Int
+            if head.isChunked {
+                guard let chunkedEnd = parseChunks() else { return nil }
+                head.request.body = chunkedBody
+                end = chunkedEnd
+            } else {
+                guard data.endIndex - bodyOffset >= head.contentLength else { return nil }
+                end = bodyOffset + head.contentLength
+                head.request.body = data.subdata(in: bodyOffset..<end)
+            }
+
+            // The bytes of the next requests are moved to the start of the buffer, which is usually none or a few.
+            data = data.subdata(in: end..<data.endIndex)
+            headSearchOffset = 0
+            self.head = nil
+            bodyOffset = 0
+            chunkedBody = Data()
+            return head.request
+        }
+
+        /// Parse the chunks that are received since the last call. Returns the end of the body, or nil if the last
+        /// chunk isn't received yet.
+        private func parseChunks() -> Int? {
+            while true {
+                guard let lineEnd = data.range(of: Self.crlf, in: bodyOffset..<data.endIndex),
+                      let line = String(data: data[bodyOffset..<lineEnd.lowerBound], encoding: .ascii),
+                      let size = Int(line.prefix { $0 != ";" }.trimmingCharacters(in: .whitespaces), radix: 16)
+                else {
+                    return nil
+                }
+
+                let chunkStart = lineEnd.upperBound
+                // The chunk is followed by CRLF. The last chunk, whose size is 0, is followed by an empty trailer line.
+                guard data.endIndex - chunkStart >= size + Self.crlf.count else { return nil }
+                if size == 0 {
+                    return chunkStart + Self.crlf.count
+                }
+                chunkedBody.append(data[chunkStart..<(chunkStart + size)])
+                bodyOffset = chunkStart + size + Self.crlf.count
+            }
+        }
+
+        private static func parseHead(_ bytes: Data) -> Request? {
+            guard let head = String(data: bytes, encoding: .utf8) else { return nil }
+
+            var lines = head.components(separatedBy: "\r\n")
+            let requestLine = lines.removeFirst().split(separator: " ")
+            guard requestLine.count >= 2 else { return nil }
+
+            var headers = [String: String]()
+            for line in lines {
+                guard let colon = line.firstIndex(of: ":") else { continue }
+                headers[line[..<colon].lowercased()] = line[line.index(after: colon)...].trimmingCharacters(in: .whitespaces)
+            }
+
+            let target = requestLine[1].split(separator: "?", maxSplits: 1)
+            return Request(
+                method: String(requestLine[0]),
+                path: String(target[0]),
+                query: target.count > 1 ? String(target[1]) : nil,
+                headers: headers,
+                body: Data()
+            )
+        }
+    }
+
+    /// The network conditions of the requests that are received from now on.
+    var conditions: Conditions {
+        get {
+            lock.lock()
+            defer { lock.unlock() }
+            return _conditions
+        }
+        set {
+            lock.lock()
+            _conditions = newValue
+            lock.unlock()
+        }
+    }
+
+    private let queue = DispatchQueue(label: "org.wordpress.kit.local-http-server", attributes: .concurrent)
+    private let lock = NSLock()
+    private var listener: NWListener?
+    private var connections = [ObjectIdentifier: NWConnection]()
+    private var routes = [Route]()
+    private var recentRequests = [Date]()
+    private var _requestCount = 0
+    private var _conditions: Conditions
+
+    init(conditions: Conditions = Conditions()) {
+        self._conditions = conditions
+    }
+
+    deinit {
+        stop()
+    }
+
+    /// The number of requests that are received since the server started.
+    var requestCount: Int {
+        lock.lock()
+        defer { lock.unlock() }
+        return _requestCount
+    }
+
+    /// Add a route. The path segments that start with ":" match any value, i.e. `/rest/v1.1/sites/:site/posts`.
+    func route(_ method: String, _ path: String, handler: @escaping (Request) -> Response) {
+        lock.lock()
+        routes.append(Route(method: method, segments: path.split(separator: "/"), handler: handler))
+        lock.unlock()
+    }
+
+    /// Add a route for the XML-RPC method.
+    func xmlrpc(_ methodName: String, path: String = "/xmlrpc.php", handler: @escaping (Request) -> Response) {
+        lock.lock()
+        routes.append(Route(method: "POST", segments: path.split(separator: "/"), xmlrpcMethod: methodName, handler: handler))
+        lock.unlock()
+    }
+
+    /// Start the server on a random port, and return its base URL.
+    func start() throws -> URL {
+        let listener = try NWListener(using: .tcp, on: .any)
+        let ready = DispatchSemaphore(value: 0)
+        var failure: Error?
+        listener.stateUpdateHandler = { state in
+            switch state {
+            case .ready:
+                ready.signal()
+            case let .failed(error):
+                failure = error
+                ready.signal()
+            default:
+                break
+            }
+        }
+        listener.newConnectionHandler = { [weak self] connection in
+            self?.accept(connection)
+        }
+        listener.start(queue: queue)
+
+        guard ready.wait(timeout: .now() + 5) == .success, failure == nil, let port = listener.port else {
+            listener.cancel()
+            throw failure ?? URLError(.cannotConnectToHost)
+        }
+
+        lock.lock()
+        self.listener = listener
+        lock.unlock()
+
+        return URL(string: "http://localhost:\(port.rawValue)")!
+    }
+
+    func stop() {
+        lock.lock()
+        let listener = listener
+        let connections = connections.values
+        self.listener = nil
+        self.connections = [:]
+        lock.unlock()
+
+        listener?.cancel()
+        connections.forEach { $0.cancel() }
+    }
+
+    // MARK: - Connections
+
+    private func accept(_ connection: NWConnection) {
+        lock.lock()
+        connections[ObjectIdentifier(connection)] = connection
+        lock.unlock()
+
+        connection.stateUpdateHandler = { [weak self, weak connection] state in
+            switch state {
+            case .failed, .cancelled:
+                guard let self, let connection else { return }
+                self.lock.lock()
+                self.connections.removeValue(forKey: ObjectIdentifier(connection))
+                self.lock.unlock()
+            default:
+                break
+            }
+        }
+        connection.start(queue: queue)
+        receive(on: connection, buffer: RequestBuffer())
+    }
+
+    /// Read the next request on the connection. Requests on the same connection are handled one at a time.
+    private func receive(on connection: NWConnection, buffer: RequestBuffer) {
+        if let request = buffer.nextRequest() {
+            respond(to: request, on: connection) { [weak self] in
+                self?.receive(on: connection, buffer: buffer)
+            }
+            return
+        }
+
+        connection.receive(minimumIncompleteLength: 1, maximumLength: 256 * 1024) { [weak self] data, _, isComplete, error in
+            guard let self, error == nil else {
+                connection.cancel()
+                return
+            }
+
+            if let data, !data.isEmpty {
+                buffer.append(data)
+                self.receive(on: connection, buffer: buffer)
+            } else if isComplete {
+                connection.cancel()
+            } else {
+                self.receive(on: connection, buffer: buffer)
+            }
+        }
+    }
+
+    private func respond(to request: Request, on connection: NWConnection, completion: @escaping () -> Void) {
+        let conditions = conditions
+        let now = Date()
+
+        lock.lock()
+        _requestCount += 1
+        var throttled = false
+        if let limit = conditions.requestsPerSecond {
+            recentRequests.removeAll { now.timeIntervalSince($0) >= 1 }
+            throttled = recentRequests.count >= limit
+            if !throttled {
+                recentRequests.append(now)
+            }
+        }
+        let route = routes.first { $0.matches(request) }
+        lock.unlock()
+
+        if Double.random(in: 0..<1) < conditions.connectionDropRate {
+            connection.cancel()
+            return
+        }
+
+        let response: Response
+        if throttled {
+            var throttledResponse = Response.json(["error": "rate_limit_exceeded", "message": "Too many requests"], statusCode: 429)
+            throttledResponse.headers["Retry-After"] = "1"
+            response = throttledResponse
+        } else if Double.random(in: 0..<1) < conditions.errorRate {
+            response = .json(["error": "injected_error", "message": "Injected error"], statusCode: conditions.errorStatusCode)
+        } else if let route {
+            response = route.handler(request)
+        } else {
+            response = .json(["error": "unknown_route", "message": "\(request.method) \(request.path)"], statusCode: 404)
+        }
+
+        let delay = conditions.latency + (conditions.jitter > 0 ? Double.random(in: 0...conditions.jitter) : 0)
+        queue.asyncAfter(deadline: .now() + delay) {
+            self.send(response, on: connection, bandwidth: conditions.bandwidth, completion: completion)
+        }
+    }
+
+    private func send(_ response: Response, on connection: NWConnection, bandwidth: Int?, completion: @escaping () -> Void) {
+        var head = "HTTP/1.1 \(response.statusCode) \(HTTPURLResponse.localizedString(forStatusCode: response.statusCode).capitalized)\r\n"
+        var headers = response.headers
+        headers["Content-Length"] = "\(response.body.count)"
+        headers["Connection"] = "keep-alive"
+        for (name, value) in headers {
+            head += "\(name): \(value)\r\n"
+        }
+        head += "\r\n"
+
+        guard let bandwidth, bandwidth > 0 else {
+            connection.send(content: Data(head.utf8) + response.body, completion: .contentProcessed { _ in completion() })
+            return
+        }
+
+        connection.send(content: Data(head.utf8), completion: .idempotent)
+
+        // Send the body in 10 chunks per second.
+        let chunkSize = max(1, bandwidth / 10)
+        func sendChunk(from offset: Int) {
+            guard offset < response.body.count else {
+                completion()
+                return
+            }
+
+            let end = min(offset + chunkSize, response.body.count)
+            connection.send(content: response.body.subdata(in: offset..<end), completion: .contentProcessed { [queue] error in
+                guard error == nil else { return }
+                queue.asyncAfter(deadline: .now() + 0.1) { sendChunk(from: end) }
+            })
+        }
+        sendChunk(from: 0)
+    }
+
+}
+
+// MARK: - WordPress Endpoints
+
+extension LocalHTTPServer {
+
+    /// Returns a server that serves the "Mock Data" fixtures of these endpoints:
+    ///
+    /// - WP.com REST API: `/rest/v1.1/me`, `/rest/v1.1/me/sites`, `/rest/v1.1/sites/:site/posts`,
+    ///   `/rest/v1.1/sites/:site/stats/visits`, `/rest/v1.2/read/following`.
+    /// - Multipart media upload: `/rest/v1.1/sites/:site/media/new`, which responds with the size of the request body.
+    /// - XML-RPC (`/xmlrpc.php`): `wp.getPost`, `wp.getComments`, `wp.getProfile`, `metaWeblog.newPost`,
+    ///   `metaWeblog.editPost`.
+    static func wordPress(conditions: Conditions = Conditions()) -> LocalHTTPServer {
+        let server = LocalHTTPServer(conditions: conditions)
+
+        server.route("GET", "/rest/v1.1/me") { _ in .fixture("me-success.json") }
+        server.route("GET", "/rest/v1.1/me/sites") { _ in .fixture("me-sites-success.json") }
+        server.route("GET", "/rest/v1.1/sites/:site/posts") { _ in .fixture("post-autosave-mapping-success.json") }
+        server.route("GET", "/rest/v1.2/sites/:site/posts") { _ in .fixture("post-autosave-mapping-success.json") }
+        server.route("GET", "/rest/v1.1/sites/:site/stats/visits") { _ in .fixture("stats-visits-month.json") }
+        server.route("GET", "/rest/v1.2/read/following") { _ in .fixture("reader-posts-success.json") }
+        server.route("POST", "/rest/v1.1/sites/:site/media/new") { request in
+            .json(["media": [["ID": 1, "size": request.body.count]]])
+        }
+
+        server.xmlrpc("wp.getPost") { _ in .fixture("xmlrpc-wp-getpost-success.xml") }
+        server.xmlrpc("wp.getComments") { _ in .fixture("xmlrpc-site-comments-success.xml") }
+        server.xmlrpc("wp.getProfile") { _ in .fixture("xmlrpc-response-getprofile.xml") }
+        server.xmlrpc("metaWeblog.newPost") { _ in .fixture("xmlrpc-metaweblog-newpost-success.xml") }
+        server.xmlrpc("metaWeblog.editPost") { _ in .fixture("xmlrpc-metaweblog-editpost-success.xml") }
+
+        return server
+    }
+
+}
@@ -0,0 +1,193 @@
+import Foundation
+import XCTest
+@testable import WordPressKit
+
+class LocalHTTPServerTests: XCTestCase {
+
+    private var server: LocalHTTPServer!
+    private var baseURL: URL!
+
+    override func setUpWithError() throws {
+        try super.setUpWithError()
+        server = LocalHTTPServer.wordPress()
+        baseURL = try server.start()
+    }
+
+    override func tearDown() {
+        server.stop()
+        server = nil
+        super.tearDown()
+    }
+
+    func testServingFixture() async throws {
+        let api = WordPressComRestApi(oAuthToken: "token", userAgent: nil, baseURL: baseURL)
+        let response = try await api.perform(.get, URLString: "/rest/v1.1/me").get()
+
+        XCTAssertEqual((response.body as? [String: Any])?["username"] as? String, "jimthetester")
+        XCTAssertEqual(server.requestCount, 1)
+    }
+
+    func testKeepAlive() async throws {
+        let api = WordPressComRestApi(oAuthToken: "token", userAgent: nil, baseURL: baseURL)
+        for _ in 1...3 {
+            _ = try await api.perform(.get, URLString: "/rest/v1.1/sites/123/posts").get()
+        }
+
+        XCTAssertEqual(server.requestCount, 3)
+    }
+
+    func testUnknownRoute() async throws {
+        let response = try await get("/rest/v1.1/unknown")
+        XCTAssertEqual(response.statusCode, 404)
+    }
+
+    func testInjectedErrors() async throws {
+        server.conditions.errorRate = 1
+        server.conditions.errorStatusCode = 503
+
+        let response = try await get("/rest/v1.1/me")
+        XCTAssertEqual(response.statusCode, 503)
+    }
+
+    func testThrottling() async throws {
+        server.conditions.requestsPerSecond = 1
+
+        let first = try await get("/rest/v1.1/me")
+        let second = try await get("/rest/v1.1/me")
+
+        XCTAssertEqual(first.statusCode, 200)
+        XCTAssertEqual(second.statusCode, 429)
+        XCTAssertEqual(second.value(forHTTPHeaderField: "Retry-After"), "1")
+    }
+
+    func testLatency() async throws {
+        server.conditions.latency = 0.2
+
+        let start = Date()
+        _ = try await get("/rest/v1.1/me")
+        XCTAssertGreaterThanOrEqual(Date().timeIntervalSince(start), 0.2)
+    }
+
+    func testMultipartUpload() async throws {
+        let file = FileManager.default.temporaryDirectory.appendingPathComponent("local-server-\(UUID().uuidString).jpg")
+        try Data(repeating: 0xFF, count: 300_000).write(to: file)
+        defer { try? FileManager.default.removeItem(at: file) }
+
+        let api = WordPressComRestApi(oAuthToken: "token", userAgent: nil, baseURL: baseURL)
+        let response = try await api.upload(
+            URLString: "/rest/v1.1/sites/123/media/new",
+            fileParts: [FilePart(parameterName: "media[]", url: file, fileName: "image.jpg", mimeType: "image/jpeg")]
+        ).get()
+
+        let media = try XCTUnwrap(((response.body as? [String: Any])?["media"] as? [[String: Any]])?.first)
+        XCTAssertGreaterThan(try XCTUnwrap(media["size"] as? Int), 300_000)
+    }
+
+    func testMultipartUploadReportsProgress() async throws {
+        let file = FileManager.default.temporaryDirectory.appendingPathComponent("local-server-\(UUID().uuidString).jpg")
+        try Data(repeating: 0xFF, count: 5_000_000).write(to: file)
+        defer { try? FileManager.default.removeItem(at: file) }
+
+        // The form is streamed by a `dataTask`, whose progress would otherwise stay at zero until the response.
+        let progress = Progress.discreteProgress(totalUnitCount: 100)
+        let completed = expectation(description: "The upload is complete")
+        var fractions = [Double]()
+        let observer = progress.observe(\.fractionCompleted, options: .new) { progress, _ in
+            fractions.append(progress.fractionCompleted)
+            if progress.fractionCompleted == 1 {
+                completed.fulfill()
+            }
+        }
+        defer { observer.invalidate() }
+
+        let api = WordPressComRestApi(oAuthToken: "token", userAgent: nil, baseURL: baseURL)
+        _ = try await api.upload(
+            URLString: "/rest/v1.1/sites/123/media/new",
+            fileParts: [FilePart(parameterName: "media[]", url: file, fileName: "image.jpg", mimeType: "image/jpeg")],
+            fulfilling: progress
+        ).get()
+        await fulfillment(of: [completed], timeout: 1)
+
+        XCTAssertTrue(fractions.contains { $0 > 0 && $0 < 1 }, "Unexpected progress updates: \(fractions)")
+    }
+
+    func testMultipartUploadIsResentAfterRedirect() async throws {
+        let file = FileManager.default.temporaryDirectory.appendingPathComponent("local-server-\(UUID().uuidString).jpg")
+        try Data(repeating: 0xFF, count: 300_000).write(to: file)
+        defer { try? FileManager.default.removeItem(at: file) }
+
+        // A 307 redirect keeps the method, so `URLSession` has to send the body again.
+        let location = baseURL.appendingPathComponent("rest/v1.1/sites/123/media/new").absoluteString
+        server.route("POST", "/rest/v1.1/sites/:site/media/moved") { _ in
+            LocalHTTPServer.Response(statusCode: 307, headers: ["Location": location])
+        }
+
+        let api = WordPressComRestApi(oAuthToken: "token", userAgent: nil, baseURL: baseURL)
+        let response = try await api.upload(
+            URLString: "/rest/v1.1/sites/123/media/moved",
+            fileParts: [FilePart(parameterName: "media[]", url: file, fileName: "image.jpg", mimeType: "image/jpeg")]
+        ).get()
+
+        let media = try XCTUnwrap(((response.body as? [String: Any])?["media"] as? [[String: Any]])?.first)
+        XCTAssertGreaterThan(try XCTUnwrap(media["size"] as? Int), 300_000)
+        XCTAssertEqual(server.requestCount, 2)
+    }
+
+    func testXMLRPC() async throws {
+        let api = WordPressOrgXMLRPCApi(endpoint: baseURL.appendingPathComponent("xmlrpc.php"))
+        let response = try await api.call(method: "wp.getPost", parameters: [1, "username", "password", 1] as [AnyObject]).get()
+
+        XCTAssertNotNil(response.body as? [String: Any])
+    }
+
+    func testParsingChunkedRequest() throws {
+        let data = Data("POST /upload HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n5\r\nhello\r\n6\r\n world\r\n0\r\n\r\nGET /next".utf8)
+        let buffer = LocalHTTPServer.RequestBuffer()
+        buffer.append(data)
+        let request = try XCTUnwrap(buffer.nextRequest())
+
+        XCTAssertEqual(request.method, "POST")
+        XCTAssertEqual(request.path, "/upload")
+        XCTAssertEqual(String(data: request.body, encoding: .utf8), "hello world")
+        XCTAssertEqual(String(data: buffer.remaining, encoding: .utf8), "GET /next")
+        XCTAssertNil(buffer.nextRequest())
+
+        let incomplete = LocalHTTPServer.RequestBuffer()
+        incomplete.append(data.prefix(60))
+        XCTAssertNil(incomplete.nextRequest())
+    }
+
+    func testParsingRequestsReceivedByteByByte() throws {
+        let data = Data((
+            "POST /upload HTTP/1.1\r\nContent-Length: 5\r\n\r\nhello"
+            + "POST /upload HTTP/1.1\r\nTransfer-Encoding: chunked\r\n\r\n5\r\nhello\r\n6\r\n world\r\n0\r\n\r\n"
+            + "GET /next HTTP/1.1\r\n\r\n"
+        ).utf8)
+        let buffer = LocalHTTPServer.RequestBuffer()
+        var requests = [LocalHTTPServer.Request]()
+        for byte in data {
+            buffer.append(Data([byte]))
+            while let request = buffer.nextRequest() {
+                requests.append(request)
+            }
+        }
+
+        XCTAssertEqual(requests.map(\.path), ["/upload", "/upload", "/next"])
+        XCTAssertEqual(requests.map { String(decoding: $0.body, as: UTF8.self) }, ["hello", "hello world", ""])
+        XCTAssertTrue(buffer.remaining.isEmpty)
+    }
+
+    private func get(_ path: String) async throws -> HTTPURLResponse {
+        let url = try XCTUnwrap(URL(string: path, relativeTo: baseURL))
+        return try await withCheckedThrowingContinuation { continuation in
+            URLSession.shared.dataTask(with: url) { _, response, error in
+                if let response = response as? HTTPURLResponse {
+                    continuation.resume(returning: response)
+                } else {
+                    continuation.resume(throwing: error ?? URLError(.badServerResponse))
+                }
+            }.resume()
+        }
+    }
+
+}
@@ -0,0 +1,104 @@
+import Foundation
+import XCTest
+@testable import WordPressKit
+
+/// Measures the CPU time that the main thread spends on syncing, using the completion handler and the async variants
+/// of the services, against a `LocalHTTPServer`.
+///
+/// The syncs are started from the main actor, like apps do. The results are written to the benchmark results file.
+/// See `BenchmarkTestCase`.
+class MainThreadBenchmarks: BenchmarkTestCase {
+
+    private let syncs = 20
+
+    private var server: LocalHTTPServer!
+    private var baseURL: URL!
+
+    override func setUpWithError() throws {
+        try super.setUpWithError()
+        server = LocalHTTPServer.wordPress()
+        baseURL = try server.start()
+    }
+
+    override func tearDown() {
+        server.stop()
+        server = nil
+        super.tearDown()
+    }
+
+    @MainActor
+    func testReaderStreamSync() async throws {
+        let service = ReaderPostServiceRemote(wordPressComRestApi: api())
+        let endpoint = baseURL.appendingPathComponent("rest/v1.2/read/following")
+
+        try await measureMainThread("Reader stream sync, completion handlers") {
+            try await withCheckedThrowingContinuation { continuation in
+                service.fetchPosts(
+                    fromEndpoint: endpoint,
+                    algorithm: nil,
+                    count: 10,
+                    offset: 0,
+                    success: { _, _ in continuation.resume() },
+                    failure: { continuation.resume(throwing: $0 ?? URLError(.unknown)) }
+                )
+            }
+        }
+
+        try await measureMainThread("Reader stream sync, async") {
+            _ = try await service.fetchPosts(fromEndpoint: endpoint, algorithm: nil, count: 10, offset: 0)
+        }
+    }
+
+    @MainActor
+    func testPostListSync() async throws {
+        let service = PostServiceRemoteREST(wordPressComRestApi: api(), siteID: 123)
+
+        try await measureMainThread("Post list sync, completion handlers") {
+            try await withCheckedThrowingContinuation { continuation in
+                service.getPostsOfType(
+                    "post",
+                    options: nil,
+                    success: { _ in continuation.resume() },
+                    failure: { continuation.resume(throwing: $0 ?? URLError(.unknown)) }
+                )
+            }
+        }
+
+        try await measureMainThread("Post list sync, async") {
+            _ = try await service.getPosts(ofType: "post")
+        }
+    }
+
+    private func api() -> WordPressComRestApi {
+        WordPressComRestApi(oAuthToken: "token", userAgent: nil, baseURL: baseURL)
+    }
+
+    /// Run the sync a number of times, and record the main thread's CPU time of each one.
+    @MainActor
+    private func measureMainThread(_ name: String, sync: () async throws -> Void) async throws {
+        var samples = [TimeInterval]()
+        for _ in 1...syncs {
+            let start = mainThreadCPUTime()
+            try await sync()
+            samples.append(mainThreadCPUTime() - start)
+        }
+        BenchmarkReport.shared.add(.init(name: "\(name) (main thread CPU time)", samples: samples, bytes: nil, items: nil))
+    }
+
+    private func mainThreadCPUTime() -> TimeInterval {
+        let thread = pthread_mach_thread_np(pthread_main_thread_np())
+        var info = thread_basic_info()
+        var count = mach_msg_type_number_t(MemoryLayout<thread_basic_info_data_t>.size / MemoryLayout<integer_t>.size)
+        let result = withUnsafeMutablePointer(to: &info) {
+            $0.withMemoryRebound(to: integer_t.self, capacity: Int(count)) {
+                thread_info(thread, thread_flavor_t(THREAD_BASIC_INFO), $0, &count)
+            }
+        }
+        guard result == KERN_SUCCESS else { return 0 }
+
+        let seconds = info.user_time.seconds + info.system_time.seconds
+        let microseconds = info.user_time.microseconds + info.system_time.microseconds
+        return TimeInterval(seconds) + TimeInterval(microseconds) / 1_000_000
+    }
+
+}
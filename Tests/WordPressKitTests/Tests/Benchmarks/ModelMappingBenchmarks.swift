@@ -0,0 +1,298 @@
+import Foundation
+import XCTest
+@testable import WordPressKit
+
+class ModelMappingBenchmarks: BenchmarkTestCase {
+
+    /// The fixtures only have a few models, which are mapped this many times in each run.
+    private let repetitions = 100
+
+    func testMappingReaderPosts() throws {
+        let posts = try XCTUnwrap(jsonFixture("reader-posts-success.json")["posts"] as? [[String: Any]])
+
+        benchmark(items: posts.count * repetitions) {
+            for _ in 1...repetitions {
+                for post in posts {
+                    _ = RemoteReaderPost(dictionary: post)
+                }
+            }
+        }
+    }
+
+    func testMappingPosts() throws {
+        let posts = try XCTUnwrap(jsonFixture("post-autosave-mapping-success.json")["posts"] as? [[String: Any]])
+
+        benchmark(items: posts.count * repetitions) {
+            for _ in 1...repetitions {
+                for post in posts {
+                    _ = PostServiceRemoteREST.remotePost(fromJSONDictionary: post)
+                }
+            }
+        }
+    }
+
+    func testParsingStatsSummary() throws {
+        let json = try jsonFixture("stats-visits-month.json")
+        let date = Date()
+
+        benchmark(items: repetitions) {
+            for _ in 1...repetitions {
+                _ = try XCTUnwrap(StatsSummaryTimeIntervalData(date: date, period: .month, unit: nil, jsonDictionary: json))
+            }
+        }
+    }
+
+    func testParsingStatsTopPosts() throws {
+        let json = try jsonFixture("stats-posts-data.json")
+        let date = Date()
+
+        benchmark(items: repetitions) {
+            for _ in 1...repetitions {
+                _ = try XCTUnwrap(StatsTopPostsTimeIntervalData(date: date, period: .day, jsonDictionary: json))
+            }
+        }
+    }
+
+    // MARK: - Mapping models from response data
+
+    func testMappingReaderPostsFromData() throws {
+        let data = try fixture("reader-posts-success.json")
+
+        benchmark(bytes: data.count * repetitions, items: repetitions) {
+            for _ in 1...repetitions {
+                let json = try XCTUnwrap(JSONSerialization.jsonObject(with: data) as? [String: Any])
+                let posts = try XCTUnwrap(json["posts"] as? [[String: Any]])
+                _ = posts.map { RemoteReaderPost(dictionary: $0) }
+            }
+        }
+    }
+
+    func testMappingPostsFromData() throws {
+        let data = try fixture("reader-posts-success.json")
+
+        benchmark(bytes: data.count * repetitions, items: repetitions) {
+            for _ in 1...repetitions {
+                let json = try XCTUnwrap(JSONSerialization.jsonObject(with: data) as? [String: Any])
+                let posts = try XCTUnwrap(json["posts"] as? [[String: Any]])
+                _ = posts.map { PostServiceRemoteREST.remotePost(fromJSONDictionary: $0) }
+            }
+        }
+    }
+
+    func testMappingCommentsFromData() throws {
+        let data = try fixture("site-comments-success.json")
+        let service = CommentServiceRemoteREST(wordPressComRestApi: WordPressComRestApi(), siteID: 1)
+
+        benchmark(bytes: data.count * repetitions * 10, items: repetitions * 10) {
+            for _ in 1...(repetitions * 10) {
+                let json = try XCTUnwrap(JSONSerialization.jsonObject(with: data) as? [String: Any])
+                let comments = try XCTUnwrap(json["comments"] as? [[String: Any]])
+                _ = comments.map { service.remoteComment(fromJSONDictionary: $0) }
+            }
+        }
+    }
+
+    // MARK: - Decoding models from response data
+    //
+    // The same fixtures as the benchmarks above, decoded straight into the models, which the async fetches do.
+
+    func testDecodingReaderPostsFromData() throws {
+        let data = try fixture("reader-posts-success.json")
+
+        benchmark(bytes: data.count * repetitions, items: repetitions) {
+            for _ in 1...repetitions {
+                _ = try JSONDecoder().decode(RemoteReaderPostsEnvelope.self, from: data)
+            }
+        }
+    }
+
+    func testDecodingPostsFromData() throws {
+        let data = try fixture("reader-posts-success.json")
+
+        benchmark(bytes: data.count * repetitions, items: repetitions) {
+            for _ in 1...repetitions {
+                _ = try JSONDecoder().decode(RemotePostsEnvelope.self, from: data)
+            }
+        }
+    }
+
+    func testDecodingCommentsFromData() throws {
+        let data = try fixture("site-comments-success.json")
+
+        benchmark(bytes: data.count * repetitions * 10, items: repetitions * 10) {
+            for _ in 1...(repetitions * 10) {
+                _ = try JSONDecoder().decode(RemoteCommentsEnvelope.self, from: data)
+            }
+        }
+    }
+
+    // MARK: - Mapping a page of a Reader stream
+
+    func testMappingReaderStreamSerially() throws {
+        let posts = try readerStream()
+
+        benchmark(items: posts.count * 10) {
+            for _ in 1...10 {
+                _ = RemoteReaderPost.posts(fromJSONArray: posts, rankingFromOffset: 0)
+            }
+        }
+    }
+
+    /// Maps the posts of a page with `DispatchQueue.concurrentPerform`, each into its own slot of the result, which
+    /// `testMappingReaderStreamSerially` can be compared against. The mapping isn't concurrent, because the caller's
+    /// thread would be blocked while the page is mapped, but this measures what it would save.
+    func testMappingReaderStreamConcurrently() throws {
+        let posts = try readerStream()
+
+        benchmark(items: posts.count * 10) {
+            for _ in 1...10 {
+                var mapped = [RemoteReaderPost?](repeating: nil, count: posts.count)
+                mapped.withUnsafeMutableBufferPointer { buffer in
+                    DispatchQueue.concurrentPerform(iterations: posts.count) { index in
+                        buffer[index] = RemoteReaderPost(dictionary: posts[index])
+                    }
+                }
+                for (index, post) in mapped.enumerated() {
+                    post?.sortRank = NSNumber(value: -Double(index))
+                }
+            }
+        }
+    }
+
+    /// The derived values of the posts, like the summaries, are made when they're first read. This is the cost of mapping
+    /// a page serially when all of them are read, which `testMappingReaderStreamSerially` can be compared against.
+    func testMappingReaderStreamAndReadingDerivedValues() throws {
+        let posts = try readerStream()
+
+        benchmark(items: posts.count * 10) {
+            for _ in 1...10 {
+                for dictionary in posts {
+                    let post = RemoteReaderPost(dictionary: dictionary)
+                    _ = (post.postTitle, post.summary, post.featuredImage, post.blogName, post.blogDescription)
+                    _ = (post.tags, post.primaryTag, post.crossPostMeta, post.railcar)
+                }
+            }
+        }
+    }
+
+    // MARK: - Interning repeated strings
+
+    func testMappingReaderBackfill() throws {
+        let pages = try readerBackfill()
+
+        benchmark(items: 1_000) {
+            _ = try mapReaderBackfill(pages, stringPool: nil)
+        }
+    }
+
+    func testMappingReaderBackfillWithStringPool() throws {
+        let pages = try readerBackfill()
+
+        benchmark(items: 1_000) {
+            _ = try mapReaderBackfill(pages, stringPool: StringInterningPool())
+        }
+    }
+
+    // MARK: - Decoding untyped JSON
+
+    func testDecodingBlockEditorSettings() throws {
+        let data = try fixture("wp-block-editor-v1-settings-success-ThemeJSON.json")
+
+        benchmark(bytes: data.count * repetitions, items: repetitions) {
+            for _ in 1...repetitions {
+                _ = try JSONDecoder().decode(RemoteBlockEditorSettings.self, from: data)
+            }
+        }
+    }
+
+    func testDecodingReaderCards() throws {
+        let data = try fixture("reader-cards-success.json")
+
+        benchmark(bytes: data.count * 10, items: 10) {
+            for _ in 1...10 {
+                _ = try JSONDecoder().decode(ReaderCardEnvelope.self, from: data)
+            }
+        }
+    }
+
+    func testDecodingJSONValue() throws {
+        let data = try fixture("plugin-directory-popular.json")
+
+        benchmark(bytes: data.count * 10, items: 10) {
+            for _ in 1...10 {
+                _ = try JSONDecoder().decode(JSONValue.self, from: data).jsonObject
+            }
+        }
+    }
+
+    // MARK: - Checksums
+
+    /// The checksum that `ChecksumUtil` used to compute: the MD5 of the value encoded to JSON, with sorted keys.
+    func testChecksumOfBlockEditorSettingsFromJSON() throws {
+        let data = try fixture("wp-block-editor-v1-settings-success-ThemeJSON.json")
+        let settings = try JSONDecoder().decode(RemoteBlockEditorSettings.self, from: data)
+        let encoder = JSONEncoder()
+        encoder.outputFormatting = .sortedKeys
+
+        benchmark(items: repetitions) {
+            for _ in 1...repetitions {
+                let json = try encoder.encode(settings)
+                _ = (String(data: json, encoding: .utf8) ?? "").md5()
+            }
+        }
+    }
+
+    func testChecksumOfBlockEditorSettings() throws {
+        let data = try fixture("wp-block-editor-v1-settings-success-ThemeJSON.json")
+        let settings = try JSONDecoder().decode(RemoteBlockEditorSettings.self, from: data)
+
+        benchmark(items: repetitions) {
+            for _ in 1...repetitions {
+                _ = ChecksumUtil.checksum(from: settings)
+            }
+        }
+    }
+
+    // MARK: - Helpers
+
+    /// A page of 40 posts, which is what the Reader streams fetch. It's made of copies of the Reader posts fixture's
+    /// posts, with distinct IDs.
+    private func readerStream(page: Int = 0) throws -> [[AnyHashable: Any]] {
+        let posts = try XCTUnwrap(jsonFixture("reader-posts-success.json")["posts"] as? [[AnyHashable: Any]])
+        return (page * 4..<(page + 1) * 4).flatMap { copy in
+            posts.map { post in
+                var post = post
+                post["ID"] = (post["ID"] as? Int ?? 0) + copy * 100_000
+                post["global_ID"] = "\(post["global_ID"] ?? "")-\(copy)"
+                return post
+            }
+        }
+    }
+
+    /// The responses of a backfill of 1,000 posts, in pages of 40 posts.
+    private func readerBackfill() throws -> [Data] {
+        try (0..<25).map { page in
+            try JSONSerialization.data(withJSONObject: ["posts": readerStream(page: page)])
+        }
+    }
+
+    /// Maps the responses of a backfill, and reads the posts' values like they're read when the posts are saved. All
+    /// of the posts are kept until the backfill is mapped, so that the memory metrics measure what they retain.
+    private func mapReaderBackfill(_ pages: [Data], stringPool: StringInterningPool?) throws -> [RemoteReaderPost] {
+        var backfill = [RemoteReaderPost]()
+        for (index, page) in pages.enumerated() {
+            let json = try XCTUnwrap(JSONSerialization.jsonObject(with: page) as? [String: Any])
+            let posts = RemoteReaderPost.posts(
+                fromJSONArray: try XCTUnwrap(json["posts"] as? [[AnyHashable: Any]]),
+                rankingFromOffset: NSNumber(value: index * 40),
+                stringPool: stringPool
+            )
+            for post in posts {
+                _ = (post.blogName, post.blogDescription, post.primaryTag, post.secondaryTag)
+            }
+            backfill.append(contentsOf: posts)
+        }
+        return backfill
+    }
+
+}
@@ -71,6 +71,54 @@ final class CommentServiceRemoteRESTTests: RemoteTestCase, RESTTestable {
         waitForExpectations(timeout: timeout, handler: nil)
     }
 
+    func testGetSingleCommentAsync() async throws {
+        stubRemoteResponse(siteCommentEndpoint,
+                           filename: fetchCommentSuccessFilename,
+                           contentType: .ApplicationJSON)
+
+        // The comment is decoded like `getCommentWithID(_:success:failure:)` maps it.
+        let comment = try await remote.getComment(withID: commentId)
+        XCTAssertEqual(comment.authorID, NSNumber(value: 12345))
+        XCTAssertEqual(comment.authorEmail, "author@email.com")
+        XCTAssertEqual(comment.parentID, nil)
+        XCTAssertEqual(comment.status, "approve")
+        XCTAssertEqual(comment.canModerate, true)
+    }
+
+    func testSyncHierarchicalCommentsAsync() async throws {
+        stubRemoteResponse("sites/\(siteId)/posts/1/replies",
+                           filename: fetchCommentsSuccessFilename,
+                           contentType: .ApplicationJSON)
+
+        // The comments are decoded like `syncHierarchicalComments(forPost:page:number:success:failure:)` maps them.
+        let result = try await remote.syncHierarchicalComments(forPost: 1, page: 1, number: 20)
+        let comment = try XCTUnwrap(result.comments.first)
+
+        XCTAssertEqual(result.comments.count, 1)
+        XCTAssertEqual(result.found, 1)
+        XCTAssertEqual(comment.commentID, NSNumber(value: commentId))
+        XCTAssertEqual(comment.authorEmail, "author@email.com")
+        XCTAssertEqual(comment.postID, NSNumber(value: 1))
+        XCTAssertEqual(comment.status, "approve")
+    }
+
+    func testSyncHierarchicalCommentsAsyncFailure() async throws {
+        stubRemoteResponse("sites/\(siteId)/posts/1/replies",
+                           filename: "site-active-purchases-auth-failure.json",
+                           contentType: .ApplicationJSON,
+                           status: 403)
+
+        do {
+            _ = try await remote.syncHierarchicalComments(forPost: 1, page: 1, number: 20)
+            XCTFail("Expected the call to throw")
+        } catch let error as WordPressAPIError<WordPressComRestApiEndpointError> {
+            guard case let .endpointError(endpointError) = error else {
+                return XCTFail("Unexpected error: \(error)")
+            }
+            XCTAssertEqual(endpointError.code, .authorizationRequired)
+        }
+    }
+
     func testGetSingleCommentSucceeds() {
         let expect = expectation(description: "Fetching a single site comment should succeed")
 
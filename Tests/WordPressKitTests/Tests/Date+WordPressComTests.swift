@@ -25,6 +25,59 @@ class DateWordPressComTests: XCTestCase {
         XCTAssertNil(Date.with(wordPressComJSONString: "not a date"))
     }
 
+    func testDatesWithOffsets() {
+        let date = Date(timeIntervalSince1970: 1_679_238_000)
+        let strings = [
+            "2023-03-19T15:00:00+00:00",
+            "2023-03-19T15:00:00+0000",
+            "2023-03-19T17:30:00+02:30",
+            "2023-03-19T17:30:00+0230",
+            "2023-03-19T10:00:00-05",
+            "2023-03-19t15:00:00z",
+        ]
+        for string in strings {
+            XCTAssertEqual(Date.with(wordPressComJSONString: string), date, string)
+        }
+    }
+
+    func testDatesWithFractionalSeconds() throws {
+        let date = try XCTUnwrap(Date.with(wordPressComJSONString: "2023-03-19T15:00:00.123456+00:00"))
+        XCTAssertEqual(date.timeIntervalSince1970, 1_679_238_000.123456, accuracy: 0.000_001)
+        XCTAssertNil(Date.with(wordPressComJSONString: "2023-03-19T15:00:00.Z"))
+    }
+
+    func testGMTDatesWithoutTimeZone() {
+        XCTAssertNil(Date.with(wordPressComJSONString: "2023-03-19T15:00:00"))
+        XCTAssertEqual(Date.with(wordPressComGMTString: "2023-03-19T15:00:00"), Date(timeIntervalSince1970: 1_679_238_000))
+        XCTAssertEqual(Date.with(wordPressComGMTString: "2023-03-19T15:00:00Z"), Date(timeIntervalSince1970: 1_679_238_000))
+    }
+
+    func testInvalidDateComponents() {
+        let strings = [
+            "2023-02-29T00:00:00Z",
+            "2023-13-01T00:00:00Z",
+            "2023-04-31T00:00:00Z",
+            "2023-03-19T24:00:00Z",
+            "2023-03-19T15:60:00Z",
+            "2023-03-19T15:00:00+24:00",
+            "2023-03-19T15:00:00+00:00 ",
+            "2023-03-19 15:00:00Z",
+        ]
+        for string in strings {
+            XCTAssertNil(Date.with(wordPressComJSONString: string), string)
+        }
+        XCTAssertNotNil(Date.with(wordPressComJSONString: "2024-02-29T00:00:00Z"))
+    }
+
+    func testMatchesDateFormatter() throws {
+        // Dates across the years, including before 1970 and around leap days.
+        for timestamp in stride(from: -2_000_000_000, to: 4_000_000_000, by: 7_654_321) {
+            let date = Date(timeIntervalSince1970: TimeInterval(timestamp))
+            let string = DateFormatter.wordPressCom.string(from: date)
+            XCTAssertEqual(Date.with(wordPressComJSONString: string), DateFormatter.wordPressCom.date(from: string), string)
+        }
+    }
+
     func testValidRFC3339StringFromDate() {
         XCTAssertEqual(
             Date(timeIntervalSince1970: 1_679_238_000).wordPressComJSONString,
@@ -29,6 +29,68 @@ class DecodableDictionaryTests: XCTestCase {
         XCTAssertTrue(dictionary.data["array"] as? [Double] == [1.0, 2.0])
         XCTAssertTrue((dictionary.data["obj"] as? [String: Any])?["foo"] as? String == "bar")
     }
+
+    func testDecodableToDictionaryLeavesOutNull() throws {
+        let json = """
+            {
+                "data": {
+                    "null": null,
+                    "array": [1, null, "foo"],
+                    "obj": {
+                        "foo": null
+                    }
+                }
+            }
+        """
+
+        let dictionary = try JSONDecoder().decode(Dict.self, from: Data(json.utf8))
+
+        XCTAssertEqual(dictionary.data.count, 2)
+        XCTAssertNil(dictionary.data["null"])
+        XCTAssertEqual(dictionary.data["array"] as? NSArray, [1, "foo"])
+        XCTAssertEqual((dictionary.data["obj"] as? [String: Any])?.count, 0)
+    }
+
+    func testDecodingJSONValue() throws {
+        let json = """
+            {
+                "int": -5,
+                "large": 18446744073709551615,
+                "double": 1.5,
+                "bool": false,
+                "string": "5",
+                "null": null,
+                "array": [[], {}, [true]],
+                "obj": { "foo": { "bar": "baz" } }
+            }
+        """
+
+        let value = try JSONDecoder().decode(JSONValue.self, from: Data(json.utf8))
+
+        XCTAssertEqual(value, .object([
+            "int": .int(-5),
+            "large": .double(18446744073709551615),
+            "double": .double(1.5),
+            "bool": .bool(false),
+            "string": .string("5"),
+            "null": .null,
+            "array": .array([.array([]), .object([:]), .array([.bool(true)])]),
+            "obj": .object(["foo": .object(["bar": .string("baz")])]),
+        ]))
+    }
+
+    func testJSONValueNumbersBridgeLikeJSONSerialization() throws {
+        let value = try JSONDecoder().decode(JSONValue.self, from: Data("[0, 1, 1.5, true]".utf8))
+        let bridged = try XCTUnwrap(value.jsonObject as? [Any])
+        let serialized = try XCTUnwrap(JSONSerialization.jsonObject(with: Data("[0, 1, 1.5, true]".utf8)) as? [Any])
+
+        for (lhs, rhs) in zip(bridged, serialized) {
+            XCTAssertEqual(lhs as? Bool, rhs as? Bool)
+            XCTAssertEqual(lhs as? Int, rhs as? Int)
+            XCTAssertEqual(lhs as? Double, rhs as? Double)
+        }
+        XCTAssertEqual(bridged[1] as? Bool, true)
+    }
 }
 
 private struct Dict: Decodable {
@@ -0,0 +1,122 @@
+import Foundation
+import XCTest
+import OHHTTPStubs
+
+@testable import WordPressKit
+
+class MediaLibraryPagesTests: XCTestCase {
+
+    override func tearDown() {
+        super.tearDown()
+        HTTPStubs.removeAllStubs()
+    }
+
+    func testLoadingAllPages() async throws {
+        let mediaLibrary = MediaLibraryTestSupport(totalMedia: 250)
+        mediaLibrary.stubREST(siteID: 42, failAtPage: -1)
+
+        let remote = MediaServiceRemoteREST(wordPressComRestApi: WordPressComRestApi(), siteID: 42)
+        var pages = [[RemoteMedia]]()
+        for try await page in remote.mediaLibraryPages() {
+            pages.append(page)
+        }
+
+        XCTAssertEqual(pages.map { $0.count }, [100, 100, 50])
+        XCTAssertEqual(Set(pages.joined().compactMap { $0.mediaID?.intValue }).count, 250)
+    }
+
+    func testFailure() async throws {
+        let mediaLibrary = MediaLibraryTestSupport(totalMedia: 250)
+        mediaLibrary.stubREST(siteID: 42, failAtPage: 2)
+
+        let remote = MediaServiceRemoteREST(wordPressComRestApi: WordPressComRestApi(), siteID: 42)
+        var iterator = remote.mediaLibraryPages().makeAsyncIterator()
+
+        let firstPage = try await iterator.next()
+        XCTAssertEqual(firstPage?.count, 100)
+
+        do {
+            _ = try await iterator.next()
+            XCTFail("The second page should fail to load")
+        } catch {
+            // Expected.
+        }
+
+        let afterFailure = try await iterator.next()
+        XCTAssertNil(afterFailure)
+    }
+
+    func testPrefetchIsCancelledWhenIterationStops() async throws {
+        let cancelled = expectation(description: "The prefetch of the second page is cancelled")
+        let pages = MediaLibraryPages { pageHandle in
+            guard pageHandle != nil else {
+                return ([["ID": 1 as AnyObject]], "next")
+            }
+            do {
+                try await Task.sleep(nanoseconds: 10 * NSEC_PER_SEC)
+            } catch {
+                cancelled.fulfill()
+                throw error
+            }
+            return ([], nil)
+        }
+
+        for try await page in pages {
+            XCTAssertEqual(page.count, 1)
+            break
+        }
+
+        await fulfillment(of: [cancelled], timeout: 1)
+    }
+
+    func testPrefetchRequestIsCancelledWhenIterationStops() async throws {
+        let requested = expectation(description: "The second page is requested")
+        stub(condition: isPath("/rest/v1.1/sites/42/media")) { request in
+            guard request.url?.query?.contains("page_handle") == true else {
+                return HTTPStubsResponse(jsonObject: ["media": [["ID": 1]], "meta": ["next_page": "next"]], statusCode: 200, headers: nil)
+            }
+            requested.fulfill()
+            // The second page doesn't arrive before the test times out, unless its request is cancelled.
+            return HTTPStubsResponse(jsonObject: ["media": [], "meta": [:]], statusCode: 200, headers: nil).responseTime(10)
+        }
+
+        let cancelled = expectation(description: "The request of the second page is cancelled")
+        let api = WordPressComRestApi()
+        api.metricsObserver = HTTPMetricsObserver { metrics in
+            // The URL session task of a cancelled request completes without a response.
+            if metrics.statusCode == nil {
+                cancelled.fulfill()
+            }
+        }
+
+        let remote = MediaServiceRemoteREST(wordPressComRestApi: api, siteID: 42)
+        for try await page in remote.mediaLibraryPages() {
+            XCTAssertEqual(page.count, 1)
+            await fulfillment(of: [requested], timeout: 1)
+            break
+        }
+
+        await fulfillment(of: [cancelled], timeout: 2)
+    }
+
+    func testModifiedAfter() async throws {
+        var requests = [URLRequest]()
+        stub(condition: isPath("/rest/v1.1/sites/42/media")) { request in
+            requests.append(request)
+            return HTTPStubsResponse(jsonObject: ["media": [], "meta": ["next_page": ""]], statusCode: 200, headers: nil)
+        }
+
+        let remote = MediaServiceRemoteREST(wordPressComRestApi: WordPressComRestApi(), siteID: 42)
+        let pages = remote.mediaLibraryPages(modifiedAfter: Date(timeIntervalSince1970: 1_700_000_000), pageSize: 50)
+        for try await page in pages {
+            XCTAssertTrue(page.isEmpty)
+        }
+
+        XCTAssertEqual(requests.count, 1)
+        let query = try XCTUnwrap(requests.first?.url.flatMap { URLComponents(url: $0, resolvingAgainstBaseURL: false) }?.queryItems)
+        XCTAssertTrue(query.contains(URLQueryItem(name: "modified_after", value: "2023-11-14T22:13:20+0000")))
+        XCTAssertTrue(query.contains(URLQueryItem(name: "number", value: "50")))
+        XCTAssertFalse(query.contains { $0.name == "page_handle" })
+    }
+
+}
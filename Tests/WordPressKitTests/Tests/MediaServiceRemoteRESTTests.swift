@@ -68,6 +68,18 @@ class MediaServiceRemoteRESTTests: RemoteTestCase, RESTTestable {
         XCTAssertEqual(media.mediaID, remoteMedia?.mediaID)
     }
 
+    func testCreateMediaInUploadLane() {
+
+        let media = mockRemoteMedia()
+        var progress: Progress?
+        mediaServiceRemote.uploadMedia(media, progress: &progress, success: nil, failure: nil)
+        XCTAssertEqual(mockRemoteApi.priorityPassedIn, .default)
+
+        mediaServiceRemote.uploadPriority = .background
+        mediaServiceRemote.uploadMedia(media, progress: &progress, success: nil, failure: nil)
+        XCTAssertEqual(mockRemoteApi.priorityPassedIn, .background)
+    }
+
     func testCreateMediaError() {
 
         let response = ["errors": ["some error"]]
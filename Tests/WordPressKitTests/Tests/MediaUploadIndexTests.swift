@@ -0,0 +1,255 @@
+import Foundation
+import XCTest
+import CryptoKit
+@testable import WordPressKit
+
+class MediaUploadIndexTests: XCTestCase {
+
+    private let mockRemoteApi = MockWordPressComRestApi()
+    private var mediaServiceRemote: MediaServiceRemoteREST!
+    private var fileURL: URL!
+
+    override func setUpWithError() throws {
+        try super.setUpWithError()
+        mediaServiceRemote = MediaServiceRemoteREST(wordPressComRestApi: mockRemoteApi, siteID: NSNumber(value: 1))
+        fileURL = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString + ".jpg")
+        try Data("An image".utf8).write(to: fileURL)
+    }
+
+    override func tearDownWithError() throws {
+        try? FileManager.default.removeItem(at: fileURL)
+        try super.tearDownWithError()
+    }
+
+    // MARK: - Content hash
+
+    func testContentHash() throws {
+        try Data("abc".utf8).write(to: fileURL)
+        XCTAssertEqual(
+            try MediaUploadIndex.contentHash(ofFileAt: fileURL),
+            "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"
+        )
+    }
+
+    func testContentHashOfFileLargerThanAChunk() throws {
+        let data = Data((0..<(MediaUploadIndex.chunkSize * 2 + 100)).map { UInt8(truncatingIfNeeded: $0 * 31) })
+        try data.write(to: fileURL)
+
+        let expected = SHA256.hash(data: data).map { String(format: "%02x", $0) }.joined()
+        XCTAssertEqual(try MediaUploadIndex.contentHash(ofFileAt: fileURL), expected)
+    }
+
+    func testContentHashOfMissingFile() {
+        let url = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        XCTAssertThrowsError(try MediaUploadIndex.contentHash(ofFileAt: url))
+    }
+
+    // MARK: - Uploads
+
+    func testUploadedMediaIsReturnedForTheSameFile() throws {
+        let index = MediaUploadIndex()
+        mediaServiceRemote.uploadIndex = index
+
+        let uploaded = try upload(responseID: 10)
+        XCTAssertEqual(uploaded.mediaID, 10)
+        XCTAssertEqual(index.count, 1)
+
+        // The same content, in another file, isn't uploaded again.
+        let copyURL = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString + ".jpg")
+        try FileManager.default.copyItem(at: fileURL, to: copyURL)
+        defer { try? FileManager.default.removeItem(at: copyURL) }
+
+        mockRemoteApi.postMethodCalled = false
+        let found = expectation(description: "The indexed media is returned")
+        var progress: Progress?
+        mediaServiceRemote.uploadMedia(media(at: copyURL), progress: &progress, success: { media in
+            XCTAssertEqual(media?.mediaID, 10)
+            found.fulfill()
+        }, failure: { error in
+            XCTFail("Unexpected error: \(String(describing: error))")
+        })
+        wait(for: [found], timeout: 1)
+
+        XCTAssertFalse(mockRemoteApi.postMethodCalled)
+        XCTAssertEqual(progress?.fractionCompleted, 1)
+    }
+
+    func testFileIsUploadedWithoutWaitingForItsHashWhenTheIndexIsEmpty() throws {
+        let index = MediaUploadIndex()
+        mediaServiceRemote.uploadIndex = index
+
+        let uploaded = expectation(description: "The file is uploaded")
+        var progress: Progress?
+        mediaServiceRemote.uploadMedia(media(at: fileURL), progress: &progress, success: { media in
+            XCTAssertEqual(media?.mediaID, 10)
+            uploaded.fulfill()
+        }, failure: { error in
+            XCTFail("Unexpected error: \(String(describing: error))")
+        })
+
+        // The upload starts straight away, and the media is indexed once the file is hashed.
+        XCTAssertTrue(mockRemoteApi.postMethodCalled)
+        mockRemoteApi.successBlockPassedIn?(["media": [["ID": 10]]] as AnyObject, HTTPURLResponse())
+        wait(for: [uploaded], timeout: 1)
+
+        XCTAssertEqual(index.media(forContentHash: try MediaUploadIndex.contentHash(ofFileAt: fileURL))?.mediaID, 10)
+    }
+
+    func testContentHashOfTheUploadIsIndexed() throws {
+        let index = MediaUploadIndex()
+        mediaServiceRemote.uploadIndex = index
+
+        let uploaded = expectation(description: "The file is uploaded")
+        var progress: Progress?
+        mediaServiceRemote.uploadMedia(media(at: fileURL), progress: &progress, success: { _ in
+            uploaded.fulfill()
+        }, failure: { error in
+            XCTFail("Unexpected error: \(String(describing: error))")
+        })
+
+        // The multipart form hashes the file while it's uploaded, so it's not hashed again.
+        let filePart = try XCTUnwrap(mockRemoteApi.filePartsPassedIn?.first)
+        filePart.contentHashHandler?("streamed")
+        mockRemoteApi.successBlockPassedIn?(["media": [["ID": 10]]] as AnyObject, HTTPURLResponse())
+        wait(for: [uploaded], timeout: 1)
+
+        XCTAssertEqual(index.media(forContentHash: "streamed")?.mediaID, 10)
+        XCTAssertNil(index.media(forContentHash: try MediaUploadIndex.contentHash(ofFileAt: fileURL)))
+
+        // The file is hashed before it's uploaded again, so the form doesn't have to hash it.
+        _ = try upload(responseID: 11)
+        XCTAssertNil(mockRemoteApi.filePartsPassedIn?.first?.contentHashHandler)
+    }
+
+    func testChangedFileIsUploaded() throws {
+        mediaServiceRemote.uploadIndex = MediaUploadIndex()
+        _ = try upload(responseID: 10)
+
+        try Data("Another image".utf8).write(to: fileURL)
+        XCTAssertEqual(try upload(responseID: 11).mediaID, 11)
+        XCTAssertEqual(mediaServiceRemote.uploadIndex?.count, 2)
+    }
+
+    func testDeletedMediaIsUploadedAgainWhenVerified() throws {
+        let index = MediaUploadIndex()
+        index.verifiesMediaWithServer = true
+        mediaServiceRemote.uploadIndex = index
+        _ = try upload(responseID: 10)
+
+        // The indexed media is fetched first, and the file is uploaded again when it's not found.
+        mockRemoteApi.postMethodCalled = false
+        let uploaded = expectation(description: "The file is uploaded")
+        var progress: Progress?
+        mediaServiceRemote.uploadMedia(media(at: fileURL), progress: &progress, success: { media in
+            XCTAssertEqual(media?.mediaID, 12)
+            uploaded.fulfill()
+        }, failure: { error in
+            XCTFail("Unexpected error: \(String(describing: error))")
+        })
+
+        waitUntil { self.mockRemoteApi.getMethodCalled }
+        XCTAssertEqual(mockRemoteApi.URLStringPassedIn, mediaServiceRemote.path(forEndpoint: "sites/1/media/10", withVersion: ._1_1))
+        mockRemoteApi.failureBlockPassedIn?(NSError(domain: NSURLErrorDomain, code: NSURLErrorBadServerResponse), nil)
+
+        waitUntil { self.mockRemoteApi.postMethodCalled }
+        mockRemoteApi.successBlockPassedIn?(["media": [["ID": 12]]] as AnyObject, HTTPURLResponse())
+        wait(for: [uploaded], timeout: 1)
+
+        XCTAssertEqual(index.media(forContentHash: try MediaUploadIndex.contentHash(ofFileAt: fileURL))?.mediaID, 12)
+    }
+
+    func testFileIsUploadedAgainForAnotherPost() throws {
+        mediaServiceRemote.uploadIndex = MediaUploadIndex()
+        _ = try upload(responseID: 10)
+
+        // The post is only set when the file is uploaded, so the indexed media can't be returned.
+        mockRemoteApi.postMethodCalled = false
+        let attachedMedia = media(at: fileURL)
+        attachedMedia.postID = 5
+        attachedMedia.caption = "A caption"
+        var progress: Progress?
+        mediaServiceRemote.uploadMedia(attachedMedia, progress: &progress, success: nil, failure: nil)
+
+        waitUntil { self.mockRemoteApi.postMethodCalled }
+        let parameters = try XCTUnwrap(mockRemoteApi.parametersPassedIn as? [String: Any])
+        XCTAssertEqual(parameters["attrs[0][parent_id]"] as? NSNumber, 5)
+        XCTAssertEqual(parameters["attrs[0][caption]"] as? String, "A caption")
+    }
+
+    func testCancelledUploadOfIndexedMediaFails() throws {
+        mediaServiceRemote.uploadIndex = MediaUploadIndex()
+        _ = try upload(responseID: 10)
+
+        let failed = expectation(description: "The upload fails")
+        var progress: Progress?
+        mediaServiceRemote.uploadMedia(media(at: fileURL), progress: &progress, success: { _ in
+            XCTFail("The indexed media shouldn't be returned once the upload is cancelled")
+        }, failure: { error in
+            XCTAssertEqual((error as? URLError)?.code, .cancelled)
+            failed.fulfill()
+        })
+        progress?.cancel()
+        wait(for: [failed], timeout: 1)
+    }
+
+    func testIndexKeepsCopiesOfTheMedia() {
+        let index = MediaUploadIndex()
+        let media = RemoteMedia()
+        media.mediaID = 10
+        media.caption = "A caption"
+        index.add(media, forContentHash: "hash")
+
+        media.caption = "Another caption"
+        let indexed = index.media(forContentHash: "hash")
+        XCTAssertEqual(indexed?.mediaID, 10)
+        XCTAssertEqual(indexed?.caption, "A caption")
+
+        indexed?.caption = "Another caption"
+        XCTAssertEqual(index.media(forContentHash: "hash")?.caption, "A caption")
+    }
+
+    func testFilesAreUploadedWithoutAnIndex() {
+        var progress: Progress?
+        mediaServiceRemote.uploadMedia(media(at: fileURL), progress: &progress, success: nil, failure: nil)
+
+        // The upload starts straight away.
+        XCTAssertTrue(mockRemoteApi.postMethodCalled)
+    }
+
+    // MARK: - Helpers
+
+    private func media(at url: URL) -> RemoteMedia {
+        let media = RemoteMedia()
+        media.localURL = url
+        media.mimeType = "image/jpeg"
+        media.file = url.lastPathComponent
+        return media
+    }
+
+    /// Uploads the file, responding with a media that has the given ID.
+    private func upload(responseID: Int) throws -> RemoteMedia {
+        mockRemoteApi.postMethodCalled = false
+        let uploaded = expectation(description: "The file is uploaded")
+        var result: RemoteMedia?
+        var progress: Progress?
+        mediaServiceRemote.uploadMedia(media(at: fileURL), progress: &progress, success: { media in
+            result = media
+            uploaded.fulfill()
+        }, failure: { error in
+            XCTFail("Unexpected error: \(String(describing: error))")
+        })
+
+        // The file is hashed before it's uploaded, unless the index is empty.
+        waitUntil { self.mockRemoteApi.postMethodCalled }
+        mockRemoteApi.successBlockPassedIn?(["media": [["ID": responseID]]] as AnyObject, HTTPURLResponse())
+        wait(for: [uploaded], timeout: 1)
+
+        return try XCTUnwrap(result)
+    }
+
+    private func waitUntil(_ condition: @escaping () -> Bool) {
+        let predicate = NSPredicate { _, _ in condition() }
+        wait(for: [XCTNSPredicateExpectation(predicate: predicate, object: nil)], timeout: 2)
+    }
+
+}
@@ -6,6 +6,8 @@ class MockWordPressComRestApi: WordPressComRestApi {
     @objc var postMethodCalled = false
     @objc var URLStringPassedIn: String?
     @objc var parametersPassedIn: AnyObject?
+    @objc var filePartsPassedIn: [FilePart]?
+    @objc var priorityPassedIn: HTTPRequestPriority = .default
     @objc var successBlockPassedIn: ((AnyObject, HTTPURLResponse?) -> Void)?
     @objc var failureBlockPassedIn: ((NSError, HTTPURLResponse?) -> Void)?
 
@@ -34,6 +36,7 @@ class MockWordPressComRestApi: WordPressComRestApi {
     override func multipartPOST(_ URLString: String,
                                 parameters: [String: AnyObject]?,
                                 fileParts: [FilePart],
+                                priority: HTTPRequestPriority,
                                 requestEnqueued: RequestEnqueuedBlock? = nil,
                                 success: @escaping SuccessResponseBlock,
                                 failure: @escaping FailureReponseBlock) -> Progress? {
@@ -41,6 +44,8 @@ class MockWordPressComRestApi: WordPressComRestApi {
         postMethodCalled = true
         URLStringPassedIn = URLString
         parametersPassedIn = parameters as AnyObject?
+        filePartsPassedIn = fileParts
+        priorityPassedIn = priority
         successBlockPassedIn = success
         failureBlockPassedIn = failure
         return Progress()
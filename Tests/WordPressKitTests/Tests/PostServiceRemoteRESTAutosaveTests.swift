@@ -49,4 +49,33 @@ class PostServiceRemoteRESTAutosaveTests: RemoteTestCase, RESTTestable {
         })
         waitForExpectations(timeout: timeout, handler: nil)
     }
+
+    func testGetPostsAsyncPerformsAutosaveMappingSuccessfully() async throws {
+        stubRemoteResponse(postsEndpoint, filename: performPostsAutosaveSuccessFilename, contentType: .ApplicationJSON)
+
+        // The posts are decoded like `getPostsOfType(_:options:success:failure:)` maps them.
+        let remotePosts = try await remote.getPosts(ofType: "post")
+        let remotePost = try XCTUnwrap(remotePosts.first)
+
+        XCTAssertEqual(remotePosts.count, 1)
+        XCTAssertEqual(remotePost.title, "Hola, mundo!")
+        XCTAssertEqual(remotePost.autosave.identifier?.intValue, 100)
+        XCTAssertEqual(remotePost.autosave.postID, 102)
+        XCTAssertEqual(remotePost.autosave.title, "Hello, world!")
+        XCTAssertEqual(remotePost.autosave.modifiedDate, NSDate.with(wordPressComJSONString: "2019-10-28T02:06:39+00:00"))
+    }
+
+    func testGetPostsAsyncFailure() async throws {
+        stubRemoteResponse(postsEndpoint, filename: "site-active-purchases-auth-failure.json", contentType: .ApplicationJSON, status: 403)
+
+        do {
+            _ = try await remote.getPosts(ofType: "post")
+            XCTFail("Expected the call to throw")
+        } catch let error as WordPressAPIError<WordPressComRestApiEndpointError> {
+            guard case let .endpointError(endpointError) = error else {
+                return XCTFail("Unexpected error: \(error)")
+            }
+            XCTAssertEqual(endpointError.code, .authorizationRequired)
+        }
+    }
 }
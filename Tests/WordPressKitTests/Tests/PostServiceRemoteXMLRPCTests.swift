@@ -411,4 +411,16 @@ class PostServiceRemoteXMLRPCTests: RemoteTestCase, XMLRPCTestable {
 
         waitForExpectations(timeout: timeout, handler: nil)
     }
+
+    // MARK: - Multicall Tests
+
+    func testGetPostsMethodCall() throws {
+        let remoteInstance = try XCTUnwrap(remote as? PostServiceRemoteXMLRPC)
+        let call = remoteInstance.methodCallToGetPostsOfType("page", options: ["number": 10], success: nil, failure: nil)
+
+        XCTAssertEqual(call.method, "wp.getPosts")
+        let parameters = try XCTUnwrap(call.parameters?.last as? [String: Any])
+        XCTAssertEqual(parameters["post_type"] as? String, "page")
+        XCTAssertEqual(parameters["number"] as? Int, 10)
+    }
 }
@@ -0,0 +1,93 @@
+import Foundation
+import XCTest
+import OHHTTPStubs
+
+@testable import WordPressKit
+
+class ReaderPostServiceRemoteAsyncTests: RemoteTestCase, RESTTestable {
+
+    private let endpoint = URL(string: "https://public-api.wordpress.com/rest/v1.2/read/following")!
+
+    override func tearDown() {
+        RequestPhaseTimer.handler = nil
+        super.tearDown()
+    }
+
+    func testFetchPostsAtOffset() async throws {
+        stubRemoteResponse("read/following", filename: "reader-posts-success.json", contentType: .ApplicationJSON)
+
+        let service = ReaderPostServiceRemote(wordPressComRestApi: getRestApi())
+        let result = try await service.fetchPosts(fromEndpoint: endpoint, algorithm: nil, count: 10, offset: 20)
+
+        XCTAssertEqual(result.posts.count, 10)
+        XCTAssertEqual(result.posts.first?.sortRank, -20)
+        XCTAssertEqual(result.posts.last?.sortRank, -29)
+    }
+
+    func testFetchedPostsAreInResponseOrder() async throws {
+        stubRemoteResponse("read/following", filename: "reader-posts-success.json", contentType: .ApplicationJSON)
+
+        let url = try XCTUnwrap(Bundle(for: type(of: self)).url(forResource: "reader-posts-success.json", withExtension: nil))
+        let json = try XCTUnwrap(JSONSerialization.jsonObject(with: Data(contentsOf: url)) as? [String: Any])
+        let expectedIDs = try XCTUnwrap(json["posts"] as? [[String: Any]]).map { $0["ID"] as? NSNumber }
+
+        let service = ReaderPostServiceRemote(wordPressComRestApi: getRestApi())
+        let result = try await service.fetchPosts(fromEndpoint: endpoint, algorithm: nil, count: 10, offset: 0)
+
+        XCTAssertEqual(result.posts.map { $0.postID }, expectedIDs)
+        XCTAssertEqual(result.posts.map { $0.sortRank }, (0..<10).map { NSNumber(value: -Double($0)) as NSNumber? })
+    }
+
+    func testFetchPostsBeforeDate() async throws {
+        var request: URLRequest?
+        stub(condition: isHost("public-api.wordpress.com")) {
+            request = $0
+            return HTTPStubsResponse(jsonObject: ["posts": [] as [Any], "algorithm": "read:following"], statusCode: 200, headers: nil)
+        }
+
+        let service = ReaderPostServiceRemote(wordPressComRestApi: getRestApi())
+        let result = try await service.fetchPosts(fromEndpoint: endpoint, algorithm: "read:following", count: 5, before: Date())
+
+        XCTAssertEqual(result.posts.count, 0)
+        XCTAssertEqual(result.algorithm, "read:following")
+        let query = try XCTUnwrap(request?.url).query ?? ""
+        XCTAssertTrue(query.contains("number=5"))
+        XCTAssertTrue(query.contains("algorithm=read"))
+        XCTAssertTrue(query.contains("before="))
+    }
+
+    @MainActor
+    func testMapsPostsOffTheMainThread() async throws {
+        stubRemoteResponse("read/following", filename: "reader-posts-success.json", contentType: .ApplicationJSON)
+
+        let records = LockedRecords()
+        RequestPhaseTimer.handler = { records.append($0) }
+
+        let service = ReaderPostServiceRemote(wordPressComRestApi: getRestApi())
+        _ = try await service.fetchPosts(fromEndpoint: endpoint, algorithm: nil, count: 10, offset: 0)
+
+        XCTAssertTrue(Thread.isMainThread)
+        // The posts are decoded straight from the response data, so there's no separate mapping phase.
+        let phases = records.all.filter { $0.phase == .decode || $0.phase == .mapping }
+        XCTAssertEqual(phases.map(\.phase), [.decode])
+        XCTAssertTrue(phases.allSatisfy { !$0.isMainThread })
+    }
+
+}
+
+private final class LockedRecords {
+    private let lock = NSLock()
+    private var records = [RequestPhaseTimer.Record]()
+
+    var all: [RequestPhaseTimer.Record] {
+        lock.lock()
+        defer { lock.unlock() }
+        return records
+    }
+
+    func append(_ record: RequestPhaseTimer.Record) {
+        lock.lock()
+        records.append(record)
+        lock.unlock()
+    }
+}
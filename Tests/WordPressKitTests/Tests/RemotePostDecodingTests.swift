@@ -0,0 +1,116 @@
+import XCTest
+@testable import WordPressKit
+
+/// The posts and comments that are decoded straight from the response data have the same values as the ones that are
+/// mapped from the dictionaries of `JSONSerialization`.
+final class RemotePostDecodingTests: XCTestCase {
+
+    func testDecodedReaderPostsMatchMappedPosts() throws {
+        let data = try fixture("reader-posts-success.json")
+        let stringPool = StringInterningPool()
+        let decoded = try JSONDecoder(stringPool: stringPool).decode(RemoteReaderPostsEnvelope.self, from: data).posts
+        let mapped = try jsonObjects(data, key: "posts").map { RemoteReaderPost(dictionary: $0) }
+
+        XCTAssertEqual(decoded.count, mapped.count)
+        XCTAssertGreaterThan(stringPool.count, 0)
+        for (decoded, mapped) in zip(decoded, mapped) {
+            assertEqualValues(decoded, mapped, forKeys: [
+                "authorAvatarURL", "authorDisplayName", "authorEmail", "authorURL", "siteIconURL", "blogName",
+                "blogDescription", "blogURL", "commentCount", "commentsOpen", "featuredImage", "feedID", "feedItemID",
+                "globalID", "organizationID", "isBlogAtomic", "isBlogPrivate", "isFollowing", "isLiked", "isReblogged",
+                "isWPCom", "isSeen", "isSeenSupported", "likeCount", "score", "siteID", "sortDate", "sortRank",
+                "summary", "isLikesEnabled", "isSharingEnabled", "primaryTag", "primaryTagSlug", "secondaryTag",
+                "secondaryTagSlug", "isExternal", "isJetpack", "wordCount", "readingTime", "canSubscribeComments",
+                "isSubscribedComments", "receivesCommentNotifications", "authorID", "author", "content",
+                "date_created_gmt", "permalink", "postID", "postTitle", "status",
+            ])
+            // The tags and the railcar are made from objects, whose keys are in no particular order.
+            XCTAssertEqual(Set(decoded.tags.components(separatedBy: ", ")), Set(mapped.tags.components(separatedBy: ", ")))
+            XCTAssertEqual(try decoded.railcar.map(jsonObject), try mapped.railcar.map(jsonObject))
+            XCTAssertEqual(decoded.crossPostMeta?.postURL, mapped.crossPostMeta?.postURL)
+            XCTAssertEqual(decoded.sourceAttribution?.permalink, mapped.sourceAttribution?.permalink)
+            XCTAssertEqual(decoded.sourceAttribution?.taxonomies as NSArray?, mapped.sourceAttribution?.taxonomies as NSArray?)
+        }
+    }
+
+    func testDecodedPostsMatchMappedPosts() throws {
+        for filename in ["post-autosave-mapping-success.json", "reader-posts-success.json"] {
+            let data = try fixture(filename)
+            let decoded = try JSONDecoder().decode(RemotePostsEnvelope.self, from: data).posts
+            let mapped = try jsonObjects(data, key: "posts").map(PostServiceRemoteREST.remotePost(fromJSONDictionary:))
+
+            XCTAssertEqual(decoded.count, mapped.count)
+            for (decoded, mapped) in zip(decoded, mapped) {
+                assertEqualValues(decoded, mapped, forKeys: [
+                    "postID", "siteID", "authorAvatarURL", "authorDisplayName", "authorEmail", "authorURL", "authorID",
+                    "date", "dateModified", "title", "URL", "shortURL", "content", "excerpt", "slug", "suggestedSlug",
+                    "status", "password", "parentID", "postThumbnailID", "postThumbnailPath", "type", "format",
+                    "commentCount", "likeCount", "revisions", "pathForDisplayImage", "isStickyPost", "metadata",
+                ])
+                // The tags and categories are made from objects, whose keys are in no particular order.
+                XCTAssertEqual(Set(decoded.tags as? [String] ?? []), Set(mapped.tags as? [String] ?? []))
+                let categoryIDs = { (post: RemotePost) in Set((post.categories as? [RemotePostCategory] ?? []).map(\.categoryID)) }
+                XCTAssertEqual(categoryIDs(decoded), categoryIDs(mapped))
+                XCTAssertEqual(decoded.autosave?.identifier, mapped.autosave?.identifier)
+                XCTAssertEqual(decoded.autosave?.title, mapped.autosave?.title)
+                XCTAssertEqual(decoded.autosave?.modifiedDate, mapped.autosave?.modifiedDate)
+                XCTAssertEqual(decoded.autosave?.previewURL, mapped.autosave?.previewURL)
+            }
+        }
+    }
+
+    func testDecodedCommentsMatchMappedComments() throws {
+        let data = try fixture("site-comments-success.json")
+        let service = CommentServiceRemoteREST(wordPressComRestApi: WordPressComRestApi(), siteID: 1)
+        let decoded = try JSONDecoder().decode(RemoteCommentsEnvelope.self, from: data).comments
+        let mapped = try jsonObjects(data, key: "comments").map(service.remoteComment(fromJSONDictionary:))
+
+        XCTAssertFalse(decoded.isEmpty)
+        XCTAssertEqual(decoded.count, mapped.count)
+        for (decoded, mapped) in zip(decoded, mapped) {
+            assertEqualValues(decoded, mapped, forKeys: [
+                "commentID", "authorID", "author", "authorEmail", "authorUrl", "authorAvatarURL", "authorIP", "content",
+                "rawContent", "date", "link", "parentID", "postID", "postTitle", "status", "type", "isLiked", "likeCount",
+                "canModerate",
+            ])
+        }
+    }
+
+    func testDecodesValuesLeniently() throws {
+        let json = #"""
+        {"ID": "42", "i_like": 1, "like_count": "3", "author": false, "post": {"ID": 7, "title": 1984}, "status": "unapproved"}
+        """#
+        let comment = try JSONDecoder().decode(RemoteCommentPayload.self, from: Data(json.utf8)).comment
+
+        XCTAssertEqual(comment.commentID, NSNumber(value: 42))
+        XCTAssertTrue(comment.isLiked)
+        XCTAssertEqual(comment.likeCount, NSNumber(value: 3))
+        XCTAssertNil(comment.authorID)
+        XCTAssertEqual(comment.postID, NSNumber(value: 7))
+        XCTAssertEqual(comment.postTitle, "1984")
+        XCTAssertEqual(comment.status, "hold")
+    }
+
+    // MARK: - Helpers
+
+    private func assertEqualValues(_ decoded: NSObject, _ mapped: NSObject, forKeys keys: [String], line: UInt = #line) {
+        for key in keys {
+            XCTAssertEqual(decoded.value(forKey: key) as? NSObject, mapped.value(forKey: key) as? NSObject, key, line: line)
+        }
+    }
+
+    private func fixture(_ filename: String) throws -> Data {
+        let url = try XCTUnwrap(Bundle(for: type(of: self)).url(forResource: filename, withExtension: nil))
+        return try Data(contentsOf: url)
+    }
+
+    private func jsonObjects(_ data: Data, key: String) throws -> [[AnyHashable: Any]] {
+        let json = try XCTUnwrap(JSONSerialization.jsonObject(with: data) as? [String: Any])
+        return try XCTUnwrap(json[key] as? [[AnyHashable: Any]])
+    }
+
+    private func jsonObject(_ string: String) throws -> NSDictionary {
+        try XCTUnwrap(JSONSerialization.jsonObject(with: Data(string.utf8)) as? NSDictionary)
+    }
+
+}
@@ -24,6 +24,7 @@
 - (NSString *)removeForbiddenTags:(NSString *)string;
 - (NSString *)postTitleFromPostDictionary:(NSDictionary *)dict;
 - (NSString *)postSummaryFromPostDictionary:(NSDictionary *)dict orPostContent:(NSString *)content;
+- (NSString *)titleFromSummary:(NSString *)summary;
 - (NSString *)resizeGalleryImageURLsForContent:(NSString *)content isPrivateSite:(BOOL)isPrivateSite;
 
 @end
@@ -356,4 +357,59 @@
     XCTAssertTrue([readingTime integerValue] == 4, @"1000 words should take about 4 minutes to read");
 }
 
+- (void)testDerivedValuesAreMadeWhenRead
+{
+    NSMutableDictionary *dict = [[self demoTagsAndEditorialDictionary] mutableCopy];
+    dict[@"title"] = @"";
+    dict[@"excerpt"] = @"<p>A post without a title &amp; a long enough summary</p>";
+    dict[@"railcar"] = @{@"railcar": @"abc"};
+    RemoteReaderPost *remoteReaderPost = [[RemoteReaderPost alloc] initWithDictionary:dict];
+
+    XCTAssertEqualObjects(remoteReaderPost.summary, @"A post without a title & a long enough summary");
+    XCTAssertEqualObjects(remoteReaderPost.postTitle, [remoteReaderPost titleFromSummary:remoteReaderPost.summary]);
+    XCTAssertEqualObjects(remoteReaderPost.primaryTag, @"Editorial");
+    XCTAssertEqualObjects(remoteReaderPost.secondaryTagSlug, @"primary");
+    XCTAssertNotNil(remoteReaderPost.railcar);
+    XCTAssertNil(remoteReaderPost.crossPostMeta);
+}
+
+- (void)testDerivedValuesCanBeSetBeforeTheyAreRead
+{
+    NSMutableDictionary *dict = [[self demoTagDictionary] mutableCopy];
+    dict[@"title"] = @"<b>Title</b>";
+    RemoteReaderPost *remoteReaderPost = [[RemoteReaderPost alloc] initWithDictionary:dict];
+
+    remoteReaderPost.postTitle = @"Another title";
+    remoteReaderPost.summary = nil;
+    remoteReaderPost.secondaryTag = @"Another tag";
+
+    XCTAssertEqualObjects(remoteReaderPost.postTitle, @"Another title");
+    XCTAssertNil(remoteReaderPost.summary);
+    XCTAssertEqualObjects(remoteReaderPost.primaryTag, @"Primary", @"Setting a tag shouldn't discard the other tags.");
+    XCTAssertEqualObjects(remoteReaderPost.secondaryTag, @"Another tag");
+}
+
+- (void)testDerivedValuesCanBeReadConcurrently
+{
+    NSMutableDictionary *dict = [[self demoTagsAndEditorialDictionary] mutableCopy];
+    dict[@"title"] = @"";
+    dict[@"excerpt"] = @"<p>A post without a title &amp; a long enough summary</p>";
+    dict[@"site_name"] = @"A site";
+    dict[@"railcar"] = @{@"railcar": @"abc"};
+
+    NSArray<NSString *> *keys = @[@"blogName", @"blogDescription", @"featuredImage", @"postTitle", @"summary", @"tags",
+                                  @"primaryTag", @"primaryTagSlug", @"secondaryTag", @"secondaryTagSlug",
+                                  @"crossPostMeta", @"railcar"];
+    // The values that are missing are `NSNull`s.
+    NSDictionary *expected = [[[RemoteReaderPost alloc] initWithDictionary:dict] dictionaryWithValuesForKeys:keys];
+
+    for (NSInteger iteration = 0; iteration < 50; iteration++) {
+        RemoteReaderPost *remoteReaderPost = [[RemoteReaderPost alloc] initWithDictionary:dict];
+        dispatch_apply(keys.count * 4, DISPATCH_APPLY_AUTO, ^(size_t i) {
+            NSString *key = keys[i % keys.count];
+            XCTAssertEqualObjects([remoteReaderPost valueForKey:key] ?: [NSNull null], expected[key], @"%@", key);
+        });
+    }
+}
+
 @end
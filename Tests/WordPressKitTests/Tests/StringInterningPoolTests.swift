@@ -0,0 +1,41 @@
+import Foundation
+import XCTest
+@testable import WordPressKit
+
+class StringInterningPoolTests: XCTestCase {
+
+    func testEqualStringsAreShared() {
+        let pool = StringInterningPool()
+        let first = NSMutableString(string: "https://example.wordpress.com")
+        let second = NSMutableString(string: "https://example.wordpress.com")
+
+        let interned = pool.intern(first)
+        XCTAssertTrue(pool.intern(second) === interned)
+        XCTAssertEqual(pool.count, 1)
+
+        // The pool keeps its own copy of mutable strings.
+        first.append("/changed")
+        XCTAssertEqual(pool.intern("https://example.wordpress.com" as String), "https://example.wordpress.com")
+        XCTAssertNil(pool.intern(nil as String?))
+    }
+
+    func testReaderPostsShareRepeatedValues() throws {
+        let pool = StringInterningPool()
+        let json = """
+        {"ID": 1, "site_URL": "https://example.wordpress.com", "site_name": "<b>Example</b> site", "status": "publish"}
+        """
+        // Each post is parsed separately, like the posts of different responses.
+        let posts = try (0..<2).map { _ in
+            try RemoteReaderPost(
+                dictionary: XCTUnwrap(JSONSerialization.jsonObject(with: Data(json.utf8)) as? [AnyHashable: Any]),
+                stringPool: pool
+            )
+        }
+
+        for key in ["blogURL", "blogName", "status"] {
+            XCTAssertTrue(posts[0].value(forKey: key) as AnyObject === posts[1].value(forKey: key) as AnyObject, key)
+        }
+        XCTAssertEqual(posts[0].blogName, "Example site")
+    }
+
+}
@@ -17,6 +17,79 @@ class ChecksumUtilTests: XCTestCase {
         XCTAssertNotEqual(firstChecksum, secondChecksum)
     }
 
+    func testChecksumIsStable() {
+        let data = mockedData(withFilename: blockSettingsThemeJSONResponseFilename)
+        let first = try! JSONDecoder().decode(RemoteBlockEditorSettings.self, from: data)
+        let second = try! JSONDecoder().decode(RemoteBlockEditorSettings.self, from: data)
+
+        XCTAssertEqual(ChecksumUtil.checksum(from: first), ChecksumUtil.checksum(from: second))
+        XCTAssertEqual(ChecksumUtil.checksum(from: first).count, 64)
+    }
+
+    func testChecksumDoesNotDependOnKeyOrder() {
+        let first: [String: String] = ["slug": "primary", "color": "#fff", "name": "Primary"]
+        var second: [String: String] = [:]
+        for key in ["name", "color", "slug"] {
+            second[key] = first[key]
+        }
+
+        XCTAssertEqual(ChecksumUtil.checksum(from: first), ChecksumUtil.checksum(from: second))
+    }
+
+    func testChecksumDetectsChanges() {
+        let colors = [["slug": "primary", "color": "#fff"]]
+
+        XCTAssertNotEqual(ChecksumUtil.checksum(from: colors), ChecksumUtil.checksum(from: [["slug": "primary", "color": "#000"]]))
+        // The boundaries between keys and values, and between elements, are part of the checksum.
+        XCTAssertNotEqual(ChecksumUtil.checksum(from: ["ab": "c"]), ChecksumUtil.checksum(from: ["a": "bc"]))
+        XCTAssertNotEqual(ChecksumUtil.checksum(from: ["ab", "c"]), ChecksumUtil.checksum(from: ["a", "bc"]))
+        XCTAssertNotEqual(ChecksumUtil.checksum(from: [[String]]()), ChecksumUtil.checksum(from: [[String]()]))
+        // The types of the values are part of the checksum.
+        XCTAssertNotEqual(ChecksumUtil.checksum(from: ["1"]), ChecksumUtil.checksum(from: [1]))
+        XCTAssertNotEqual(ChecksumUtil.checksum(from: [true]), ChecksumUtil.checksum(from: [1]))
+        XCTAssertNotEqual(ChecksumUtil.checksum(from: [String?.none]), ChecksumUtil.checksum(from: [""]))
+    }
+
+    func testChecksumOfNestedArrays() throws {
+        struct Palette: Encodable {
+            var name: String
+            var gradients: [[String]]
+        }
+
+        let palette = Palette(name: "Default", gradients: [["#fff", "#000"], ["#f00"]])
+        let digest = try ContentHashEncoder().hexDigest(of: palette)
+        XCTAssertEqual(digest.count, 64)
+        XCTAssertEqual(ChecksumUtil.checksum(from: palette), digest)
+
+        // The elements of the nested arrays, and how they're nested, are part of the checksum.
+        let flattened = Palette(name: "Default", gradients: [["#fff", "#000", "#f00"]])
+        let changed = Palette(name: "Default", gradients: [["#fff", "#000"], ["#0f0"]])
+        XCTAssertNotEqual(try ContentHashEncoder().hexDigest(of: flattened), digest)
+        XCTAssertNotEqual(try ContentHashEncoder().hexDigest(of: changed), digest)
+    }
+
+    func testChecksumOfArraysOfObjects() throws {
+        let first: [[String: [String]]] = [["slug": ["primary"], "colors": ["#fff", "#000"]], ["slug": ["secondary"]]]
+        var reordered: [String: [String]] = [:]
+        for key in ["colors", "slug"] {
+            reordered[key] = first[0][key]
+        }
+        let second = [reordered, first[1]]
+
+        XCTAssertEqual(try ContentHashEncoder().hexDigest(of: first), try ContentHashEncoder().hexDigest(of: second))
+        // The objects that follow each other in an array aren't merged.
+        let merged: [[String: [String]]] = [["slug": ["secondary"], "colors": ["#fff", "#000"]]]
+        XCTAssertNotEqual(try ContentHashEncoder().hexDigest(of: first), try ContentHashEncoder().hexDigest(of: merged))
+        XCTAssertNotEqual(try ContentHashEncoder().hexDigest(of: first), try ContentHashEncoder().hexDigest(of: [first[1], first[0]]))
+    }
+
+    func testChecksumOfBridgedString() {
+        let string = String(repeating: "Théme ", count: 2_000)
+        let bridged = NSMutableString(string: string) as String
+
+        XCTAssertEqual(ChecksumUtil.checksum(from: [bridged]), ChecksumUtil.checksum(from: [string]))
+    }
+
     func mockedData(withFilename filename: String) -> Data {
         let json = Bundle(for: ChecksumUtilTests.self).url(forResource: filename, withExtension: "json")!
         return try! Data(contentsOf: json)